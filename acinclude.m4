@@ -2,5 +2,25 @@ dnl Function to detect if libesedb dependencies are available
 AC_DEFUN([AX_LIBESEDB_CHECK_LOCAL],
  [dnl Check for internationalization functions in libesedb/libesedb_i18n.c 
  AC_CHECK_FUNCS([bindtextdomain])
+
+ dnl Headers included in libesedb/libesedb_io_handle.c
+ AC_CHECK_HEADERS([errno.h fcntl.h sys/mman.h sys/stat.h unistd.h])
+
+ dnl Memory mapped file, positional read and read-ahead functions used in libesedb/libesedb_io_handle.c
+ AS_IF(
+  [test "x$ac_cv_enable_winapi" = xno],
+  [AC_CHECK_FUNCS([madvise mmap munmap pread])
+  ])
  ])
 
+dnl Function to detect if esedbtools dependencies are available
+AC_DEFUN([AX_ESEDBTOOLS_CHECK_LOCAL],
+ [dnl Headers included in esedbtools/verification_handle.c
+ AC_HEADER_TIME
+
+ dnl Monotonic clock function used in esedbtools/verification_handle.c
+ AC_SEARCH_LIBS(
+  [clock_gettime],
+  [rt])
+ AC_CHECK_FUNCS([clock_gettime])
+ ])
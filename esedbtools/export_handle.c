@@ -44,6 +44,8 @@
 
 #define EXPORT_HANDLE_NOTIFY_STREAM	stdout
 
+#define EXPORT_HANDLE_INDEX_RECORDS_BATCH_SIZE	256
+
 /* Creates an export handle
  * Make sure the value export_handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -1085,6 +1087,7 @@ int export_handle_export_table(
 	system_character_t *value_string  = NULL;
 	libesedb_column_t *column         = NULL;
 	libesedb_record_t *record         = NULL;
+	libesedb_table_cursor_t *cursor   = NULL;
 	FILE *table_file_stream           = NULL;
 	static char *function             = "export_handle_export_table";
 	size_t item_filename_size         = 0;
@@ -1092,7 +1095,6 @@ int export_handle_export_table(
 	int column_iterator               = 0;
 	int known_table                   = 0;
 	int number_of_columns             = 0;
-	int number_of_records             = 0;
 	int record_iterator               = 0;
 	int result                        = 0;
 
@@ -1319,30 +1321,30 @@ int export_handle_export_table(
 		}
 	}
 	/* Write the record (row) values to the table file
+	 * The records are read with a cursor that walks the leaf pages of the table
 	 */
-	if( libesedb_table_get_number_of_records(
+	if( libesedb_table_cursor_open(
 	     table,
-	     &number_of_records,
+	     &cursor,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of records.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to open table cursor.",
 		 function );
 
 		goto on_error;
 	}
-	for( record_iterator = 0;
-	     record_iterator < number_of_records;
-	     record_iterator++ )
+	while( export_handle->abort == 0 )
 	{
-		if( libesedb_table_get_record(
-		     table,
-		     record_iterator,
-		     &record,
-		     error ) != 1 )
+		result = libesedb_table_cursor_next(
+		          cursor,
+		          &record,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1354,6 +1356,10 @@ int export_handle_export_table(
 
 			goto on_error;
 		}
+		else if( result == 0 )
+		{
+			break;
+		}
 		known_table = 0;
 
 		if( table_name_length == 3 )
@@ -1559,10 +1565,20 @@ int export_handle_export_table(
 
 			goto on_error;
 		}
-		if( export_handle->abort != 0 )
-		{
-			break;
-		}
+		record_iterator++;
+	}
+	if( libesedb_table_cursor_close(
+	     &cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to close table cursor.",
+		 function );
+
+		goto on_error;
 	}
 	if( file_stream_close(
 	     table_file_stream ) != 0 )
@@ -1612,6 +1628,12 @@ on_error:
 		 &record,
 		 NULL );
 	}
+	if( cursor != NULL )
+	{
+		libesedb_table_cursor_close(
+		 &cursor,
+		 NULL );
+	}
 	if( value_string != NULL )
 	{
 		memory_free(
@@ -1983,8 +2005,10 @@ int export_handle_export_index(
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
+	libesedb_record_t *records[ EXPORT_HANDLE_INDEX_RECORDS_BATCH_SIZE ] = { NULL };
+
 	system_character_t *item_filename = NULL;
-	libesedb_record_t *record         = NULL;
+	libesedb_index_cursor_t *cursor   = NULL;
 	FILE *index_file_stream           = NULL;
 	static char *function             = "export_handle_export_index";
 	int known_index                   = 0;
@@ -2218,76 +2242,101 @@ int export_handle_export_index(
 	}
 #endif
 	/* Write the record (row) values to the index file
+	 * The records are read in batches, so that the table records referenced
+	 * by the index values can be looked up in key order
 	 */
-	if( libesedb_index_get_number_of_records(
+	if( libesedb_index_seek(
 	     index,
-	     &number_of_records,
+	     NULL,
+	     0,
+	     0,
+	     &cursor,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of records.",
+		 "%s: unable to seek first index value.",
 		 function );
 
 		goto on_error;
 	}
-	for( record_iterator = 0;
-	     record_iterator < number_of_records;
-	     record_iterator++ )
+	do
 	{
-		if( libesedb_index_get_record(
-		     index,
-		     record_iterator,
-		     &record,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve record: %d.",
-			 function,
-			 record_iterator );
-
-			goto on_error;
-		}
-		known_index = 0;
+		result = libesedb_index_cursor_next_records(
+		          cursor,
+		          records,
+		          EXPORT_HANDLE_INDEX_RECORDS_BATCH_SIZE,
+		          &number_of_records,
+		          error );
 
-		if( known_index == 0 )
-		{
-			result = export_handle_export_record(
-			          record,
-			          index_file_stream,
-			          log_handle,
-			          error );
-		}
-		if( result != 1 )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export record.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next records.",
 			 function );
 
 			goto on_error;
 		}
-		if( libesedb_record_free(
-		     &record,
-		     error ) != 1 )
+		for( record_iterator = 0;
+		     record_iterator < number_of_records;
+		     record_iterator++ )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free record.",
-			 function );
+			known_index = 0;
 
-			goto on_error;
+			if( known_index == 0 )
+			{
+				result = export_handle_export_record(
+				          records[ record_iterator ],
+				          index_file_stream,
+				          log_handle,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export record.",
+				 function );
+
+				goto on_error;
+			}
+			if( libesedb_record_free(
+			     &( records[ record_iterator ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record.",
+				 function );
+
+				goto on_error;
+			}
 		}
 	}
+	while( number_of_records == EXPORT_HANDLE_INDEX_RECORDS_BATCH_SIZE );
+
+	if( libesedb_index_cursor_close(
+	     &cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to close index cursor.",
+		 function );
+
+		goto on_error;
+	}
 	if( file_stream_close(
 	     index_file_stream ) != 0 )
 	{
@@ -2305,10 +2354,21 @@ int export_handle_export_index(
 	return( 1 );
 
 on_error:
-	if( record != NULL )
+	for( record_iterator = 0;
+	     record_iterator < EXPORT_HANDLE_INDEX_RECORDS_BATCH_SIZE;
+	     record_iterator++ )
 	{
-		libesedb_record_free(
-		 &record,
+		if( records[ record_iterator ] != NULL )
+		{
+			libesedb_record_free(
+			 &( records[ record_iterator ] ),
+			 NULL );
+		}
+	}
+	if( cursor != NULL )
+	{
+		libesedb_index_cursor_close(
+		 &cursor,
 		 NULL );
 	}
 #ifdef TODO
@@ -0,0 +1,963 @@
+/*
+ * Verification handle
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( TIME_WITH_SYS_TIME )
+#include <sys/time.h>
+#include <time.h>
+#elif defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#else
+#include <time.h>
+#endif
+
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libcsystem.h"
+#include "esedbtools_libcthreads.h"
+#include "esedbtools_libesedb.h"
+#include "verification_handle.h"
+
+#define VERIFICATION_HANDLE_NOTIFY_STREAM	stdout
+
+/* Retrieves the current time in seconds
+ */
+double verification_handle_get_time(
+        void )
+{
+#if defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec current_time;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &current_time ) == 0 )
+	{
+		return( (double) current_time.tv_sec + ( (double) current_time.tv_nsec / 1000000000.0 ) );
+	}
+#endif
+	return( (double) time(
+	                  NULL ) );
+}
+
+/* Creates a verification handle
+ * Make sure the value verification_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_initialize(
+     verification_handle_t **verification_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_initialize";
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *verification_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid verification handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*verification_handle = memory_allocate_structure(
+	                        verification_handle_t );
+
+	if( *verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create verification handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *verification_handle,
+	     0,
+	     sizeof( verification_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear verification handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_file_initialize(
+	     &( ( *verification_handle )->input_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file.",
+		 function );
+
+		goto on_error;
+	}
+	( *verification_handle )->number_of_threads = 4;
+	( *verification_handle )->notify_stream     = VERIFICATION_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *verification_handle != NULL )
+	{
+		memory_free(
+		 *verification_handle );
+
+		*verification_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a verification handle
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_free(
+     verification_handle_t **verification_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_free";
+	int result            = 1;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *verification_handle != NULL )
+	{
+		if( libesedb_file_free(
+		     &( ( *verification_handle )->input_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input file.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *verification_handle );
+
+		*verification_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the verification handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_signal_abort(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_signal_abort";
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	verification_handle->abort = 1;
+
+	if( verification_handle->input_file != NULL )
+	{
+		if( libesedb_file_signal_abort(
+		     verification_handle->input_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal input file to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the number of threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int verification_handle_set_number_of_threads(
+     verification_handle_t *verification_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_set_number_of_threads";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( libcsystem_string_decimal_copy_to_64_bit(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to determine number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > (uint64_t) VERIFICATION_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		return( 0 );
+	}
+	verification_handle->number_of_threads = (int) value_64bit;
+
+	return( 1 );
+}
+
+/* Opens the verification handle
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_open(
+     verification_handle_t *verification_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_open";
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libesedb_file_open_wide(
+	     verification_handle->input_file,
+	     filename,
+	     LIBESEDB_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libesedb_file_open(
+	     verification_handle->input_file,
+	     filename,
+	     LIBESEDB_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_file_get_page_size(
+	     verification_handle->input_file,
+	     &( verification_handle->page_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_file_get_number_of_pages(
+	     verification_handle->input_file,
+	     &( verification_handle->number_of_pages ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of pages.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes the verification handle
+ * Returns the 0 if succesful or -1 on error
+ */
+int verification_handle_close(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_close";
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_file_close(
+	     verification_handle->input_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Verifies a range of pages
+ * This function is the start function of a worker thread, the error is stored in the worker
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_verify_pages(
+     verification_worker_t *verification_worker )
+{
+	verification_handle_t *verification_handle = NULL;
+	uint8_t *page_data                         = NULL;
+	static char *function                      = "verification_handle_verify_pages";
+	uint32_t page_flags                        = 0;
+	uint32_t page_number                       = 0;
+	int result                                 = 0;
+
+	if( verification_worker == NULL )
+	{
+		return( -1 );
+	}
+	verification_handle = verification_worker->verification_handle;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 &( verification_worker->error ),
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification worker - missing verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( verification_handle->page_size == 0 )
+	{
+		libcerror_error_set(
+		 &( verification_worker->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid verification handle - missing page size.",
+		 function );
+
+		return( -1 );
+	}
+	page_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * verification_handle->page_size );
+
+	if( page_data == NULL )
+	{
+		libcerror_error_set(
+		 &( verification_worker->error ),
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create page data.",
+		 function );
+
+		goto on_error;
+	}
+	for( page_number = verification_worker->first_page_number;
+	     page_number <= verification_worker->last_page_number;
+	     page_number++ )
+	{
+		if( verification_handle->abort != 0 )
+		{
+			break;
+		}
+		result = libesedb_file_verify_page(
+		          verification_handle->input_file,
+		          page_number,
+		          page_data,
+		          (size_t) verification_handle->page_size,
+		          &page_flags,
+		          &( verification_worker->error ) );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &( verification_worker->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 verification_handle->notify_stream,
+			 "Page: %" PRIu32 " at offset: %" PRIu64 " is corrupted (flags: 0x%08" PRIx32 ").\n",
+			 page_number,
+			 (uint64_t) ( page_number + 1 ) * verification_handle->page_size,
+			 page_flags );
+
+			verification_worker->results.number_of_corrupted_pages += 1;
+
+			continue;
+		}
+		verification_worker->results.number_of_valid_pages += 1;
+
+		if( ( page_data[ 0 ] == 0 )
+		 && ( page_data[ 1 ] == 0 )
+		 && ( page_data[ 2 ] == 0 )
+		 && ( page_data[ 3 ] == 0 ) )
+		{
+			verification_worker->results.number_of_pages_per_type[ VERIFICATION_HANDLE_PAGE_TYPE_UNINITIALIZED ] += 1;
+
+			continue;
+		}
+		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_ROOT ) != 0 )
+		{
+			verification_worker->results.number_of_pages_per_type[ VERIFICATION_HANDLE_PAGE_TYPE_ROOT ] += 1;
+		}
+		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+		{
+			verification_worker->results.number_of_pages_per_type[ VERIFICATION_HANDLE_PAGE_TYPE_LEAF ] += 1;
+		}
+		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_PARENT ) != 0 )
+		{
+			verification_worker->results.number_of_pages_per_type[ VERIFICATION_HANDLE_PAGE_TYPE_PARENT ] += 1;
+		}
+		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
+		{
+			verification_worker->results.number_of_pages_per_type[ VERIFICATION_HANDLE_PAGE_TYPE_EMPTY ] += 1;
+		}
+		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_SPACE_TREE ) != 0 )
+		{
+			verification_worker->results.number_of_pages_per_type[ VERIFICATION_HANDLE_PAGE_TYPE_SPACE_TREE ] += 1;
+		}
+		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_INDEX ) != 0 )
+		{
+			verification_worker->results.number_of_pages_per_type[ VERIFICATION_HANDLE_PAGE_TYPE_INDEX ] += 1;
+		}
+		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LONG_VALUE ) != 0 )
+		{
+			verification_worker->results.number_of_pages_per_type[ VERIFICATION_HANDLE_PAGE_TYPE_LONG_VALUE ] += 1;
+		}
+		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_SCRUBBED ) != 0 )
+		{
+			verification_worker->results.number_of_pages_per_type[ VERIFICATION_HANDLE_PAGE_TYPE_SCRUBBED ] += 1;
+		}
+	}
+	memory_free(
+	 page_data );
+
+	return( 1 );
+
+on_error:
+	if( page_data != NULL )
+	{
+		memory_free(
+		 page_data );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The worker thread start function
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_worker_thread_start(
+     void *arguments )
+{
+	return( verification_handle_verify_pages(
+	         (verification_worker_t *) arguments ) );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Verifies all the pages in the file
+ * The pages are divided into contiguous ranges, one per thread, so that
+ * every thread reads sequentially
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_verify(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error )
+{
+	verification_worker_t *verification_workers = NULL;
+	static char *function                       = "verification_handle_verify";
+	uint32_t first_page_number                  = 1;
+	uint32_t number_of_pages_per_worker         = 0;
+	double start_time                           = 0.0;
+	int number_of_workers                       = 0;
+	int page_type                               = 0;
+	int result                                  = 1;
+	int worker_index                            = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_t **threads              = NULL;
+#endif
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &( verification_handle->results ),
+	     0,
+	     sizeof( verification_results_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear results.",
+		 function );
+
+		return( -1 );
+	}
+	verification_handle->elapsed_time      = 0.0;
+	verification_handle->number_of_workers = 0;
+
+	if( verification_handle->number_of_pages == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	number_of_workers = verification_handle->number_of_threads;
+#else
+	number_of_workers = 1;
+#endif
+	if( (uint32_t) number_of_workers > verification_handle->number_of_pages )
+	{
+		number_of_workers = (int) verification_handle->number_of_pages;
+	}
+	verification_handle->number_of_workers = number_of_workers;
+
+	number_of_pages_per_worker = verification_handle->number_of_pages / (uint32_t) number_of_workers;
+
+	verification_workers = (verification_worker_t *) memory_allocate(
+	                                                  sizeof( verification_worker_t ) * number_of_workers );
+
+	if( verification_workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create verification workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     verification_workers,
+	     0,
+	     sizeof( verification_worker_t ) * number_of_workers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear verification workers.",
+		 function );
+
+		goto on_error;
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		verification_workers[ worker_index ].verification_handle = verification_handle;
+		verification_workers[ worker_index ].first_page_number   = first_page_number;
+
+		if( worker_index == ( number_of_workers - 1 ) )
+		{
+			verification_workers[ worker_index ].last_page_number = verification_handle->number_of_pages;
+		}
+		else
+		{
+			verification_workers[ worker_index ].last_page_number = first_page_number + number_of_pages_per_worker - 1;
+		}
+		first_page_number += number_of_pages_per_worker;
+	}
+	start_time = verification_handle_get_time();
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	threads = (libcthreads_thread_t **) memory_allocate(
+	                                     sizeof( libcthreads_thread_t * ) * number_of_workers );
+
+	if( threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     threads,
+	     0,
+	     sizeof( libcthreads_thread_t * ) * number_of_workers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear threads.",
+		 function );
+
+		goto on_error;
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( threads[ worker_index ] ),
+		     NULL,
+		     verification_handle_worker_thread_start,
+		     &( verification_workers[ worker_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread: %d.",
+			 function,
+			 worker_index );
+
+			verification_handle->abort = 1;
+
+			result = -1;
+
+			break;
+		}
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( threads[ worker_index ] == NULL )
+		{
+			continue;
+		}
+		if( libcthreads_thread_join(
+		     &( threads[ worker_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+		}
+	}
+	memory_free(
+	 threads );
+
+	threads = NULL;
+#else
+	verification_handle_verify_pages(
+	 &( verification_workers[ 0 ] ) );
+#endif
+	verification_handle->elapsed_time = verification_handle_get_time() - start_time;
+
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( verification_workers[ worker_index ].error != NULL )
+		{
+			if( result == 1 )
+			{
+				/* Hand over the error of the first failed worker
+				 */
+				if( ( error != NULL )
+				 && ( *error == NULL ) )
+				{
+					*error = verification_workers[ worker_index ].error;
+
+					verification_workers[ worker_index ].error = NULL;
+				}
+				result = -1;
+			}
+			if( verification_workers[ worker_index ].error != NULL )
+			{
+				libcerror_error_free(
+				 &( verification_workers[ worker_index ].error ) );
+			}
+		}
+		verification_handle->results.number_of_valid_pages     += verification_workers[ worker_index ].results.number_of_valid_pages;
+		verification_handle->results.number_of_corrupted_pages += verification_workers[ worker_index ].results.number_of_corrupted_pages;
+
+		for( page_type = 0;
+		     page_type < VERIFICATION_HANDLE_NUMBER_OF_PAGE_TYPES;
+		     page_type++ )
+		{
+			verification_handle->results.number_of_pages_per_type[ page_type ] += verification_workers[ worker_index ].results.number_of_pages_per_type[ page_type ];
+		}
+	}
+	memory_free(
+	 verification_workers );
+
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( threads != NULL )
+	{
+		memory_free(
+		 threads );
+	}
+#endif
+	if( verification_workers != NULL )
+	{
+		memory_free(
+		 verification_workers );
+	}
+	return( -1 );
+}
+
+/* Prints the verification results to a stream
+ * Returns 1 if successful or -1 on error
+ */
+int verification_handle_results_fprint(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "verification_handle_results_fprint";
+	double data_size      = 0.0;
+
+	if( verification_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid verification handle.",
+		 function );
+
+		return( -1 );
+	}
+	data_size = (double) verification_handle->number_of_pages * verification_handle->page_size;
+
+	fprintf(
+	 verification_handle->notify_stream,
+	 "Extensible Storage Engine Database verification:\n" );
+
+	fprintf(
+	 verification_handle->notify_stream,
+	 "\tPage size:\t\t\t%" PRIu32 " bytes\n",
+	 verification_handle->page_size );
+
+	fprintf(
+	 verification_handle->notify_stream,
+	 "\tNumber of pages:\t\t%" PRIu32 "\n",
+	 verification_handle->number_of_pages );
+
+	fprintf(
+	 verification_handle->notify_stream,
+	 "\tNumber of valid pages:\t\t%" PRIu64 "\n",
+	 verification_handle->results.number_of_valid_pages );
+
+	fprintf(
+	 verification_handle->notify_stream,
+	 "\tNumber of corrupted pages:\t%" PRIu64 "\n",
+	 verification_handle->results.number_of_corrupted_pages );
+
+	fprintf(
+	 verification_handle->notify_stream,
+	 "\n" );
+
+	fprintf(
+	 verification_handle->notify_stream,
+	 "Valid pages by type:\n" );
+
+	fprintf(
+	 verification_handle->notify_stream,
+	 "\tRoot:\t\t\t\t%" PRIu64 "\n",
+	 verification_handle->results.number_of_pages_per_type[ VERIFICATION_HANDLE_PAGE_TYPE_ROOT ] );
+
+	fprintf(
+	 verification_handle->notify_stream,
+	 "\tLeaf:\t\t\t\t%" PRIu64 "\n",
+	 verification_handle->results.number_of_pages_per_type[ VERIFICATION_HANDLE_PAGE_TYPE_LEAF ] );
+
+	fprintf(
+	 verification_handle->notify_stream,
+	 "\tParent:\t\t\t\t%" PRIu64 "\n",
+	 verification_handle->results.number_of_pages_per_type[ VERIFICATION_HANDLE_PAGE_TYPE_PARENT ] );
+
+	fprintf(
+	 verification_handle->notify_stream,
+	 "\tEmpty:\t\t\t\t%" PRIu64 "\n",
+	 verification_handle->results.number_of_pages_per_type[ VERIFICATION_HANDLE_PAGE_TYPE_EMPTY ] );
+
+	fprintf(
+	 verification_handle->notify_stream,
+	 "\tSpace tree:\t\t\t%" PRIu64 "\n",
+	 verification_handle->results.number_of_pages_per_type[ VERIFICATION_HANDLE_PAGE_TYPE_SPACE_TREE ] );
+
+	fprintf(
+	 verification_handle->notify_stream,
+	 "\tIndex:\t\t\t\t%" PRIu64 "\n",
+	 verification_handle->results.number_of_pages_per_type[ VERIFICATION_HANDLE_PAGE_TYPE_INDEX ] );
+
+	fprintf(
+	 verification_handle->notify_stream,
+	 "\tLong value:\t\t\t%" PRIu64 "\n",
+	 verification_handle->results.number_of_pages_per_type[ VERIFICATION_HANDLE_PAGE_TYPE_LONG_VALUE ] );
+
+	fprintf(
+	 verification_handle->notify_stream,
+	 "\tScrubbed:\t\t\t%" PRIu64 "\n",
+	 verification_handle->results.number_of_pages_per_type[ VERIFICATION_HANDLE_PAGE_TYPE_SCRUBBED ] );
+
+	fprintf(
+	 verification_handle->notify_stream,
+	 "\tUninitialized:\t\t\t%" PRIu64 "\n",
+	 verification_handle->results.number_of_pages_per_type[ VERIFICATION_HANDLE_PAGE_TYPE_UNINITIALIZED ] );
+
+	fprintf(
+	 verification_handle->notify_stream,
+	 "\n" );
+
+	fprintf(
+	 verification_handle->notify_stream,
+	 "Verified %.1f MiB in %.3f seconds",
+	 data_size / ( 1024.0 * 1024.0 ),
+	 verification_handle->elapsed_time );
+
+	if( verification_handle->elapsed_time > 0.0 )
+	{
+		fprintf(
+		 verification_handle->notify_stream,
+		 " with %d thread(s) (%.1f MB/s)",
+		 verification_handle->number_of_workers,
+		 data_size / ( verification_handle->elapsed_time * 1000000.0 ) );
+	}
+	fprintf(
+	 verification_handle->notify_stream,
+	 ".\n\n" );
+
+	return( 1 );
+}
+
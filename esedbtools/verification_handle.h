@@ -0,0 +1,186 @@
+/*
+ * Verification handle
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _VERIFICATION_HANDLE_H )
+#define _VERIFICATION_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libesedb.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define VERIFICATION_HANDLE_MAXIMUM_NUMBER_OF_THREADS	64
+
+enum VERIFICATION_HANDLE_PAGE_TYPES
+{
+	VERIFICATION_HANDLE_PAGE_TYPE_ROOT,
+	VERIFICATION_HANDLE_PAGE_TYPE_LEAF,
+	VERIFICATION_HANDLE_PAGE_TYPE_PARENT,
+	VERIFICATION_HANDLE_PAGE_TYPE_EMPTY,
+	VERIFICATION_HANDLE_PAGE_TYPE_SPACE_TREE,
+	VERIFICATION_HANDLE_PAGE_TYPE_INDEX,
+	VERIFICATION_HANDLE_PAGE_TYPE_LONG_VALUE,
+	VERIFICATION_HANDLE_PAGE_TYPE_SCRUBBED,
+	VERIFICATION_HANDLE_PAGE_TYPE_UNINITIALIZED,
+
+	VERIFICATION_HANDLE_NUMBER_OF_PAGE_TYPES
+};
+
+typedef struct verification_results verification_results_t;
+
+struct verification_results
+{
+	/* The number of valid pages
+	 */
+	uint64_t number_of_valid_pages;
+
+	/* The number of corrupted pages
+	 */
+	uint64_t number_of_corrupted_pages;
+
+	/* The number of pages per page type
+	 */
+	uint64_t number_of_pages_per_type[ VERIFICATION_HANDLE_NUMBER_OF_PAGE_TYPES ];
+};
+
+typedef struct verification_handle verification_handle_t;
+
+typedef struct verification_worker verification_worker_t;
+
+struct verification_worker
+{
+	/* The verification handle
+	 */
+	verification_handle_t *verification_handle;
+
+	/* The first page number
+	 */
+	uint32_t first_page_number;
+
+	/* The last page number
+	 */
+	uint32_t last_page_number;
+
+	/* The results
+	 */
+	verification_results_t results;
+
+	/* The error
+	 */
+	libcerror_error_t *error;
+};
+
+struct verification_handle
+{
+	/* The libesedb input file
+	 */
+	libesedb_file_t *input_file;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The number of worker threads used by the last verification
+	 */
+	int number_of_workers;
+
+	/* The page size
+	 */
+	uint32_t page_size;
+
+	/* The number of pages
+	 */
+	uint32_t number_of_pages;
+
+	/* The results
+	 */
+	verification_results_t results;
+
+	/* The number of seconds the verification took
+	 */
+	double elapsed_time;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+double verification_handle_get_time(
+        void );
+
+int verification_handle_initialize(
+     verification_handle_t **verification_handle,
+     libcerror_error_t **error );
+
+int verification_handle_free(
+     verification_handle_t **verification_handle,
+     libcerror_error_t **error );
+
+int verification_handle_signal_abort(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error );
+
+int verification_handle_set_number_of_threads(
+     verification_handle_t *verification_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int verification_handle_open(
+     verification_handle_t *verification_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int verification_handle_close(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error );
+
+int verification_handle_verify_pages(
+     verification_worker_t *verification_worker );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+int verification_handle_worker_thread_start(
+     void *arguments );
+#endif
+
+int verification_handle_verify(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error );
+
+int verification_handle_results_fprint(
+     verification_handle_t *verification_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _VERIFICATION_HANDLE_H ) */
+
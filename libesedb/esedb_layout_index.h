@@ -0,0 +1,123 @@
+/*
+ * The layout index file definition of libesedb
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ESEDB_LAYOUT_INDEX_H )
+#define _ESEDB_LAYOUT_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct esedb_layout_index_file_header esedb_layout_index_file_header_t;
+
+struct esedb_layout_index_file_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains: "ESEDBLIX"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The page size of the database file
+	 * Consists of 4 bytes
+	 */
+	uint8_t page_size[ 4 ];
+
+	/* The last page number of the database file
+	 * Consists of 4 bytes
+	 */
+	uint8_t last_page_number[ 4 ];
+
+	/* The database time of the database file header
+	 * Consists of 8 bytes
+	 */
+	uint8_t database_time[ 8 ];
+
+	/* The database signature of the database file header
+	 * Consists of 28 bytes
+	 */
+	uint8_t database_signature[ 28 ];
+
+	/* The number of entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_entries[ 4 ];
+
+	/* The XOR-32 checksum
+	 * A XOR-32 checksum calculated over the bytes
+	 * that follow the file header
+	 * with an initial value of 0x89abcdef
+	 *
+	 * Consists of 4 bytes
+	 */
+	uint8_t checksum[ 4 ];
+};
+
+typedef struct esedb_layout_index_entry_header esedb_layout_index_entry_header_t;
+
+struct esedb_layout_index_entry_header
+{
+	/* The entry type
+	 * Consists of 4 bytes
+	 */
+	uint8_t type[ 4 ];
+
+	/* The identifier
+	 * Consists of 4 bytes
+	 * Contains the root page number of a page tree entry
+	 */
+	uint8_t identifier[ 4 ];
+
+	/* The entry data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t data_size[ 4 ];
+};
+
+typedef struct esedb_layout_index_leaf_page esedb_layout_index_leaf_page_t;
+
+struct esedb_layout_index_leaf_page
+{
+	/* The page number
+	 * Consists of 4 bytes
+	 */
+	uint8_t page_number[ 4 ];
+
+	/* The number of (non-defunct) leaf values
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_leaf_values[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ESEDB_LAYOUT_INDEX_H ) */
+
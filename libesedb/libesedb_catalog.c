@@ -34,6 +34,7 @@
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_libuna.h"
+#include "libesedb_page.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_table_definition.h"
 
@@ -829,6 +830,268 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
 	return( 0 );
 }
 
+/* Reads a catalog definition from the definition data and adds it to the catalog
+ * Column, index, long value and callback catalog definitions are added to the table definition,
+ * which contains the last table definition that was read
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_read_definition_data(
+     libesedb_catalog_t *catalog,
+     uint8_t *definition_data,
+     size_t definition_data_size,
+     int ascii_codepage,
+     libesedb_table_definition_t **table_definition,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *catalog_definition  = NULL;
+	libesedb_table_definition_t *safe_table_definition = NULL;
+	static char *function                              = "libesedb_catalog_read_definition_data";
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	safe_table_definition = *table_definition;
+
+	if( libesedb_catalog_definition_initialize(
+	     &catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create catalog definition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_catalog_definition_read(
+	     catalog_definition,
+	     definition_data,
+	     definition_data_size,
+	     ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read catalog definition.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( catalog_definition->type != LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE )
+	 && ( safe_table_definition == NULL ) )
+	{
+		/* TODO add build-in table 1 support
+		 */
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: missing table definition for catalog definition type: %" PRIu16 ".\n",
+			 function,
+			 catalog_definition->type );
+		}
+#endif
+		if( libesedb_catalog_definition_free(
+		     &catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free catalog definition.",
+			 function );
+
+			goto on_error;
+		}
+		catalog_definition = NULL;
+	}
+	else switch( catalog_definition->type )
+	{
+		case LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE:
+			safe_table_definition = NULL;
+
+			if( libesedb_table_definition_initialize(
+			     &safe_table_definition,
+			     catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create table definition.",
+				 function );
+
+				libesedb_table_definition_free(
+				 &safe_table_definition,
+				 NULL );
+
+				goto on_error;
+			}
+			catalog_definition = NULL;
+
+			if( libcdata_list_append_value(
+			     catalog->table_definition_list,
+			     (intptr_t *) safe_table_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append table definition to table definition list.",
+				 function );
+
+				libesedb_table_definition_free(
+				 &safe_table_definition,
+				 NULL );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN:
+			if( libesedb_table_definition_append_column_catalog_definition(
+			     safe_table_definition,
+			     catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append column catalog definition to table definition.",
+				 function );
+
+				goto on_error;
+			}
+			catalog_definition = NULL;
+
+			break;
+
+		case LIBESEDB_CATALOG_DEFINITION_TYPE_INDEX:
+			if( libesedb_table_definition_append_index_catalog_definition(
+			     safe_table_definition,
+			     catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append index catalog definition to table definition.",
+				 function );
+
+				goto on_error;
+			}
+			catalog_definition = NULL;
+
+			break;
+
+		case LIBESEDB_CATALOG_DEFINITION_TYPE_LONG_VALUE:
+			if( libesedb_table_definition_set_long_value_catalog_definition(
+			     safe_table_definition,
+			     catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set long value catalog definition in table definition.",
+				 function );
+
+				goto on_error;
+			}
+			catalog_definition = NULL;
+
+			break;
+
+		case LIBESEDB_CATALOG_DEFINITION_TYPE_CALLBACK:
+			if( libesedb_table_definition_set_callback_catalog_definition(
+			     safe_table_definition,
+			     catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set callback catalog definition in table definition.",
+				 function );
+
+				goto on_error;
+			}
+			catalog_definition = NULL;
+
+			break;
+
+		default:
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unsupported catalog definition type: %" PRIu16 ".\n",
+				 function,
+				 catalog_definition->type );
+			}
+#endif
+			if( libesedb_catalog_definition_free(
+			     &catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free catalog definition.",
+				 function );
+
+				goto on_error;
+			}
+			catalog_definition = NULL;
+
+			break;
+	}
+
+	*table_definition = safe_table_definition;
+
+	return( 1 );
+
+on_error:
+	if( catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &catalog_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Reads the catalog
  * Returns 1 if successful or -1 on error
  */
@@ -837,22 +1100,20 @@ int libesedb_catalog_read(
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
      uint32_t page_number,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
      libcerror_error_t **error )
 {
-	libesedb_catalog_definition_t *catalog_definition = NULL;
-	libesedb_data_definition_t *data_definition       = NULL;
-	libesedb_page_tree_t *catalog_page_tree           = NULL;
-	libesedb_table_definition_t *table_definition     = NULL;
-	libfcache_cache_t *catalog_values_cache           = NULL;
-	libfdata_btree_t *catalog_values_tree             = NULL;
-	uint8_t *catalog_definition_data                  = NULL;
-	static char *function                             = "libesedb_catalog_read";
-	off64_t node_data_offset                          = 0;
-	size_t catalog_definition_data_size               = 0;
-	int leaf_value_index                              = 0;
-	int number_of_leaf_values                         = 0;
+	libesedb_data_definition_t *data_definition   = NULL;
+	libesedb_page_t *catalog_definition_page      = NULL;
+	libesedb_page_tree_t *catalog_page_tree       = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	libfcache_cache_t *catalog_values_cache       = NULL;
+	libfdata_btree_t *catalog_values_tree         = NULL;
+	uint8_t *catalog_definition_data              = NULL;
+	static char *function                         = "libesedb_catalog_read";
+	off64_t node_data_offset                      = 0;
+	size_t catalog_definition_data_size           = 0;
+	int leaf_value_index                          = 0;
+	int number_of_leaf_values                     = 0;
 
 	if( catalog == NULL )
 	{
@@ -890,8 +1151,6 @@ int libesedb_catalog_read(
 	if( libesedb_page_tree_initialize(
 	     &catalog_page_tree,
 	     io_handle,
-	     pages_vector,
-	     pages_cache,
 	     LIBESEDB_FDP_OBJECT_IDENTIFIER_CATALOG,
 	     NULL,
 	     NULL,
@@ -1006,8 +1265,7 @@ int libesedb_catalog_read(
 		     data_definition,
 		     file_io_handle,
 		     io_handle,
-		     pages_vector,
-		     pages_cache,
+		     &catalog_definition_page,
 		     &catalog_definition_data,
 		     &catalog_definition_data_size,
 		     error ) != 1 )
@@ -1021,211 +1279,37 @@ int libesedb_catalog_read(
 
 			goto on_error;
 		}
-		if( libesedb_catalog_definition_initialize(
-		     &catalog_definition,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create catalog definition.",
-			 function );
-
-			goto on_error;
-		}
-		if( libesedb_catalog_definition_read(
-		     catalog_definition,
+		if( libesedb_catalog_read_definition_data(
+		     catalog,
 		     catalog_definition_data,
 		     catalog_definition_data_size,
 		     io_handle->ascii_codepage,
+		     &table_definition,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read catalog definition.",
-			 function );
+			 "%s: unable to read catalog definition: %d.",
+			 function,
+			 leaf_value_index );
 
 			goto on_error;
 		}
-		if( ( catalog_definition->type != LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE )
-		 && ( table_definition == NULL ) )
+		if( libesedb_page_release(
+		     io_handle,
+		     &catalog_definition_page,
+		     error ) != 1 )
 		{
-			/* TODO add build-in table 1 support
-			 */
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: missing table definition for catalog definition type: %" PRIu16 ".\n",
-				 function,
-				 catalog_definition->type );
-			}
-#endif
-			if( libesedb_catalog_definition_free(
-			     &catalog_definition,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free catalog definition.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release catalog definition page.",
+			 function );
 
-				goto on_error;
-			}
-			catalog_definition = NULL;
-		}
-		else switch( catalog_definition->type )
-		{
-			case LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE:
-				table_definition = NULL;
-
-				if( libesedb_table_definition_initialize(
-				     &table_definition,
-				     catalog_definition,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create table definition.",
-					 function );
-
-					libesedb_table_definition_free(
-					 &table_definition,
-					 NULL );
-
-					goto on_error;
-				}
-				catalog_definition = NULL;
-
-				if( libcdata_list_append_value(
-				     catalog->table_definition_list,
-				     (intptr_t *) table_definition,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append table definition to table definition list.",
-					 function );
-
-					libesedb_table_definition_free(
-					 &table_definition,
-					 NULL );
-
-					goto on_error;
-				}
-				break;
-
-			case LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN:
-				if( libesedb_table_definition_append_column_catalog_definition(
-				     table_definition,
-				     catalog_definition,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append column catalog definition to table definition.",
-					 function );
-
-					goto on_error;
-				}
-				catalog_definition = NULL;
-
-				break;
-
-			case LIBESEDB_CATALOG_DEFINITION_TYPE_INDEX:
-				if( libesedb_table_definition_append_index_catalog_definition(
-				     table_definition,
-				     catalog_definition,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append index catalog definition to table definition.",
-					 function );
-
-					goto on_error;
-				}
-				catalog_definition = NULL;
-
-				break;
-
-			case LIBESEDB_CATALOG_DEFINITION_TYPE_LONG_VALUE:
-				if( libesedb_table_definition_set_long_value_catalog_definition(
-				     table_definition,
-				     catalog_definition,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set long value catalog definition in table definition.",
-					 function );
-
-					goto on_error;
-				}
-				catalog_definition = NULL;
-
-				break;
-
-			case LIBESEDB_CATALOG_DEFINITION_TYPE_CALLBACK:
-				if( libesedb_table_definition_set_callback_catalog_definition(
-				     table_definition,
-				     catalog_definition,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set callback catalog definition in table definition.",
-					 function );
-
-					goto on_error;
-				}
-				catalog_definition = NULL;
-
-				break;
-
-			default:
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: unsupported catalog definition type: %" PRIu16 ".\n",
-					 function,
-					 catalog_definition->type );
-				}
-#endif
-				if( libesedb_catalog_definition_free(
-				     &catalog_definition,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free catalog definition.",
-					 function );
-
-					goto on_error;
-				}
-				catalog_definition = NULL;
-
-				break;
+			goto on_error;
 		}
 	}
 	if( libfcache_cache_free(
@@ -1257,10 +1341,11 @@ int libesedb_catalog_read(
 	return( 1 );
 
 on_error:
-	if( catalog_definition != NULL )
+	if( catalog_definition_page != NULL )
 	{
-		libesedb_catalog_definition_free(
-		 &catalog_definition,
+		libesedb_page_release(
+		 io_handle,
+		 &catalog_definition_page,
 		 NULL );
 	}
 	if( catalog_values_cache != NULL )
@@ -1284,3 +1369,284 @@ on_error:
 	return( -1 );
 }
 
+/* Reads the catalog from the (catalog) definitions stored in a layout index
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_read_layout_index(
+     libesedb_catalog_t *catalog,
+     libesedb_layout_index_t *layout_index,
+     uint32_t definition_type,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libesedb_layout_index_definition_t *definition = NULL;
+	libesedb_table_definition_t *table_definition  = NULL;
+	static char *function                          = "libesedb_catalog_read_layout_index";
+	int definition_index                           = 0;
+	int number_of_definitions                      = 0;
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_layout_index_get_number_of_definitions(
+	     layout_index,
+	     &number_of_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of definitions from layout index.",
+		 function );
+
+		return( -1 );
+	}
+	for( definition_index = 0;
+	     definition_index < number_of_definitions;
+	     definition_index++ )
+	{
+		if( libesedb_layout_index_get_definition_by_index(
+		     layout_index,
+		     definition_index,
+		     &definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve definition: %d from layout index.",
+			 function,
+			 definition_index );
+
+			return( -1 );
+		}
+		if( definition == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing definition: %d.",
+			 function,
+			 definition_index );
+
+			return( -1 );
+		}
+		if( definition->type != definition_type )
+		{
+			continue;
+		}
+		if( libesedb_catalog_read_definition_data(
+		     catalog,
+		     definition->data,
+		     definition->data_size,
+		     ascii_codepage,
+		     &table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read catalog definition: %d.",
+			 function,
+			 definition_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+
+/* Appends the page trees of the table definitions in the catalog to a layout index
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_append_layout_index_trees(
+     libesedb_catalog_t *catalog,
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_layout_index_t *layout_index,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *index_catalog_definition = NULL;
+	libesedb_table_definition_t *table_definition           = NULL;
+	static char *function                                   = "libesedb_catalog_append_layout_index_trees";
+	int index_catalog_definition_index                      = 0;
+	int number_of_index_catalog_definitions                 = 0;
+	int number_of_table_definitions                         = 0;
+	int table_definition_index                              = 0;
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_list_get_number_of_elements(
+	     catalog->table_definition_list,
+	     &number_of_table_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of table definitions.",
+		 function );
+
+		return( -1 );
+	}
+	for( table_definition_index = 0;
+	     table_definition_index < number_of_table_definitions;
+	     table_definition_index++ )
+	{
+		if( libcdata_list_get_value_by_index(
+		     catalog->table_definition_list,
+		     table_definition_index,
+		     (intptr_t **) &table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table definition: %d.",
+			 function,
+			 table_definition_index );
+
+			return( -1 );
+		}
+		if( ( table_definition == NULL )
+		 || ( table_definition->table_catalog_definition == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing table definition: %d.",
+			 function,
+			 table_definition_index );
+
+			return( -1 );
+		}
+		if( libesedb_page_tree_append_layout_index_tree(
+		     page_tree,
+		     file_io_handle,
+		     table_definition->table_catalog_definition->father_data_page_number,
+		     layout_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append table: %d page tree to layout index.",
+			 function,
+			 table_definition_index );
+
+			return( -1 );
+		}
+		if( table_definition->long_value_catalog_definition != NULL )
+		{
+			if( libesedb_page_tree_append_layout_index_tree(
+			     page_tree,
+			     file_io_handle,
+			     table_definition->long_value_catalog_definition->father_data_page_number,
+			     layout_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append table: %d long values page tree to layout index.",
+				 function,
+				 table_definition_index );
+
+				return( -1 );
+			}
+		}
+		if( libcdata_list_get_number_of_elements(
+		     table_definition->index_catalog_definition_list,
+		     &number_of_index_catalog_definitions,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of index catalog definitions.",
+			 function );
+
+			return( -1 );
+		}
+		for( index_catalog_definition_index = 0;
+		     index_catalog_definition_index < number_of_index_catalog_definitions;
+		     index_catalog_definition_index++ )
+		{
+			if( libcdata_list_get_value_by_index(
+			     table_definition->index_catalog_definition_list,
+			     index_catalog_definition_index,
+			     (intptr_t **) &index_catalog_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve index catalog definition: %d.",
+				 function,
+				 index_catalog_definition_index );
+
+				return( -1 );
+			}
+			if( index_catalog_definition == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing index catalog definition: %d.",
+				 function,
+				 index_catalog_definition_index );
+
+				return( -1 );
+			}
+			if( libesedb_page_tree_append_layout_index_tree(
+			     page_tree,
+			     file_io_handle,
+			     index_catalog_definition->father_data_page_number,
+			     layout_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append index: %d page tree to layout index.",
+				 function,
+				 index_catalog_definition_index );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
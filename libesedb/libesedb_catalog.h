@@ -26,11 +26,13 @@
 #include <types.h>
 
 #include "libesedb_io_handle.h"
+#include "libesedb_layout_index.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_page_tree.h"
 #include "libesedb_table_definition.h"
 
 #if defined( __cplusplus )
@@ -86,13 +88,33 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
      libesedb_table_definition_t **table_definition,
      libcerror_error_t **error );
 
+int libesedb_catalog_read_definition_data(
+     libesedb_catalog_t *catalog,
+     uint8_t *definition_data,
+     size_t definition_data_size,
+     int ascii_codepage,
+     libesedb_table_definition_t **table_definition,
+     libcerror_error_t **error );
+
 int libesedb_catalog_read(
      libesedb_catalog_t *catalog,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
      uint32_t page_number,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libcerror_error_t **error );
+
+int libesedb_catalog_read_layout_index(
+     libesedb_catalog_t *catalog,
+     libesedb_layout_index_t *layout_index,
+     uint32_t definition_type,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int libesedb_catalog_append_layout_index_trees(
+     libesedb_catalog_t *catalog,
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_layout_index_t *layout_index,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
@@ -26,6 +26,14 @@
 #include "libesedb_checksum.h"
 #include "libesedb_libcerror.h"
 
+#if defined( HAVE_LIBESEDB_CHECKSUM_SSE2 )
+#include <emmintrin.h>
+#endif
+
+#if defined( HAVE_LIBESEDB_CHECKSUM_AVX2 )
+#include <immintrin.h>
+#endif
+
 /* The largest primary (or scalar) available
  * supported by a single load and store instruction
  */
@@ -52,6 +60,371 @@ const uint8_t libesedb_checksum_ecc32_include_lookup_table[ 256 ] = {
 	0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0
 };
 
+#if defined( HAVE_LIBESEDB_CHECKSUM_AVX2 )
+
+/* Value to indicate the CPU supports AVX2, -1 if not determined yet
+ */
+static int libesedb_checksum_cpu_supports_avx2 = -1;
+
+/* Determines if the CPU supports AVX2
+ * Returns 1 if supported or 0 if not
+ */
+int libesedb_checksum_get_cpu_supports_avx2(
+     void )
+{
+	if( libesedb_checksum_cpu_supports_avx2 == -1 )
+	{
+		if( __builtin_cpu_supports( "avx2" ) )
+		{
+			libesedb_checksum_cpu_supports_avx2 = 1;
+		}
+		else
+		{
+			libesedb_checksum_cpu_supports_avx2 = 0;
+		}
+	}
+	return( libesedb_checksum_cpu_supports_avx2 );
+}
+
+#endif /* defined( HAVE_LIBESEDB_CHECKSUM_AVX2 ) */
+
+/* Calculates the little-endian ECC-32 of 16-byte rows
+ * Every row with an odd parity contributes the row bitmask to the ECC-32,
+ * the 32-bit values of the rows are combined into 4 vertical XOR-32 values
+ */
+void libesedb_checksum_calculate_little_endian_ecc32_rows(
+      const uint8_t *buffer,
+      size_t number_of_rows,
+      uint32_t *bitmask,
+      uint32_t *ecc_checksum_value,
+      uint32_t *xor32_vertical_values )
+{
+	uint32_t value_32bit = 0;
+	uint32_t xor32_value = 0;
+
+	while( number_of_rows > 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( buffer[ 0 ] ),
+		 value_32bit );
+
+		xor32_vertical_values[ 0 ] ^= value_32bit;
+		xor32_value                 = value_32bit;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( buffer[ 4 ] ),
+		 value_32bit );
+
+		xor32_vertical_values[ 1 ] ^= value_32bit;
+		xor32_value                ^= value_32bit;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( buffer[ 8 ] ),
+		 value_32bit );
+
+		xor32_vertical_values[ 2 ] ^= value_32bit;
+		xor32_value                ^= value_32bit;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( buffer[ 12 ] ),
+		 value_32bit );
+
+		xor32_vertical_values[ 3 ] ^= value_32bit;
+		xor32_value                ^= value_32bit;
+
+		xor32_value ^= xor32_value >> 16;
+		xor32_value ^= xor32_value >> 8;
+
+		if( libesedb_checksum_ecc32_include_lookup_table[ xor32_value & 0xff ] != 0 )
+		{
+			*ecc_checksum_value ^= *bitmask;
+		}
+		*bitmask -= 0x007fff80UL;
+
+		buffer         += 16;
+		number_of_rows -= 1;
+	}
+}
+
+#if defined( HAVE_LIBESEDB_CHECKSUM_SSE2 )
+
+/* Calculates the little-endian ECC-32 of 16-byte rows using SSE2
+ * The parity of 4 rows is determined at once by transposing the rows
+ */
+void libesedb_checksum_calculate_little_endian_ecc32_rows_sse2(
+      const uint8_t *buffer,
+      size_t number_of_rows,
+      uint32_t *bitmask,
+      uint32_t *ecc_checksum_value,
+      uint32_t *xor32_vertical_values )
+{
+	__m128i row0           = _mm_setzero_si128();
+	__m128i row1           = _mm_setzero_si128();
+	__m128i row2           = _mm_setzero_si128();
+	__m128i row3           = _mm_setzero_si128();
+	__m128i rows01         = _mm_setzero_si128();
+	__m128i rows23         = _mm_setzero_si128();
+	__m128i vertical       = _mm_setzero_si128();
+	uint32_t row_bitmask   = 0;
+	int parity_bits        = 0;
+	int row_index          = 0;
+
+	vertical = _mm_loadu_si128(
+	            (const __m128i *) xor32_vertical_values );
+
+	while( number_of_rows >= 4 )
+	{
+		row0 = _mm_loadu_si128(
+		        (const __m128i *) &( buffer[ 0 ] ) );
+		row1 = _mm_loadu_si128(
+		        (const __m128i *) &( buffer[ 16 ] ) );
+		row2 = _mm_loadu_si128(
+		        (const __m128i *) &( buffer[ 32 ] ) );
+		row3 = _mm_loadu_si128(
+		        (const __m128i *) &( buffer[ 48 ] ) );
+
+		vertical = _mm_xor_si128(
+		            vertical,
+		            _mm_xor_si128(
+		             _mm_xor_si128( row0, row1 ),
+		             _mm_xor_si128( row2, row3 ) ) );
+
+		/* Transpose the rows and combine the 32-bit values of every row
+		 */
+		rows01 = _mm_xor_si128(
+		          _mm_unpacklo_epi32( row0, row1 ),
+		          _mm_unpackhi_epi32( row0, row1 ) );
+		rows23 = _mm_xor_si128(
+		          _mm_unpacklo_epi32( row2, row3 ),
+		          _mm_unpackhi_epi32( row2, row3 ) );
+		row0   = _mm_xor_si128(
+		          _mm_unpacklo_epi64( rows01, rows23 ),
+		          _mm_unpackhi_epi64( rows01, rows23 ) );
+
+		/* Determine the parity of every row
+		 */
+		row0 = _mm_xor_si128( row0, _mm_srli_epi32( row0, 16 ) );
+		row0 = _mm_xor_si128( row0, _mm_srli_epi32( row0, 8 ) );
+		row0 = _mm_xor_si128( row0, _mm_srli_epi32( row0, 4 ) );
+		row0 = _mm_xor_si128( row0, _mm_srli_epi32( row0, 2 ) );
+		row0 = _mm_xor_si128( row0, _mm_srli_epi32( row0, 1 ) );
+
+		parity_bits = _mm_movemask_ps(
+		               _mm_castsi128_ps(
+		                _mm_slli_epi32( row0, 31 ) ) );
+
+		row_bitmask = *bitmask;
+
+		for( row_index = 0;
+		     row_index < 4;
+		     row_index++ )
+		{
+			if( ( parity_bits & ( 1 << row_index ) ) != 0 )
+			{
+				*ecc_checksum_value ^= row_bitmask;
+			}
+			row_bitmask -= 0x007fff80UL;
+		}
+		*bitmask = row_bitmask;
+
+		buffer         += 64;
+		number_of_rows -= 4;
+	}
+	_mm_storeu_si128(
+	 (__m128i *) xor32_vertical_values,
+	 vertical );
+
+	libesedb_checksum_calculate_little_endian_ecc32_rows(
+	 buffer,
+	 number_of_rows,
+	 bitmask,
+	 ecc_checksum_value,
+	 xor32_vertical_values );
+}
+
+#endif /* defined( HAVE_LIBESEDB_CHECKSUM_SSE2 ) */
+
+#if defined( HAVE_LIBESEDB_CHECKSUM_AVX2 )
+
+/* Calculates the little-endian ECC-32 of 16-byte rows using AVX2
+ * The parity of 8 rows is determined at once, the lower 128-bit lane
+ * contains the even and the upper lane the odd rows
+ */
+__attribute__((target("avx2")))
+void libesedb_checksum_calculate_little_endian_ecc32_rows_avx2(
+      const uint8_t *buffer,
+      size_t number_of_rows,
+      uint32_t *bitmask,
+      uint32_t *ecc_checksum_value,
+      uint32_t *xor32_vertical_values )
+{
+	__m256i rows01       = _mm256_setzero_si256();
+	__m256i rows23       = _mm256_setzero_si256();
+	__m256i rows45       = _mm256_setzero_si256();
+	__m256i rows67       = _mm256_setzero_si256();
+	__m256i transposed01 = _mm256_setzero_si256();
+	__m256i transposed23 = _mm256_setzero_si256();
+	__m256i vertical     = _mm256_setzero_si256();
+	__m128i vertical128  = _mm_setzero_si128();
+	uint32_t row_bitmask = 0;
+	int parity_bits      = 0;
+	int row_index        = 0;
+
+	while( number_of_rows >= 8 )
+	{
+		rows01 = _mm256_loadu_si256(
+		          (const __m256i *) &( buffer[ 0 ] ) );
+		rows23 = _mm256_loadu_si256(
+		          (const __m256i *) &( buffer[ 32 ] ) );
+		rows45 = _mm256_loadu_si256(
+		          (const __m256i *) &( buffer[ 64 ] ) );
+		rows67 = _mm256_loadu_si256(
+		          (const __m256i *) &( buffer[ 96 ] ) );
+
+		vertical = _mm256_xor_si256(
+		            vertical,
+		            _mm256_xor_si256(
+		             _mm256_xor_si256( rows01, rows23 ),
+		             _mm256_xor_si256( rows45, rows67 ) ) );
+
+		/* Transpose the rows per lane and combine the 32-bit values of every row
+		 */
+		transposed01 = _mm256_xor_si256(
+		                _mm256_unpacklo_epi32( rows01, rows23 ),
+		                _mm256_unpackhi_epi32( rows01, rows23 ) );
+		transposed23 = _mm256_xor_si256(
+		                _mm256_unpacklo_epi32( rows45, rows67 ),
+		                _mm256_unpackhi_epi32( rows45, rows67 ) );
+		rows01       = _mm256_xor_si256(
+		                _mm256_unpacklo_epi64( transposed01, transposed23 ),
+		                _mm256_unpackhi_epi64( transposed01, transposed23 ) );
+
+		/* Determine the parity of every row
+		 */
+		rows01 = _mm256_xor_si256( rows01, _mm256_srli_epi32( rows01, 16 ) );
+		rows01 = _mm256_xor_si256( rows01, _mm256_srli_epi32( rows01, 8 ) );
+		rows01 = _mm256_xor_si256( rows01, _mm256_srli_epi32( rows01, 4 ) );
+		rows01 = _mm256_xor_si256( rows01, _mm256_srli_epi32( rows01, 2 ) );
+		rows01 = _mm256_xor_si256( rows01, _mm256_srli_epi32( rows01, 1 ) );
+
+		parity_bits = _mm256_movemask_ps(
+		               _mm256_castsi256_ps(
+		                _mm256_slli_epi32( rows01, 31 ) ) );
+
+		for( row_index = 0;
+		     row_index < 4;
+		     row_index++ )
+		{
+			row_bitmask = *bitmask - ( (uint32_t) ( 2 * row_index ) * 0x007fff80UL );
+
+			if( ( parity_bits & ( 1 << row_index ) ) != 0 )
+			{
+				*ecc_checksum_value ^= row_bitmask;
+			}
+			if( ( parity_bits & ( 1 << ( row_index + 4 ) ) ) != 0 )
+			{
+				*ecc_checksum_value ^= row_bitmask - 0x007fff80UL;
+			}
+		}
+		*bitmask -= 8 * 0x007fff80UL;
+
+		buffer         += 128;
+		number_of_rows -= 8;
+	}
+	vertical128 = _mm_xor_si128(
+	               _mm256_castsi256_si128( vertical ),
+	               _mm256_extracti128_si256( vertical, 1 ) );
+
+	vertical128 = _mm_xor_si128(
+	               vertical128,
+	               _mm_loadu_si128(
+	                (const __m128i *) xor32_vertical_values ) );
+
+	_mm_storeu_si128(
+	 (__m128i *) xor32_vertical_values,
+	 vertical128 );
+
+	libesedb_checksum_calculate_little_endian_ecc32_rows_sse2(
+	 buffer,
+	 number_of_rows,
+	 bitmask,
+	 ecc_checksum_value,
+	 xor32_vertical_values );
+}
+
+#endif /* defined( HAVE_LIBESEDB_CHECKSUM_AVX2 ) */
+
+#if defined( HAVE_LIBESEDB_CHECKSUM_SSE2 )
+
+/* Calculates the little-endian XOR-32 of 16-byte blocks using SSE2
+ * Returns the XOR-32 of the blocks
+ */
+uint32_t libesedb_checksum_calculate_little_endian_xor32_blocks_sse2(
+          const uint8_t *buffer,
+          size_t number_of_blocks )
+{
+	__m128i xor128_value = _mm_setzero_si128();
+
+	while( number_of_blocks > 0 )
+	{
+		xor128_value = _mm_xor_si128(
+		                xor128_value,
+		                _mm_loadu_si128(
+		                 (const __m128i *) buffer ) );
+
+		buffer           += 16;
+		number_of_blocks -= 1;
+	}
+	xor128_value = _mm_xor_si128( xor128_value, _mm_srli_si128( xor128_value, 8 ) );
+	xor128_value = _mm_xor_si128( xor128_value, _mm_srli_si128( xor128_value, 4 ) );
+
+	return( (uint32_t) _mm_cvtsi128_si32( xor128_value ) );
+}
+
+#endif /* defined( HAVE_LIBESEDB_CHECKSUM_SSE2 ) */
+
+#if defined( HAVE_LIBESEDB_CHECKSUM_AVX2 )
+
+/* Calculates the little-endian XOR-32 of 16-byte blocks using AVX2
+ * Returns the XOR-32 of the blocks
+ */
+__attribute__((target("avx2")))
+uint32_t libesedb_checksum_calculate_little_endian_xor32_blocks_avx2(
+          const uint8_t *buffer,
+          size_t number_of_blocks )
+{
+	__m256i xor256_value = _mm256_setzero_si256();
+	__m128i xor128_value = _mm_setzero_si128();
+
+	while( number_of_blocks >= 2 )
+	{
+		xor256_value = _mm256_xor_si256(
+		                xor256_value,
+		                _mm256_loadu_si256(
+		                 (const __m256i *) buffer ) );
+
+		buffer           += 32;
+		number_of_blocks -= 2;
+	}
+	xor128_value = _mm_xor_si128(
+	                _mm256_castsi256_si128( xor256_value ),
+	                _mm256_extracti128_si256( xor256_value, 1 ) );
+
+	if( number_of_blocks > 0 )
+	{
+		xor128_value = _mm_xor_si128(
+		                xor128_value,
+		                _mm_loadu_si128(
+		                 (const __m128i *) buffer ) );
+	}
+	xor128_value = _mm_xor_si128( xor128_value, _mm_srli_si128( xor128_value, 8 ) );
+	xor128_value = _mm_xor_si128( xor128_value, _mm_srli_si128( xor128_value, 4 ) );
+
+	return( (uint32_t) _mm_cvtsi128_si32( xor128_value ) );
+}
+
+#endif /* defined( HAVE_LIBESEDB_CHECKSUM_AVX2 ) */
+
 /* Calculates the little-endian ECC-32 and XOR-32 of a buffer
  * It uses the initial value to calculate a new XOR-32
  * Returns 1 if successful or -1 on error
@@ -65,19 +438,22 @@ int libesedb_checksum_calculate_little_endian_ecc32(
      uint32_t initial_value,
      libcerror_error_t **error )
 {
-	static char *function          = "libesedb_checksum_calculate_little_endian_ecc32";
-	size_t buffer_iterator         = 0;
-	size_t buffer_alignment        = 0;
-	uint32_t bitmask               = 0;
-	uint32_t bit_iterator          = 0;
-	uint32_t final_bitmask         = 0;
-	uint32_t value_32bit           = 0;
-	uint32_t xor32_value           = 0;
-	uint32_t xor32_vertical_first  = 0;
-	uint32_t xor32_vertical_second = 0;
-	uint32_t xor32_vertical_third  = 0;
-	uint32_t xor32_vertical_fourth = 0;
-	uint8_t mask_table_index       = 0;
+	uint32_t xor32_vertical_values[ 4 ] = { 0, 0, 0, 0 };
+
+	static char *function               = "libesedb_checksum_calculate_little_endian_ecc32";
+	size_t buffer_iterator              = 0;
+	size_t buffer_alignment             = 0;
+	size_t number_of_rows               = 0;
+	uint32_t bitmask                    = 0;
+	uint32_t bit_iterator               = 0;
+	uint32_t final_bitmask              = 0;
+	uint32_t value_32bit                = 0;
+	uint32_t xor32_value                = 0;
+	uint32_t xor32_vertical_first       = 0;
+	uint32_t xor32_vertical_second      = 0;
+	uint32_t xor32_vertical_third       = 0;
+	uint32_t xor32_vertical_fourth      = 0;
+	uint8_t mask_table_index            = 0;
 
 	if( ecc_checksum_value == NULL )
 	{
@@ -151,33 +527,59 @@ int libesedb_checksum_calculate_little_endian_ecc32(
 	*xor_checksum_value = initial_value;
 	bitmask             = 0xff800000UL;
 	buffer             += offset;
+	buffer_iterator     = offset;
 
-	for( buffer_iterator = offset;
-	     buffer_iterator < size;
-	     buffer_iterator += 4 )
+	while( buffer_iterator < size )
 	{
+		/* The 16-byte rows are processed by a row kernel, which uses
+		 * SIMD instructions if supported by the CPU
+		 */
+		if( ( buffer_alignment == 0 )
+		 && ( ( size - buffer_iterator ) >= 16 ) )
+		{
+			number_of_rows = ( size - buffer_iterator ) / 16;
+
+#if defined( HAVE_LIBESEDB_CHECKSUM_AVX2 )
+			if( libesedb_checksum_get_cpu_supports_avx2() != 0 )
+			{
+				libesedb_checksum_calculate_little_endian_ecc32_rows_avx2(
+				 buffer,
+				 number_of_rows,
+				 &bitmask,
+				 ecc_checksum_value,
+				 xor32_vertical_values );
+			}
+			else
+#endif
+#if defined( HAVE_LIBESEDB_CHECKSUM_SSE2 )
+			libesedb_checksum_calculate_little_endian_ecc32_rows_sse2(
+			 buffer,
+			 number_of_rows,
+			 &bitmask,
+			 ecc_checksum_value,
+			 xor32_vertical_values );
+#else
+			libesedb_checksum_calculate_little_endian_ecc32_rows(
+			 buffer,
+			 number_of_rows,
+			 &bitmask,
+			 ecc_checksum_value,
+			 xor32_vertical_values );
+#endif
+			buffer          += number_of_rows * 16;
+			buffer_iterator += number_of_rows * 16;
+
+			continue;
+		}
 		byte_stream_copy_to_uint32_little_endian(
 		 buffer,
 		 value_32bit );
 
-		if( buffer_alignment == 0 )
-		{
-			xor32_vertical_first ^= value_32bit;
-		}
-		else if( buffer_alignment == 4 )
-		{
-			xor32_vertical_second ^= value_32bit;
-		}
-		else if( buffer_alignment == 8 )
-		{
-			xor32_vertical_third ^= value_32bit;
-		}
-		else
-		{
-			xor32_vertical_fourth ^= value_32bit;
-		}
+		xor32_vertical_values[ buffer_alignment / 4 ] ^= value_32bit;
+
 		xor32_value      ^= value_32bit;
 		buffer           += 4;
+		buffer_iterator  += 4;
 		buffer_alignment += 4;
 
 		if( buffer_alignment >= 16 )
@@ -214,6 +616,11 @@ int libesedb_checksum_calculate_little_endian_ecc32(
 			*ecc_checksum_value ^= bitmask;
 		}
 	}
+	xor32_vertical_first  = xor32_vertical_values[ 0 ];
+	xor32_vertical_second = xor32_vertical_values[ 1 ];
+	xor32_vertical_third  = xor32_vertical_values[ 2 ];
+	xor32_vertical_fourth = xor32_vertical_values[ 3 ];
+
 	/* Determine the checksum part of the combination of
 	 * the first and second vertical XOR
 	 */
@@ -342,6 +749,10 @@ int libesedb_checksum_calculate_little_endian_xor32(
 	uint8_t byte_order                          = 0;
 	uint8_t byte_size                           = 0;
 
+#if defined( HAVE_LIBESEDB_CHECKSUM_SSE2 )
+	size_t number_of_blocks                     = 0;
+#endif
+
 	if( checksum_value == NULL )
 	{
 		libcerror_error_set(
@@ -379,6 +790,33 @@ int libesedb_checksum_calculate_little_endian_xor32(
 
 	buffer_iterator = (uint8_t *) buffer;
 
+#if defined( HAVE_LIBESEDB_CHECKSUM_SSE2 )
+	/* The 16-byte blocks are combined using SIMD instructions,
+	 * the remaining bytes are combined below
+	 */
+	if( size >= 16 )
+	{
+		number_of_blocks = size / 16;
+
+#if defined( HAVE_LIBESEDB_CHECKSUM_AVX2 )
+		if( libesedb_checksum_get_cpu_supports_avx2() != 0 )
+		{
+			*checksum_value ^= libesedb_checksum_calculate_little_endian_xor32_blocks_avx2(
+			                    buffer_iterator,
+			                    number_of_blocks );
+		}
+		else
+#endif
+		*checksum_value ^= libesedb_checksum_calculate_little_endian_xor32_blocks_sse2(
+		                    buffer_iterator,
+		                    number_of_blocks );
+
+		buffer_iterator += number_of_blocks * 16;
+		size            -= number_of_blocks * 16;
+	}
+	else
+#endif /* defined( HAVE_LIBESEDB_CHECKSUM_SSE2 ) */
+
 	/* Only optimize when there is the alignment is a multitude of 32-bit
 	 * and for buffers larger than the alignment
 	 */
@@ -31,6 +31,55 @@
 extern "C" {
 #endif
 
+/* SSE2 is part of the x86-64 base instruction set, AVX2 support is determined at run-time
+ */
+#if defined( __x86_64__ ) && ( defined( __GNUC__ ) || defined( __clang__ ) )
+#define HAVE_LIBESEDB_CHECKSUM_SSE2	1
+#define HAVE_LIBESEDB_CHECKSUM_AVX2	1
+
+#elif defined( _MSC_VER ) && defined( _M_X64 )
+#define HAVE_LIBESEDB_CHECKSUM_SSE2	1
+
+#endif
+
+#if defined( HAVE_LIBESEDB_CHECKSUM_AVX2 )
+int libesedb_checksum_get_cpu_supports_avx2(
+     void );
+#endif
+
+void libesedb_checksum_calculate_little_endian_ecc32_rows(
+      const uint8_t *buffer,
+      size_t number_of_rows,
+      uint32_t *bitmask,
+      uint32_t *ecc_checksum_value,
+      uint32_t *xor32_vertical_values );
+
+#if defined( HAVE_LIBESEDB_CHECKSUM_SSE2 )
+void libesedb_checksum_calculate_little_endian_ecc32_rows_sse2(
+      const uint8_t *buffer,
+      size_t number_of_rows,
+      uint32_t *bitmask,
+      uint32_t *ecc_checksum_value,
+      uint32_t *xor32_vertical_values );
+
+uint32_t libesedb_checksum_calculate_little_endian_xor32_blocks_sse2(
+          const uint8_t *buffer,
+          size_t number_of_blocks );
+#endif
+
+#if defined( HAVE_LIBESEDB_CHECKSUM_AVX2 )
+void libesedb_checksum_calculate_little_endian_ecc32_rows_avx2(
+      const uint8_t *buffer,
+      size_t number_of_rows,
+      uint32_t *bitmask,
+      uint32_t *ecc_checksum_value,
+      uint32_t *xor32_vertical_values );
+
+uint32_t libesedb_checksum_calculate_little_endian_xor32_blocks_avx2(
+          const uint8_t *buffer,
+          size_t number_of_blocks );
+#endif
+
 int libesedb_checksum_calculate_little_endian_ecc32(
      uint32_t *ecc_checksum_value,
      uint32_t *xor_checksum_value,
@@ -38,6 +38,7 @@
 #include "libesedb_libfdata.h"
 #include "libesedb_libfvalue.h"
 #include "libesedb_page.h"
+#include "libesedb_record_layout.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_value_data_handle.h"
 
@@ -147,22 +148,21 @@ int libesedb_data_definition_free(
 }
 
 /* Reads the data
+ * The data references the page data, the page is referenced on behalf of the caller
+ * and must be released using libesedb_page_release after the data is used
  * Returns 1 if successful or -1 on error
  */
 int libesedb_data_definition_read_data(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_t **page,
      uint8_t **data,
      size_t *data_size,
      libcerror_error_t **error )
 {
-	libesedb_page_t *page             = NULL;
 	libesedb_page_value_t *page_value = NULL;
 	static char *function             = "libesedb_data_definition_read_data";
-	off64_t element_data_offset       = 0;
 	uint16_t data_offset              = 0;
 
 	if( data_definition == NULL )
@@ -187,6 +187,28 @@ int libesedb_data_definition_read_data(
 
 		return( -1 );
 	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page value already set.",
+		 function );
+
+		return( -1 );
+	}
 	if( data == NULL )
 	{
 		libcerror_error_set(
@@ -209,28 +231,24 @@ int libesedb_data_definition_read_data(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_at_offset(
-	     pages_vector,
-	     (intptr_t *) file_io_handle,
-	     pages_cache,
-	     data_definition->page_offset,
-	     &element_data_offset,
-	     (intptr_t **) &page,
-	     0,
+	if( libesedb_page_get_from_cache(
+	     io_handle,
+	     file_io_handle,
+	     data_definition->page_number,
+	     page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve page: %" PRIu32 " at offset: 0x%08" PRIx64 ".",
+		 "%s: unable to retrieve page: %" PRIu32 ".",
 		 function,
-		 data_definition->page_number,
-		 data_definition->page_offset );
+		 data_definition->page_number );
 
 		return( -1 );
 	}
-	if( page == NULL )
+	if( *page == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -239,10 +257,10 @@ int libesedb_data_definition_read_data(
 		 "%s: missing page.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( libesedb_page_get_value(
-	     page,
+	     *page,
 	     data_definition->page_value_index,
 	     &page_value,
 	     error ) != 1 )
@@ -255,7 +273,7 @@ int libesedb_data_definition_read_data(
 		 function,
 		 data_definition->page_value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value == NULL )
 	{
@@ -267,7 +285,7 @@ int libesedb_data_definition_read_data(
 		 function,
 		 data_definition->page_value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value->data == NULL )
 	{
@@ -278,7 +296,7 @@ int libesedb_data_definition_read_data(
 		 "%s: missing page value data.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	data_offset = data_definition->data_offset - page_value->offset;
 
@@ -292,46 +310,66 @@ int libesedb_data_definition_read_data(
 		 "%s: invalid data definition - data offset value out of bounds.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	*data      = &( page_value->data[ data_offset ] );
 	*data_size = (size_t) ( page_value->size - data_offset );
 
 	return( 1 );
+
+on_error:
+	if( *page != NULL )
+	{
+		libesedb_page_release(
+		 io_handle,
+		 page,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Reads the record
  * Uses the definition data in the catalog definitions
+ * If a column mask is provided only the values of the columns with a non-zero
+ * mask entry are created, the values array entries of the other columns are NULL
+ * The record data is copied once into values data, which the values reference
+ * instead of each holding a copy of its data, and must be freed by the caller
+ * after the values
  * Returns 1 if successful or -1 on error
  */
 int libesedb_data_definition_read_record(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
+     const uint8_t *column_mask,
+     int column_mask_size,
      libcdata_array_t *values_array,
+     uint8_t **values_data,
+     size_t *values_data_size,
      uint8_t *record_flags,
      libcerror_error_t **error )
 {
-	libcdata_list_element_t *column_catalog_definition_list_element = NULL;
 	libesedb_catalog_definition_t *column_catalog_definition        = NULL;
 	libesedb_page_t *page                                           = NULL;
 	libesedb_page_value_t *page_value                               = NULL;
+	libesedb_record_layout_t *record_layout                         = NULL;
 	libfvalue_data_handle_t *value_data_handle                      = NULL;
 	libfvalue_value_t *record_value                                 = NULL;
 	uint8_t *record_data                                            = NULL;
 	uint8_t *tagged_data_type_offset_data                           = NULL;
 	static char *function                                           = "libesedb_data_definition_read_record";
-	off64_t element_data_offset                                     = 0;
 	size_t record_data_size                                         = 0;
 	size_t remaining_definition_data_size                           = 0;
+	size_t tagged_data_types_data_size                              = 0;
+	uint32_t column_identifier                                      = 0;
+	uint32_t column_value_offset                                    = 0;
+	uint32_t column_value_size                                      = 0;
 	uint16_t data_offset                                            = 0;
-	uint16_t fixed_size_data_type_value_offset                      = 0;
 	uint16_t masked_previous_tagged_data_type_offset                = 0;
 	uint16_t masked_tagged_data_type_offset                         = 0;
+	uint16_t number_of_tagged_data_types                            = 0;
 	uint16_t previous_tagged_data_type_offset                       = 0;
 	uint16_t previous_variable_size_data_type_size                  = 0;
 	uint16_t tagged_data_type_offset_data_size                      = 0;
@@ -341,23 +379,26 @@ int libesedb_data_definition_read_record(
 	uint16_t tagged_data_type_size                                  = 0;
 	uint16_t tagged_data_types_offset                               = 0;
 	uint16_t tagged_data_type_value_offset                          = 0;
-	uint16_t variable_size_data_type_offset                         = 0;
 	uint16_t variable_size_data_type_size                           = 0;
+	uint16_t variable_size_data_type_start_offsets[ 128 ]           = { 0 };
 	uint16_t variable_size_data_type_value_offset                   = 0;
+	uint16_t variable_size_data_types_end_offset                    = 0;
 	uint16_t variable_size_data_types_offset                        = 0;
-	uint8_t current_variable_size_data_type                         = 0;
 	uint8_t last_fixed_size_data_type                               = 0;
 	uint8_t last_variable_size_data_type                            = 0;
 	uint8_t number_of_variable_size_data_types                      = 0;
 	uint8_t record_value_type                                       = 0;
 	uint8_t tagged_data_types_format                                = LIBESEDB_TAGGED_DATA_TYPES_FORMAT_INDEX;
-	int column_catalog_definition_index                             = 0;
+	uint8_t variable_size_data_type_index                           = 0;
+	int column_entry                                                = 0;
 	int encoding                                                    = 0;
-	int number_of_column_catalog_definitions                        = 0;
-	int number_of_table_column_catalog_definitions                  = 0;
-	int number_of_template_table_column_catalog_definitions         = 0;
-	int record_value_codepage                                       = 0;
-	int result                                                      = 0;
+	int lower_tagged_data_type_index                                = 0;
+	int tagged_data_type_index                                      = 0;
+	int upper_tagged_data_type_index                                = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint16_t fixed_size_data_types_end_offset                       = 0;
+#endif
 
 	if( data_definition == NULL )
 	{
@@ -415,6 +456,17 @@ int libesedb_data_definition_read_record(
 
 		return( -1 );
 	}
+	if( table_definition->record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table definition - missing record layout.",
+		 function );
+
+		return( -1 );
+	}
 	if( values_array == NULL )
 	{
 		libcerror_error_set(
@@ -426,6 +478,39 @@ int libesedb_data_definition_read_record(
 
 		return( -1 );
 	}
+	if( values_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *values_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid values data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( values_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values data size.",
+		 function );
+
+		return( -1 );
+	}
 	if( record_flags == NULL )
 	{
 		libcerror_error_set(
@@ -437,24 +522,20 @@ int libesedb_data_definition_read_record(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_at_offset(
-	     pages_vector,
-	     (intptr_t *) file_io_handle,
-	     pages_cache,
-	     data_definition->page_offset,
-	     &element_data_offset,
-	     (intptr_t **) &page,
-	     0,
+	if( libesedb_page_get_from_cache(
+	     io_handle,
+	     file_io_handle,
+	     data_definition->page_number,
+	     &page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve page: %" PRIu32 " at offset: 0x%08" PRIx64 ".",
+		 "%s: unable to retrieve page: %" PRIu32 ".",
 		 function,
-		 data_definition->page_number,
-		 data_definition->page_offset );
+		 data_definition->page_number );
 
 		goto on_error;
 	}
@@ -520,7 +601,7 @@ int libesedb_data_definition_read_record(
 		 "%s: invalid data definition - data offset value out of bounds.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	record_data      = &( page_value->data[ data_offset ] );
 	record_data_size = page_value->size - data_offset;
@@ -536,6 +617,56 @@ int libesedb_data_definition_read_record(
 
 		goto on_error;
 	}
+	/* The page can be removed from the pages cache while the record is in use
+	 * hence the record data is copied once and the values reference the copy
+	 */
+	*values_data = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * record_data_size );
+
+	if( *values_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create values data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     *values_data,
+	     record_data,
+	     record_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy record data to values data.",
+		 function );
+
+		goto on_error;
+	}
+	*values_data_size = record_data_size;
+	record_data       = *values_data;
+
+	if( libesedb_page_release(
+	     io_handle,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page: %" PRIu32 ".",
+		 function,
+		 data_definition->page_number );
+
+		goto on_error;
+	}
+
 	if( ( io_handle->format_version == 0x620 )
 	 && ( io_handle->format_revision <= 2 ) )
 	{
@@ -572,59 +703,35 @@ int libesedb_data_definition_read_record(
 		 variable_size_data_types_offset );
 	}
 #endif
-	if( ( template_table_definition != NULL )
-	 && ( template_table_definition->column_catalog_definition_list != NULL ) )
-	{
-		if( libcdata_list_get_number_of_elements(
-		     template_table_definition->column_catalog_definition_list,
-		     &number_of_template_table_column_catalog_definitions,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of template table column catalog definitions.",
-			 function );
+	record_layout = table_definition->record_layout;
 
-			goto on_error;
-		}
-	}
-	if( libcdata_list_get_number_of_elements(
-	     table_definition->column_catalog_definition_list,
-	     &number_of_table_column_catalog_definitions,
-	     error ) != 1 )
+	if( ( record_layout->number_of_template_table_columns > 0 )
+	 && ( ( record_layout->number_of_columns - record_layout->number_of_template_table_columns ) > record_layout->number_of_template_table_columns ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of table column catalog definitions.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of table column catalog definitions value exceeds number in template table.",
 		 function );
 
 		goto on_error;
 	}
-	number_of_column_catalog_definitions = number_of_table_column_catalog_definitions;
-
-	if( ( template_table_definition != NULL )
-	 && ( template_table_definition->column_catalog_definition_list != NULL ) )
+	if( ( column_mask != NULL )
+	 && ( column_mask_size != record_layout->number_of_columns ) )
 	{
-		if( number_of_table_column_catalog_definitions > number_of_template_table_column_catalog_definitions )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid number of table column catalog definitions value exceeds number in template table.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column mask size value does not match number of column catalog definitions.",
+		 function );
 
-			goto on_error;
-		}
-		number_of_column_catalog_definitions += number_of_template_table_column_catalog_definitions;
+		goto on_error;
 	}
 	if( libcdata_array_resize(
 	     values_array,
-	     number_of_column_catalog_definitions,
+	     record_layout->number_of_columns,
 	     (int (*)(intptr_t **, libcerror_error_t **)) &libfvalue_value_free,
 	     error ) != 1 )
 	{
@@ -641,86 +748,75 @@ int libesedb_data_definition_read_record(
 	{
 		number_of_variable_size_data_types = last_variable_size_data_type - 127;
 	}
-	if( ( template_table_definition != NULL )
-	 && ( template_table_definition->column_catalog_definition_list != NULL ) )
-	{
-		result = libcdata_list_get_first_element(
-		          template_table_definition->column_catalog_definition_list,
-		          &column_catalog_definition_list_element,
-		          error );
-	}
-	else
-	{
-		result = libcdata_list_get_first_element(
-		          table_definition->column_catalog_definition_list,
-		          &column_catalog_definition_list_element,
-		          error );
-	}
-	if( result != 1 )
+	if( ( (size_t) variable_size_data_types_offset > record_data_size )
+	 || ( ( (size_t) number_of_variable_size_data_types * 2 ) > ( record_data_size - variable_size_data_types_offset ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first column catalog definition list element.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid variable size data types offset value out of bounds.",
 		 function );
 
 		goto on_error;
 	}
-	fixed_size_data_type_value_offset    = (uint16_t) sizeof( esedb_data_definition_header_t );
-	current_variable_size_data_type      = 127;
-	variable_size_data_type_offset       = variable_size_data_types_offset;
 	variable_size_data_type_value_offset = variable_size_data_types_offset + ( number_of_variable_size_data_types * 2 );
 
-	for( column_catalog_definition_index = 0;
-	     column_catalog_definition_index < number_of_column_catalog_definitions;
-	     column_catalog_definition_index++ )
+	/* Determine the start offsets of the variable size data types in a single pass
+	 * so that the variable size columns can be accessed directly
+	 */
+	for( variable_size_data_type_index = 0;
+	     variable_size_data_type_index < number_of_variable_size_data_types;
+	     variable_size_data_type_index++ )
 	{
-		if( libcdata_list_element_get_value(
-		     column_catalog_definition_list_element,
-		     (intptr_t **) &column_catalog_definition,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column catalog definition from list element: %d.",
-			 function,
-			 column_catalog_definition_index );
+		byte_stream_copy_to_uint16_little_endian(
+		 &( record_data[ variable_size_data_types_offset + ( variable_size_data_type_index * 2 ) ] ),
+		 variable_size_data_type_size );
 
-			goto on_error;
-		}
-		if( column_catalog_definition == NULL )
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing column catalog definition: %d.",
+			libcnotify_printf(
+			 "%s: (%03" PRIu16 ") variable size data type size\t: 0x%04" PRIx16 " (%" PRIu16 ")\n",
 			 function,
-			 column_catalog_definition_index );
-
-			goto on_error;
+			 (uint16_t) variable_size_data_type_index + 128,
+			 variable_size_data_type_size,
+			 ( ( variable_size_data_type_size & 0x8000 ) != 0 ) ? 0 : ( variable_size_data_type_size & 0x7fff ) - previous_variable_size_data_type_size );
 		}
-		if( column_catalog_definition->type != LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported column catalog definition type: %" PRIu16 " for list element: %d.",
-			 function,
-			 column_catalog_definition->type,
-			 column_catalog_definition_index );
+#endif
+		variable_size_data_type_start_offsets[ variable_size_data_type_index ] = previous_variable_size_data_type_size;
 
-			goto on_error;
+		if( ( variable_size_data_type_size & 0x8000 ) == 0 )
+		{
+			previous_variable_size_data_type_size = variable_size_data_type_size;
 		}
-		if( ( template_table_definition != NULL )
-		 && ( template_table_definition->column_catalog_definition_list != NULL )
-		 && ( column_catalog_definition_index == number_of_template_table_column_catalog_definitions ) )
+	}
+	if( (size_t) previous_variable_size_data_type_size > ( record_data_size - variable_size_data_type_value_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid variable size data types size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The tagged data types are stored after the variable size data types
+	 */
+	variable_size_data_types_end_offset = variable_size_data_type_value_offset + previous_variable_size_data_type_size;
+
+	for( column_entry = 0;
+	     column_entry < record_layout->number_of_columns;
+	     column_entry++ )
+	{
+		column_catalog_definition = record_layout->column_catalog_definitions[ column_entry ];
+		column_identifier         = record_layout->column_identifiers[ column_entry ];
+
+		if( ( record_layout->number_of_template_table_columns > 0 )
+		 && ( column_entry == record_layout->number_of_template_table_columns ) )
 		{
-			if( column_catalog_definition->identifier != 256 )
+			if( column_identifier != 256 )
 			{
 				libcerror_error_set(
 				 error,
@@ -752,221 +848,177 @@ int libesedb_data_definition_read_record(
 			  column_catalog_definition->column_type ) );
 		}
 #endif
-/* TODO refactor to value type */
-
-		switch( column_catalog_definition->column_type )
+		/* The fixed and variable size data types are accessed directly and
+		 * in the index format the tagged data types are looked up, hence the columns
+		 * that are not in the column mask can be skipped
+		 */
+		if( ( column_mask != NULL )
+		 && ( column_mask[ column_entry ] == 0 )
+		 && ( ( column_identifier <= 255 )
+		  || ( tagged_data_types_format == LIBESEDB_TAGGED_DATA_TYPES_FORMAT_INDEX ) ) )
 		{
-			case LIBESEDB_COLUMN_TYPE_NULL:
-				/* JET_coltypNil seems to be able to contain data */
-				record_value_type = LIBFVALUE_VALUE_TYPE_BINARY_DATA;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_BOOLEAN:
-				record_value_type = LIBFVALUE_VALUE_TYPE_BOOLEAN;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_8BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_16BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_16BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_32BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_CURRENCY:
-			case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_64BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
-				record_value_type = LIBFVALUE_VALUE_TYPE_FLOATING_POINT_32BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
-				record_value_type = LIBFVALUE_VALUE_TYPE_FLOATING_POINT_64BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_DATE_TIME:
-				record_value_type = LIBFVALUE_VALUE_TYPE_FILETIME;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_GUID:
-				record_value_type = LIBFVALUE_VALUE_TYPE_GUID;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_BINARY_DATA:
-			case LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA:
-				record_value_type = LIBFVALUE_VALUE_TYPE_BINARY_DATA;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_TEXT:
-			case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
-				record_value_type = LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_SUPER_LARGE_VALUE:
-/* TODO handle this value type */
-				record_value_type = LIBFVALUE_VALUE_TYPE_UNDEFINED;
-				break;
-
-			default:
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported column type: %" PRIu32 ".",
-				 function,
-				 column_catalog_definition->column_type );
-
-				goto on_error;
+			continue;
 		}
-		if( libfvalue_data_handle_initialize(
-		     &value_data_handle,
-		     (int (*)(libfvalue_data_handle_t *, const uint8_t *, size_t, int, uint32_t, libcerror_error_t **)) &libesedb_value_data_handle_read_value_entries,
-		     error ) != 1 )
+		if( record_layout->value_types[ column_entry ] == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create value data handle.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported column type: %" PRIu32 ".",
+			 function,
+			 column_catalog_definition->column_type );
 
 			goto on_error;
 		}
-		if( ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
-		 || ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
-		{
-			record_value_codepage = (int) column_catalog_definition->codepage;
+		record_value_type = (uint8_t) record_layout->value_types[ column_entry ];
 
-			/* If the codepage is not set use the default codepage
-			 */
-			if( record_value_codepage == 0 )
+		/* The value of a column that is not in the column mask is not created
+		 */
+		if( ( column_mask == NULL )
+		 || ( column_mask[ column_entry ] != 0 ) )
+		{
+			if( libfvalue_data_handle_initialize(
+			     &value_data_handle,
+			     (int (*)(libfvalue_data_handle_t *, const uint8_t *, size_t, int, uint32_t, libcerror_error_t **)) &libesedb_value_data_handle_read_value_entries,
+			     error ) != 1 )
 			{
-				record_value_codepage = io_handle->ascii_codepage;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create value data handle.",
+				 function );
+
+				goto on_error;
 			}
+		}
+		encoding = record_layout->encodings[ column_entry ];
+
+		/* If the codepage is not set use the default codepage
+		 */
+		if( encoding == 0 )
+		{
+			encoding = io_handle->ascii_codepage;
+
 			/* Codepage 1200 in the ESE database format is not strict UTF-16 little endian
 			 * it can be used for ASCII strings as well. This could be SCSU.
 			 */
-			if( record_value_codepage == 1200 )
+			if( encoding == 1200 )
 			{
-				record_value_codepage = LIBFVALUE_CODEPAGE_1200_MIXED;
+				encoding = LIBFVALUE_CODEPAGE_1200_MIXED;
 			}
-			encoding = record_value_codepage;
 		}
-		else
-		{
-			encoding = LIBFVALUE_ENDIAN_LITTLE;
-		}
-		if( column_catalog_definition->identifier <= 127 )
+		if( column_identifier <= 127 )
 		{
-			if( column_catalog_definition->identifier <= last_fixed_size_data_type )
+			if( column_identifier <= last_fixed_size_data_type )
 			{
+				column_value_offset = record_layout->fixed_size_offsets[ column_entry ];
+				column_value_size   = record_layout->fixed_size_sizes[ column_entry ];
+
+				if( ( (size_t) column_value_offset > record_data_size )
+				 || ( (size_t) column_value_size > ( record_data_size - column_value_offset ) ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid fixed size data type: %" PRIu32 " value size value out of bounds.",
+					 function,
+					 column_identifier );
+
+					goto on_error;
+				}
 #if defined( HAVE_DEBUG_OUTPUT )
 				if( libcnotify_verbose != 0 )
 				{
 					libcnotify_printf(
 					 "%s: (%03" PRIu32 ") fixed size data type size\t\t: %" PRIu32 "\n",
 					 function,
-					 column_catalog_definition->identifier,
-					 column_catalog_definition->size );
+					 column_identifier,
+					 column_value_size );
 					libcnotify_print_data(
-					 &( record_data[ fixed_size_data_type_value_offset ] ),
-					 column_catalog_definition->size,
+					 &( record_data[ column_value_offset ] ),
+					 column_value_size,
 					 0 );
 				}
 #endif
-				if( libfvalue_data_handle_set_data(
-				     value_data_handle,
-				     &( record_data[ fixed_size_data_type_value_offset ] ),
-				     column_catalog_definition->size,
-				     encoding,
-				     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
-				     error ) != 1 )
+				if( value_data_handle != NULL )
 				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set data in fixed size data type definition.",
-					 function );
-
-					goto on_error;
-				}
-				if( column_catalog_definition->size > (uint32_t) UINT16_MAX )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-					 "%s: invalid common catalog definition size value exceeds maximum.",
-					 function );
+					if( libfvalue_data_handle_set_data(
+					     value_data_handle,
+					     &( record_data[ column_value_offset ] ),
+					     column_value_size,
+					     encoding,
+					     LIBFVALUE_VALUE_DATA_FLAG_NON_MANAGED,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to set data in fixed size data type definition.",
+						 function );
 
-					goto on_error;
+						goto on_error;
+					}
 				}
-				fixed_size_data_type_value_offset += (uint16_t) column_catalog_definition->size;
 			}
 		}
-		else if( current_variable_size_data_type < last_variable_size_data_type )
+		else if( column_identifier <= 255 )
 		{
-			while( current_variable_size_data_type < column_catalog_definition->identifier )
+			/* The variable size data type is accessed directly by its identifier
+			 */
+			if( column_identifier <= last_variable_size_data_type )
 			{
+				variable_size_data_type_index = (uint8_t) ( column_identifier - 128 );
+
 				byte_stream_copy_to_uint16_little_endian(
-				 &( record_data[ variable_size_data_type_offset ] ),
+				 &( record_data[ variable_size_data_types_offset + ( variable_size_data_type_index * 2 ) ] ),
 				 variable_size_data_type_size );
 
-				variable_size_data_type_offset += 2;
+				/* The MSB signifies that the variable size data type is empty
+				 */
+				if( ( variable_size_data_type_size & 0x8000 ) == 0 )
+				{
+					column_value_offset = variable_size_data_type_value_offset + variable_size_data_type_start_offsets[ variable_size_data_type_index ];
+
+					if( ( variable_size_data_type_size < variable_size_data_type_start_offsets[ variable_size_data_type_index ] )
+					 || ( (size_t) variable_size_data_type_size > ( record_data_size - variable_size_data_type_value_offset ) ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid variable size data type: %" PRIu32 " size value out of bounds.",
+						 function,
+						 column_identifier );
 
-				current_variable_size_data_type++;
+						goto on_error;
+					}
+					column_value_size = variable_size_data_type_size - variable_size_data_type_start_offsets[ variable_size_data_type_index ];
 
 #if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: (%03" PRIu16 ") variable size data type size\t: 0x%04" PRIx16 " (%" PRIu16 ")\n",
-					 function,
-					 current_variable_size_data_type,
-					 variable_size_data_type_size,
-					 ( ( variable_size_data_type_size & 0x8000 ) != 0 ) ? 0 : ( variable_size_data_type_size & 0x7fff ) - previous_variable_size_data_type_size );
-				}
-#endif
-				if( current_variable_size_data_type == column_catalog_definition->identifier )
-				{
-					/* The MSB signifies that the variable size data type is empty
-					 */
-					if( ( variable_size_data_type_size & 0x8000 ) == 0 )
+					if( libcnotify_verbose != 0 )
 					{
-#if defined( HAVE_DEBUG_OUTPUT )
-						if( libcnotify_verbose != 0 )
-						{
-							libcnotify_printf(
-							 "%s: (%03" PRIu32 ") variable size data type:\n",
-							 function,
-							 column_catalog_definition->identifier );
-							libcnotify_print_data(
-							 &( record_data[ variable_size_data_type_value_offset ] ),
-							 variable_size_data_type_size - previous_variable_size_data_type_size,
-							 0 );
-						}
+						libcnotify_printf(
+						 "%s: (%03" PRIu32 ") variable size data type:\n",
+						 function,
+						 column_identifier );
+						libcnotify_print_data(
+						 &( record_data[ column_value_offset ] ),
+						 column_value_size,
+						 0 );
+					}
 #endif
+					if( value_data_handle != NULL )
+					{
 						if( libfvalue_data_handle_set_data(
 						     value_data_handle,
-						     &( record_data[ variable_size_data_type_value_offset ] ),
-						     variable_size_data_type_size - previous_variable_size_data_type_size,
+						     &( record_data[ column_value_offset ] ),
+						     column_value_size,
 						     encoding,
-						     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
+						     LIBFVALUE_VALUE_DATA_FLAG_NON_MANAGED,
 						     error ) != 1 )
 						{
 							libcerror_error_set(
@@ -978,23 +1030,17 @@ int libesedb_data_definition_read_record(
 
 							goto on_error;
 						}
-						variable_size_data_type_value_offset += variable_size_data_type_size - previous_variable_size_data_type_size;
-						previous_variable_size_data_type_size = variable_size_data_type_size;
 					}
-#if defined( HAVE_DEBUG_OUTPUT )
-					else if( libcnotify_verbose != 0 )
-					{
-						libcnotify_printf(
-						 "%s: (%03" PRIu32 ") variable size data type\t\t: <NULL>\n",
-						 function,
-						 column_catalog_definition->identifier );
-					}
-#endif
 				}
-				if( current_variable_size_data_type >= last_variable_size_data_type )
+#if defined( HAVE_DEBUG_OUTPUT )
+				else if( libcnotify_verbose != 0 )
 				{
-					break;
+					libcnotify_printf(
+					 "%s: (%03" PRIu32 ") variable size data type\t\t: <NULL>\n",
+					 function,
+					 column_identifier );
 				}
+#endif
 			}
 		}
 		else
@@ -1003,8 +1049,8 @@ int libesedb_data_definition_read_record(
 			{
 				if( tagged_data_types_offset == 0 )
 				{
-					tagged_data_types_offset       = variable_size_data_type_value_offset;
-					tagged_data_type_value_offset  = variable_size_data_type_value_offset;
+					tagged_data_types_offset       = variable_size_data_types_end_offset;
+					tagged_data_type_value_offset  = variable_size_data_types_end_offset;
 					remaining_definition_data_size = record_data_size - (size_t) tagged_data_types_offset;
 
 					byte_stream_copy_to_uint16_little_endian(
@@ -1067,19 +1113,22 @@ int libesedb_data_definition_read_record(
 							 "\n" );
 						}
 #endif
-						if( libfvalue_data_handle_set_data_flags(
-						     value_data_handle,
-						     (uint32_t) record_data[ tagged_data_type_value_offset ],
-						     error ) != 1 )
+						if( value_data_handle != NULL )
 						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-							 "%s: unable to set tagged data type flags in tagged data type definition.",
-							 function );
+							if( libfvalue_data_handle_set_data_flags(
+							     value_data_handle,
+							     (uint32_t) record_data[ tagged_data_type_value_offset ],
+							     error ) != 1 )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+								 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+								 "%s: unable to set tagged data type flags in tagged data type definition.",
+								 function );
 
-							goto on_error;
+								goto on_error;
+							}
 						}
 						tagged_data_type_value_offset  += 1;
 						tagged_data_type_size           = ( tagged_data_type_size & 0x5fff ) - 1;
@@ -1130,23 +1179,228 @@ int libesedb_data_definition_read_record(
 
 							goto on_error;
 						}
-						if( tagged_data_type_size > remaining_definition_data_size )
+						if( tagged_data_type_size > remaining_definition_data_size )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+							 "%s: invalid tagged data type size value exceeds remaining data size.",
+							 function );
+
+							goto on_error;
+						}
+						if( value_data_handle != NULL )
+						{
+							if( libfvalue_data_handle_set_data(
+							     value_data_handle,
+							     &( record_data[ tagged_data_type_value_offset ] ),
+							     tagged_data_type_size,
+							     encoding,
+							     LIBFVALUE_VALUE_DATA_FLAG_NON_MANAGED,
+							     error ) != 1 )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+								 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+								 "%s: unable to set data in tagged data type definition.",
+								 function );
+
+								goto on_error;
+							}
+						}
+						remaining_definition_data_size -= tagged_data_type_size;
+					}
+					if( remaining_definition_data_size > 0 )
+					{
+						if( tagged_data_type_value_offset >= record_data_size )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+							 "%s: invalid tagged data type offset value out of bounds.",
+							 function );
+
+							goto on_error;
+						}
+						byte_stream_copy_to_uint16_little_endian(
+						 &( record_data[ tagged_data_type_value_offset ] ),
+						 tagged_data_type_identifier );
+
+						tagged_data_type_value_offset += 2;
+
+						byte_stream_copy_to_uint16_little_endian(
+						 &( record_data[ tagged_data_type_value_offset ] ),
+						 tagged_data_type_size );
+
+						tagged_data_type_value_offset += 2;
+
+						remaining_definition_data_size -= 4;
+					}
+				}
+			}
+			else if( ( tagged_data_types_format == LIBESEDB_TAGGED_DATA_TYPES_FORMAT_INDEX )
+			      && ( column_mask != NULL ) )
+			{
+				/* Only the tagged data types of the columns in the column mask are read,
+				 * these are looked up using a binary search since the tagged data types
+				 * are stored in order of their identifier
+				 */
+				if( tagged_data_types_offset == 0 )
+				{
+					tagged_data_types_offset     = variable_size_data_types_end_offset;
+					tagged_data_type_offset_data = &( record_data[ tagged_data_types_offset ] );
+					tagged_data_types_data_size  = record_data_size - (size_t) tagged_data_types_offset;
+
+					if( tagged_data_types_data_size > 0 )
+					{
+						if( tagged_data_types_data_size < 4 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+							 "%s: invalid tagged data types data size value out of bounds.",
+							 function );
+
+							goto on_error;
+						}
+						/* The offset of the first tagged data type is the size of the tagged data type offsets
+						 */
+						byte_stream_copy_to_uint16_little_endian(
+						 &( tagged_data_type_offset_data[ 2 ] ),
+						 tagged_data_type_offset );
+
+						tagged_data_type_offset_data_size = tagged_data_type_offset & 0x3fff;
+
+						if( ( tagged_data_type_offset_data_size < 4 )
+						 || ( (size_t) tagged_data_type_offset_data_size > tagged_data_types_data_size ) )
 						{
 							libcerror_error_set(
 							 error,
 							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-							 "%s: invalid tagged data type size value exceeds remaining data size.",
+							 "%s: invalid tagged data type offset value out of bounds.",
 							 function );
 
 							goto on_error;
 						}
+						number_of_tagged_data_types = tagged_data_type_offset_data_size / 4;
+					}
+				}
+				lower_tagged_data_type_index = 0;
+				upper_tagged_data_type_index = number_of_tagged_data_types;
+
+				while( lower_tagged_data_type_index < upper_tagged_data_type_index )
+				{
+					tagged_data_type_index = lower_tagged_data_type_index
+					                       + ( ( upper_tagged_data_type_index - lower_tagged_data_type_index ) / 2 );
+
+					byte_stream_copy_to_uint16_little_endian(
+					 &( tagged_data_type_offset_data[ tagged_data_type_index * 4 ] ),
+					 tagged_data_type_identifier );
+
+					if( column_identifier == (uint32_t) tagged_data_type_identifier )
+					{
+						break;
+					}
+					if( column_identifier < (uint32_t) tagged_data_type_identifier )
+					{
+						upper_tagged_data_type_index = tagged_data_type_index;
+					}
+					else
+					{
+						lower_tagged_data_type_index = tagged_data_type_index + 1;
+					}
+				}
+				if( lower_tagged_data_type_index < upper_tagged_data_type_index )
+				{
+					byte_stream_copy_to_uint16_little_endian(
+					 &( tagged_data_type_offset_data[ ( tagged_data_type_index * 4 ) + 2 ] ),
+					 previous_tagged_data_type_offset );
+
+					/* The size of the last tagged data type is determined by the end of the record data
+					 */
+					if( ( tagged_data_type_index + 1 ) < number_of_tagged_data_types )
+					{
+						byte_stream_copy_to_uint16_little_endian(
+						 &( tagged_data_type_offset_data[ ( tagged_data_type_index * 4 ) + 6 ] ),
+						 tagged_data_type_offset );
+
+						masked_tagged_data_type_offset = tagged_data_type_offset & tagged_data_type_offset_bitmask;
+					}
+					else
+					{
+						masked_tagged_data_type_offset = (uint16_t) tagged_data_types_data_size;
+					}
+					masked_previous_tagged_data_type_offset = previous_tagged_data_type_offset & tagged_data_type_offset_bitmask;
+
+					if( ( masked_previous_tagged_data_type_offset > masked_tagged_data_type_offset )
+					 || ( (size_t) masked_tagged_data_type_offset > tagged_data_types_data_size ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid tagged data type offset value out of bounds.",
+						 function );
+
+						goto on_error;
+					}
+					tagged_data_type_value_offset = tagged_data_types_offset + masked_previous_tagged_data_type_offset;
+					tagged_data_type_size         = masked_tagged_data_type_offset - masked_previous_tagged_data_type_offset;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+					if( libcnotify_verbose != 0 )
+					{
+						libcnotify_printf(
+						 "%s: (%03" PRIu32 ") tagged data type offset\t\t: 0x%04" PRIx16 " (%" PRIu16 ")\n",
+						 function,
+						 column_identifier,
+						 previous_tagged_data_type_offset,
+						 masked_previous_tagged_data_type_offset );
+
+						libcnotify_printf(
+						 "%s: (%03" PRIu32 ") tagged data type size\t\t: %" PRIu16 "\n",
+						 function,
+						 column_identifier,
+						 tagged_data_type_size );
+					}
+#endif
+					if( tagged_data_type_size > 0 )
+					{
+						if( ( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+						  &&  ( io_handle->page_size >= 16384 ) )
+						 || ( ( previous_tagged_data_type_offset & 0x4000 ) != 0 ) )
+						{
+							if( libfvalue_data_handle_set_data_flags(
+							     value_data_handle,
+							     (uint32_t) record_data[ tagged_data_type_value_offset ],
+							     error ) != 1 )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+								 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+								 "%s: unable to set tagged data type flags in tagged data type definition.",
+								 function );
+
+								goto on_error;
+							}
+							tagged_data_type_value_offset += 1;
+							tagged_data_type_size         -= 1;
+						}
+					}
+					if( tagged_data_type_size > 0 )
+					{
 						if( libfvalue_data_handle_set_data(
 						     value_data_handle,
 						     &( record_data[ tagged_data_type_value_offset ] ),
 						     tagged_data_type_size,
 						     encoding,
-						     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
+						     LIBFVALUE_VALUE_DATA_FLAG_NON_MANAGED,
 						     error ) != 1 )
 						{
 							libcerror_error_set(
@@ -1158,34 +1412,6 @@ int libesedb_data_definition_read_record(
 
 							goto on_error;
 						}
-						remaining_definition_data_size -= tagged_data_type_size;
-					}
-					if( remaining_definition_data_size > 0 )
-					{
-						if( tagged_data_type_value_offset >= record_data_size )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-							 "%s: invalid tagged data type offset value out of bounds.",
-							 function );
-
-							goto on_error;
-						}
-						byte_stream_copy_to_uint16_little_endian(
-						 &( record_data[ tagged_data_type_value_offset ] ),
-						 tagged_data_type_identifier );
-
-						tagged_data_type_value_offset += 2;
-
-						byte_stream_copy_to_uint16_little_endian(
-						 &( record_data[ tagged_data_type_value_offset ] ),
-						 tagged_data_type_size );
-
-						tagged_data_type_value_offset += 2;
-
-						remaining_definition_data_size -= 4;
 					}
 				}
 			}
@@ -1193,7 +1419,7 @@ int libesedb_data_definition_read_record(
 			{
 				if( tagged_data_types_offset == 0 )
 				{
-					tagged_data_types_offset       = variable_size_data_type_value_offset;
+					tagged_data_types_offset       = variable_size_data_types_end_offset;
 					tagged_data_type_offset_data   = &( record_data[ tagged_data_types_offset ] );
 					remaining_definition_data_size = record_data_size - (size_t) tagged_data_types_offset;
 
@@ -1348,19 +1574,22 @@ int libesedb_data_definition_read_record(
 
 								goto on_error;
 							}
-							if( libfvalue_data_handle_set_data_flags(
-							     value_data_handle,
-							     (uint32_t) record_data[ tagged_data_type_value_offset ],
-							     error ) != 1 )
+							if( value_data_handle != NULL )
 							{
-								libcerror_error_set(
-								 error,
-								 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-								 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-								 "%s: unable to set tagged data type flags in tagged data type definition.",
-								 function );
-
-								goto on_error;
+								if( libfvalue_data_handle_set_data_flags(
+								     value_data_handle,
+								     (uint32_t) record_data[ tagged_data_type_value_offset ],
+								     error ) != 1 )
+								{
+									libcerror_error_set(
+									 error,
+									 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+									 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+									 "%s: unable to set tagged data type flags in tagged data type definition.",
+									 function );
+
+									goto on_error;
+								}
 							}
 							tagged_data_type_value_offset += 1;
 							tagged_data_type_size         -= 1;
@@ -1412,108 +1641,94 @@ int libesedb_data_definition_read_record(
 
 							goto on_error;
 						}
-						if( libfvalue_data_handle_set_data(
-						     value_data_handle,
-						     &( record_data[ tagged_data_type_value_offset ] ),
-						     tagged_data_type_size,
-						     encoding,
-						     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
-						     error ) != 1 )
+						if( value_data_handle != NULL )
 						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-							 "%s: unable to set data in tagged data type definition.",
-							 function );
+							if( libfvalue_data_handle_set_data(
+							     value_data_handle,
+							     &( record_data[ tagged_data_type_value_offset ] ),
+							     tagged_data_type_size,
+							     encoding,
+							     LIBFVALUE_VALUE_DATA_FLAG_NON_MANAGED,
+							     error ) != 1 )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+								 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+								 "%s: unable to set data in tagged data type definition.",
+								 function );
 
-							goto on_error;
+								goto on_error;
+							}
 						}
 					}
 				}
 			}
 		}
-		if( libfvalue_value_type_initialize_with_data_handle(
-		     &record_value,
-		     record_value_type,
-		     value_data_handle,
-		     LIBFVALUE_VALUE_FLAG_DATA_HANDLE_MANAGED,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create record value.",
-			 function );
-
-			goto on_error;
-		}
-		value_data_handle = NULL;
-
-		if( libcdata_array_set_entry_by_index(
-		     values_array,
-		     column_catalog_definition_index,
-		     (intptr_t *) record_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to set data type definition: %d.",
-			 function,
-			 column_catalog_definition_index );
-
-			goto on_error;
-		}
-		record_value = NULL;
-
-		if( libcdata_list_element_get_next_element(
-		     column_catalog_definition_list_element,
-		     &column_catalog_definition_list_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve next column catalog definition list element.",
-			 function );
-
-			goto on_error;
-		}
-		if( ( column_catalog_definition_list_element == NULL )
-		 && ( template_table_definition != NULL )
-		 && ( template_table_definition->column_catalog_definition_list != NULL ) )
+		if( value_data_handle != NULL )
 		{
-			if( libcdata_list_get_first_element(
-			     table_definition->column_catalog_definition_list,
-			     &column_catalog_definition_list_element,
+			if( libfvalue_value_type_initialize_with_data_handle(
+			     &record_value,
+			     record_value_type,
+			     value_data_handle,
+			     LIBFVALUE_VALUE_FLAG_DATA_HANDLE_MANAGED,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve first column catalog definition list element.",
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create record value.",
 				 function );
 
 				goto on_error;
 			}
+			value_data_handle = NULL;
+
+			if( libcdata_array_set_entry_by_index(
+			     values_array,
+			     column_entry,
+			     (intptr_t *) record_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to set data type definition: %d.",
+				 function,
+				 column_entry );
+
+				goto on_error;
+			}
+			record_value = NULL;
 		}
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
-		if( fixed_size_data_type_value_offset < variable_size_data_types_offset )
+		/* The fixed size data types precede the variable size data types
+		 */
+		fixed_size_data_types_end_offset = (uint16_t) sizeof( esedb_data_definition_header_t );
+
+		for( column_entry = 0;
+		     column_entry < record_layout->number_of_columns;
+		     column_entry++ )
+		{
+			if( ( record_layout->column_identifiers[ column_entry ] <= 127 )
+			 && ( record_layout->column_identifiers[ column_entry ] <= last_fixed_size_data_type ) )
+			{
+				fixed_size_data_types_end_offset = (uint16_t) ( record_layout->fixed_size_offsets[ column_entry ] + record_layout->fixed_size_sizes[ column_entry ] );
+			}
+		}
+		if( fixed_size_data_types_end_offset < variable_size_data_types_offset )
 		{
 			libcnotify_printf(
 			 "%s: fixed size data types trailing data:\n",
 			 function );
 			libcnotify_print_data(
-			 &( record_data[ fixed_size_data_type_value_offset ] ),
-			 variable_size_data_types_offset - fixed_size_data_type_value_offset,
+			 &( record_data[ fixed_size_data_types_end_offset ] ),
+			 variable_size_data_types_offset - fixed_size_data_types_end_offset,
 			 0 );
 		}
 		libcnotify_printf(
@@ -1523,6 +1738,21 @@ int libesedb_data_definition_read_record(
 	return( 1 );
 
 on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 io_handle,
+		 &page,
+		 NULL );
+	}
+	if( ( values_data != NULL )
+	 && ( *values_data != NULL ) )
+	{
+		memory_free(
+		 *values_data );
+
+		*values_data = NULL;
+	}
 	if( record_value != NULL )
 	{
 		libfvalue_value_free(
@@ -1544,8 +1774,7 @@ on_error:
 int libesedb_data_definition_read_long_value(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
 	libesedb_page_t *page             = NULL;
@@ -1553,7 +1782,6 @@ int libesedb_data_definition_read_long_value(
 	uint8_t *long_value_data          = NULL;
 	static char *function             = "libesedb_data_definition_read_long_value";
 	size_t long_value_data_size       = 0;
-	off64_t element_data_offset       = 0;
 	uint32_t value_32bit              = 0;
 	uint16_t data_offset              = 0;
 
@@ -1568,24 +1796,20 @@ int libesedb_data_definition_read_long_value(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_at_offset(
-	     pages_vector,
-	     (intptr_t *) file_io_handle,
-	     pages_cache,
-	     data_definition->page_offset,
-	     &element_data_offset,
-	     (intptr_t **) &page,
-	     0,
+	if( libesedb_page_get_from_cache(
+	     io_handle,
+	     file_io_handle,
+	     data_definition->page_number,
+	     &page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve page: %" PRIu32 " at offset: 0x%08" PRIx64 ".",
+		 "%s: unable to retrieve page: %" PRIu32 ".",
 		 function,
-		 data_definition->page_number,
-		 data_definition->page_offset );
+		 data_definition->page_number );
 
 		return( -1 );
 	}
@@ -1598,7 +1822,7 @@ int libesedb_data_definition_read_long_value(
 		 "%s: missing page.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( libesedb_page_get_value(
 	     page,
@@ -1614,7 +1838,7 @@ int libesedb_data_definition_read_long_value(
 		 function,
 		 data_definition->page_value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value == NULL )
 	{
@@ -1626,7 +1850,7 @@ int libesedb_data_definition_read_long_value(
 		 function,
 		 data_definition->page_value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value->data == NULL )
 	{
@@ -1637,7 +1861,7 @@ int libesedb_data_definition_read_long_value(
 		 "%s: missing page value data.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	data_offset = data_definition->data_offset - page_value->offset;
 
@@ -1651,7 +1875,7 @@ int libesedb_data_definition_read_long_value(
 		 "%s: invalid data definition - data offset value out of bounds.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	long_value_data      = &( page_value->data[ data_offset ] );
 	long_value_data_size = page_value->size - data_offset;
@@ -1666,7 +1890,7 @@ int libesedb_data_definition_read_long_value(
 		 function,
 		 long_value_data_size );
 
-		return( -1 );
+		goto on_error;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -1713,7 +1937,32 @@ int libesedb_data_definition_read_long_value(
 		 "\n" );
 	}
 #endif
+	if( libesedb_page_release(
+	     io_handle,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page: %" PRIu32 ".",
+		 function,
+		 data_definition->page_number );
+
+		goto on_error;
+	}
 	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 io_handle,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Reads the long value segment
@@ -1723,8 +1972,6 @@ int libesedb_data_definition_read_long_value_segment(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
      uint32_t long_value_segment_offset,
      libfdata_list_t *data_segments_list,
      libcerror_error_t **error )
@@ -1732,7 +1979,6 @@ int libesedb_data_definition_read_long_value_segment(
 	libesedb_page_t *page                  = NULL;
 	libesedb_page_value_t *page_value      = NULL;
 	static char *function                  = "libesedb_data_definition_read_long_value_segment";
-	off64_t element_data_offset            = 0;
 	off64_t long_value_segment_data_offset = 0;
 	size64_t data_size                     = 0;
 	size_t long_value_segment_data_size    = 0;
@@ -1761,24 +2007,20 @@ int libesedb_data_definition_read_long_value_segment(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_at_offset(
-	     pages_vector,
-	     (intptr_t *) file_io_handle,
-	     pages_cache,
-	     data_definition->page_offset,
-	     &element_data_offset,
-	     (intptr_t **) &page,
-	     0,
+	if( libesedb_page_get_from_cache(
+	     io_handle,
+	     file_io_handle,
+	     data_definition->page_number,
+	     &page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve page: %" PRIu32 " at offset: 0x%08" PRIx64 ".",
+		 "%s: unable to retrieve page: %" PRIu32 ".",
 		 function,
-		 data_definition->page_number,
-		 data_definition->page_offset );
+		 data_definition->page_number );
 
 		return( -1 );
 	}
@@ -1791,7 +2033,7 @@ int libesedb_data_definition_read_long_value_segment(
 		 "%s: missing page.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( libesedb_page_get_value(
 	     page,
@@ -1807,7 +2049,7 @@ int libesedb_data_definition_read_long_value_segment(
 		 function,
 		 data_definition->page_value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value == NULL )
 	{
@@ -1819,7 +2061,7 @@ int libesedb_data_definition_read_long_value_segment(
 		 function,
 		 data_definition->page_value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value->data == NULL )
 	{
@@ -1830,7 +2072,7 @@ int libesedb_data_definition_read_long_value_segment(
 		 "%s: missing page value data.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	data_offset = data_definition->data_offset - page_value->offset;
 
@@ -1844,10 +2086,26 @@ int libesedb_data_definition_read_long_value_segment(
 		 "%s: invalid data definition - data offset value out of bounds.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	long_value_segment_data_size = page_value->size - data_offset;
 
+	if( libesedb_page_release(
+	     io_handle,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page: %" PRIu32 ".",
+		 function,
+		 data_definition->page_number );
+
+		goto on_error;
+	}
+
 	/* Note that the data stream will point to the file offset
 	 * io_handle->pages_data_offset contains the offset relative from the start of the file to the page data
 	 * data_definition->page_offset contains the offset relative from the start of the page data
@@ -1883,7 +2141,7 @@ int libesedb_data_definition_read_long_value_segment(
 		 "%s: unable to retrieve size of data segments list.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( long_value_segment_offset != (off64_t) data_size )
 	{
@@ -1896,7 +2154,7 @@ int libesedb_data_definition_read_long_value_segment(
 		 long_value_segment_offset,
 		 data_size );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( libfdata_list_append_element(
 	     data_segments_list,
@@ -1915,8 +2173,18 @@ int libesedb_data_definition_read_long_value_segment(
 		 function,
 		 long_value_segment_offset );
 
-		return( -1 );
+		goto on_error;
 	}
 	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 io_handle,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
 }
 
@@ -31,6 +31,7 @@
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_page.h"
 #include "libesedb_table_definition.h"
 
 #if defined( __cplusplus )
@@ -74,8 +75,7 @@ int libesedb_data_definition_read_data(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_t **page,
      uint8_t **data,
      size_t *data_size,
      libcerror_error_t **error );
@@ -84,27 +84,26 @@ int libesedb_data_definition_read_record(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
+     const uint8_t *column_mask,
+     int column_mask_size,
      libcdata_array_t *values_array,
+     uint8_t **values_data,
+     size_t *values_data_size,
      uint8_t *record_flags,
      libcerror_error_t **error );
 
 int libesedb_data_definition_read_long_value(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_io_handle_t *io_handle,
      libcerror_error_t **error );
 
 int libesedb_data_definition_read_long_value_segment(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
      uint32_t long_value_segment_offset,
      libfdata_list_t *data_segments_list,
      libcerror_error_t **error );
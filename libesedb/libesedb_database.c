@@ -31,6 +31,7 @@
 #include "libesedb_libcnotify.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_page.h"
 #include "libesedb_page_tree.h"
 
 /* Creates a database
@@ -143,11 +144,10 @@ int libesedb_database_read(
      libesedb_database_t *database,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
      libcerror_error_t **error )
 {
 	libesedb_data_definition_t *data_definition = NULL;
+	libesedb_page_t *page                       = NULL;
 	libesedb_page_tree_t *database_page_tree    = NULL;
 	libfcache_cache_t *database_values_cache    = NULL;
 	libfdata_btree_t *database_values_tree      = NULL;
@@ -172,8 +172,6 @@ int libesedb_database_read(
 	if( libesedb_page_tree_initialize(
 	     &database_page_tree,
 	     io_handle,
-	     pages_vector,
-	     pages_cache,
 	     LIBESEDB_FDP_OBJECT_IDENTIFIER_DATABASE,
 	     NULL,
 	     NULL,
@@ -289,8 +287,7 @@ int libesedb_database_read(
 		     data_definition,
 		     file_io_handle,
 		     io_handle,
-		     pages_vector,
-		     pages_cache,
+		     &page,
 		     &data,
 		     &data_size,
 		     error ) != 1 )
@@ -321,6 +318,20 @@ int libesedb_database_read(
 			}
 		}
 #endif
+		if( libesedb_page_release(
+		     io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	if( libfcache_cache_free(
 	     &database_values_cache,
@@ -351,6 +362,13 @@ int libesedb_database_read(
 	return( 1 );
 
 on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 io_handle,
+		 &page,
+		 NULL );
+	}
 	if( database_values_cache != NULL )
 	{
 		libfcache_cache_free(
@@ -55,8 +55,6 @@ int libesedb_database_read(
      libesedb_database_t *database,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
@@ -20,27 +20,33 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <narrow_string.h>
 #include <types.h>
 #include <wide_string.h>
 
 #include "libesedb_catalog.h"
+#include "libesedb_data_definition.h"
 #include "libesedb_database.h"
 #include "libesedb_debug.h"
 #include "libesedb_definitions.h"
 #include "libesedb_i18n.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_file.h"
+#include "libesedb_layout_index.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
-#include "libesedb_libfcache.h"
-#include "libesedb_libfdata.h"
 #include "libesedb_page.h"
+#include "libesedb_page_cache.h"
+#include "libesedb_page_tree.h"
+#include "libesedb_record.h"
 #include "libesedb_table.h"
 #include "libesedb_table_definition.h"
 
+#include "esedb_page.h"
+
 /* Creates a file
  * Make sure the value file is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -206,6 +212,22 @@ int libesedb_file_free(
 
 			result = -1;
 		}
+		if( internal_file->layout_index_file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( internal_file->layout_index_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free layout index file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 internal_file );
 	}
@@ -252,6 +274,7 @@ int libesedb_file_signal_abort(
 }
 
 /* Opens a file
+ * If LIBESEDB_ACCESS_FLAG_MEMORY_MAPPED is set the file is memory mapped when supported
  * Returns 1 if successful or -1 on error
  */
 int libesedb_file_open(
@@ -359,6 +382,43 @@ int libesedb_file_open(
 
 		goto on_error;
 	}
+	/* The file is opened a second time to allow page reads that do not
+	 * depend on the offset of the file IO handle
+	 */
+	if( libesedb_io_handle_open_file(
+	     internal_file->io_handle,
+	     filename,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s for positional reads.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( ( access_flags & LIBESEDB_ACCESS_FLAG_MEMORY_MAPPED ) != 0 )
+	{
+		/* If the file cannot be memory mapped positional reads are used instead
+		 */
+		if( libesedb_io_handle_map_file(
+		     internal_file->io_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to map file: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+	}
 	if( libesedb_file_open_file_io_handle(
 	     file,
 	     file_io_handle,
@@ -380,6 +440,10 @@ int libesedb_file_open(
 	return( 1 );
 
 on_error:
+	libesedb_io_handle_close_file(
+	 internal_file->io_handle,
+	 NULL );
+
 	if( file_io_handle != NULL )
 	{
 		libbfio_handle_free(
@@ -767,32 +831,6 @@ int libesedb_file_close(
 
 		result = -1;
 	}
-	if( libfdata_vector_free(
-	     &( internal_file->pages_vector ),
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free pages vector.",
-		 function );
-
-		result = -1;
-	}
-	if( libfcache_cache_free(
-	     &( internal_file->pages_cache ),
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free pages cache.",
-		 function );
-
-		result = -1;
-	}
 	if( libesedb_database_free(
 	     &( internal_file->database ),
 	     error ) != 1 )
@@ -832,6 +870,22 @@ int libesedb_file_close(
 
 		result = -1;
 	}
+	if( internal_file->layout_index != NULL )
+	{
+		if( libesedb_layout_index_free(
+		     &( internal_file->layout_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free layout index.",
+			 function );
+
+			result = -1;
+		}
+	}
 	return( result );
 }
 
@@ -843,11 +897,11 @@ int libesedb_file_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_file_open_read";
-	off64_t file_offset   = 0;
-	size64_t file_size    = 0;
-	int result            = 0;
-	int segment_index     = 0;
+	static char *function               = "libesedb_file_open_read";
+	off64_t file_offset                 = 0;
+	size64_t file_size                  = 0;
+	int maximum_number_of_cache_entries = 0;
+	int result                          = 0;
 
 	if( internal_file == NULL )
 	{
@@ -871,18 +925,7 @@ int libesedb_file_open_read(
 
 		return( -1 );
 	}
-	if( internal_file->pages_vector != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - pages vector already set.",
-		 function );
-
-		return( -1 );
-	}
-	if( internal_file->pages_cache != NULL )
+	if( internal_file->io_handle->pages_cache != NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1100,48 +1143,61 @@ int libesedb_file_open_read(
 
 		goto on_error;
 	}
-	/* TODO clone function ? */
-	if( libfdata_vector_initialize(
-	     &( internal_file->pages_vector ),
-	     (size64_t) internal_file->io_handle->page_size,
-	     (intptr_t *) internal_file->io_handle,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfcache_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
-	     error ) != 1 )
+	if( internal_file->io_handle->file_type == LIBESEDB_FILE_TYPE_DATABASE )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create pages vector.",
-		 function );
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading the layout index:\n" );
+		}
+#endif
+		/* The layout index is optional, if it cannot be read the catalog
+		 * and page trees are read from the database file
+		 */
+		result = libesedb_file_read_layout_index(
+		          internal_file,
+		          error );
 
-		goto on_error;
+		if( result == -1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( libcnotify_verbose != 0 )
+			 && ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		internal_file->io_handle->layout_index = internal_file->layout_index;
 	}
-	if( libfdata_vector_append_segment(
-	     internal_file->pages_vector,
-	     &segment_index,
-	     0,
-	     internal_file->io_handle->pages_data_offset,
-	     internal_file->io_handle->pages_data_size,
-	     0,
+	/* The pages cache is sized by the pages cache limit, hence the limit
+	 * and the page size must be known before it is created
+	 */
+	if( libesedb_io_handle_get_maximum_number_of_cache_entries(
+	     internal_file->io_handle,
+	     LIBESEDB_CACHE_TYPE_PAGES,
+	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
+	     &maximum_number_of_cache_entries,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append segment to pages vector.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum number of pages cache entries.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
-	     &( internal_file->pages_cache ),
-	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
+	if( libesedb_page_cache_initialize(
+	     &( internal_file->io_handle->pages_cache ),
+	     maximum_number_of_cache_entries,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_release_reference,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1179,8 +1235,6 @@ int libesedb_file_open_read(
 		     internal_file->database,
 		     file_io_handle,
 		     internal_file->io_handle,
-		     internal_file->pages_vector,
-		     internal_file->pages_cache,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1212,14 +1266,25 @@ int libesedb_file_open_read(
 
 			goto on_error;
 		}
-		if( libesedb_catalog_read(
-		     internal_file->catalog,
-		     file_io_handle,
-		     internal_file->io_handle,
-		     LIBESEDB_PAGE_NUMBER_CATALOG,
-		     internal_file->pages_vector,
-		     internal_file->pages_cache,
-		     error ) != 1 )
+		if( internal_file->layout_index != NULL )
+		{
+			result = libesedb_catalog_read_layout_index(
+			          internal_file->catalog,
+			          internal_file->layout_index,
+			          LIBESEDB_LAYOUT_INDEX_ENTRY_TYPE_CATALOG_DEFINITION,
+			          internal_file->io_handle->ascii_codepage,
+			          error );
+		}
+		else
+		{
+			result = libesedb_catalog_read(
+			          internal_file->catalog,
+			          file_io_handle,
+			          internal_file->io_handle,
+			          LIBESEDB_PAGE_NUMBER_CATALOG,
+			          error );
+		}
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1250,14 +1315,25 @@ int libesedb_file_open_read(
 
 			goto on_error;
 		}
-		if( libesedb_catalog_read(
-		     internal_file->backup_catalog,
-		     file_io_handle,
-		     internal_file->io_handle,
-		     LIBESEDB_PAGE_NUMBER_CATALOG_BACKUP,
-		     internal_file->pages_vector,
-		     internal_file->pages_cache,
-		     error ) != 1 )
+		if( internal_file->layout_index != NULL )
+		{
+			result = libesedb_catalog_read_layout_index(
+			          internal_file->backup_catalog,
+			          internal_file->layout_index,
+			          LIBESEDB_LAYOUT_INDEX_ENTRY_TYPE_BACKUP_CATALOG_DEFINITION,
+			          internal_file->io_handle->ascii_codepage,
+			          error );
+		}
+		else
+		{
+			result = libesedb_catalog_read(
+			          internal_file->backup_catalog,
+			          file_io_handle,
+			          internal_file->io_handle,
+			          LIBESEDB_PAGE_NUMBER_CATALOG_BACKUP,
+			          error );
+		}
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1273,6 +1349,14 @@ int libesedb_file_open_read(
 	return( 1 );
 
 on_error:
+	if( internal_file->layout_index != NULL )
+	{
+		libesedb_layout_index_free(
+		 &( internal_file->layout_index ),
+		 NULL );
+	}
+	internal_file->io_handle->layout_index = NULL;
+
 	if( internal_file->backup_catalog != NULL )
 	{
 		libesedb_catalog_free(
@@ -1291,16 +1375,10 @@ on_error:
 		 &( internal_file->database ),
 		 NULL );
 	}
-	if( internal_file->pages_cache != NULL )
-	{
-		libfcache_cache_free(
-		 &( internal_file->pages_cache ),
-		 NULL );
-	}
-	if( internal_file->pages_vector != NULL )
+	if( internal_file->io_handle->pages_cache != NULL )
 	{
-		libfdata_vector_free(
-		 &( internal_file->pages_vector ),
+		libesedb_page_cache_free(
+		 &( internal_file->io_handle->pages_cache ),
 		 NULL );
 	}
 	return( -1 );
@@ -1536,16 +1614,23 @@ int libesedb_file_get_page_size(
 	return( 1 );
 }
 
-/* Retrieves the number of tables
+/* Sets the cache limits
+ * The limits are the maximum sizes in bytes of the pages cache, the table and index
+ * values caches and the long values caches, where 0 represents the default size
+ * The pages cache is shared by the file and its tables, the values and long values
+ * limits apply to each table and index
+ * The cache limits must be set before the file is opened
  * Returns 1 if successful or -1 on error
  */
-int libesedb_file_get_number_of_tables(
+int libesedb_file_set_cache_limits(
      libesedb_file_t *file,
-     int *number_of_tables,
+     size64_t maximum_pages_cache_size,
+     size64_t maximum_values_cache_size,
+     size64_t maximum_long_values_cache_size,
      libcerror_error_t **error )
 {
 	libesedb_internal_file_t *internal_file = NULL;
-	static char *function                   = "libesedb_file_get_number_of_tables";
+	static char *function                   = "libesedb_file_set_cache_limits";
 
 	if( file == NULL )
 	{
@@ -1560,54 +1645,46 @@ int libesedb_file_get_number_of_tables(
 	}
 	internal_file = (libesedb_internal_file_t *) file;
 
-	if( internal_file->catalog == NULL )
+	if( internal_file->io_handle == NULL )
 	{
-		if( number_of_tables == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-			 "%s: invalid number of tables.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
 
-			return( -1 );
-		}
-		*number_of_tables = 0;
+		return( -1 );
 	}
-	else
+	if( internal_file->io_handle->pages_cache != NULL )
 	{
-		if( libesedb_catalog_get_number_of_table_definitions(
-		     internal_file->catalog,
-		     number_of_tables,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of tables.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - pages cache already set.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
+	internal_file->io_handle->maximum_pages_cache_size       = maximum_pages_cache_size;
+	internal_file->io_handle->maximum_values_cache_size      = maximum_values_cache_size;
+	internal_file->io_handle->maximum_long_values_cache_size = maximum_long_values_cache_size;
+
 	return( 1 );
 }
 
-/* Retrieves a specific table
+/* Retrieves the cache usage
+ * The usage is the (estimated) size in bytes of the pages in the pages cache
  * Returns 1 if successful or -1 on error
  */
-int libesedb_file_get_table(
+int libesedb_file_get_cache_usage(
      libesedb_file_t *file,
-     int table_entry,
-     libesedb_table_t **table,
+     size64_t *pages_cache_size,
      libcerror_error_t **error )
 {
-	libesedb_internal_file_t *internal_file                = NULL;
-	libesedb_table_definition_t *table_definition          = NULL;
-	libesedb_table_definition_t *template_table_definition = NULL;
-	static char *function                                  = "libesedb_file_get_table";
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_cache_usage";
 
 	if( file == NULL )
 	{
@@ -1622,120 +1699,129 @@ int libesedb_file_get_table(
 	}
 	internal_file = (libesedb_internal_file_t *) file;
 
-	if( table == NULL )
+	if( pages_cache_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid table.",
+		 "%s: invalid pages cache size.",
 		 function );
 
 		return( -1 );
 	}
-	if( *table != NULL )
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid table value already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( libesedb_catalog_get_table_definition_by_index(
-	     internal_file->catalog,
-	     table_entry,
-	     &table_definition,
+	if( libesedb_io_handle_get_pages_cache_size(
+	     internal_file->io_handle,
+	     pages_cache_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve table definition: %d.",
-		 function,
-		 table_entry );
+		 "%s: unable to retrieve pages cache size.",
+		 function );
 
 		return( -1 );
 	}
-	if( table_definition == NULL )
+	return( 1 );
+}
+
+/* Retrieves the pages cache statistics
+ * The statistics are the number of page reads that were satisfied from the pages cache
+ * and the number of page reads that required a read of the file
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_cache_statistics(
+     libesedb_file_t *file,
+     uint64_t *number_of_cache_hits,
+     uint64_t *number_of_cache_misses,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_cache_statistics";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing table definition.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	if( table_definition->table_catalog_definition == NULL )
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid table definition - missing table catalog definition.",
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( table_definition->table_catalog_definition->template_name != NULL )
+	if( number_of_cache_hits == NULL )
 	{
-		if( libesedb_catalog_get_table_definition_by_utf8_name(
-		     internal_file->catalog,
-		     table_definition->table_catalog_definition->template_name,
-		     table_definition->table_catalog_definition->template_name_size,
-		     &template_table_definition,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve template table definition.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of cache hits.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	if( libesedb_table_initialize(
-	     table,
-	     internal_file->file_io_handle,
-	     internal_file->io_handle,
-	     table_definition,
-	     template_table_definition,
-	     error ) != 1 )
+	if( number_of_cache_misses == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create table.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of cache misses.",
 		 function );
 
 		return( -1 );
 	}
+	if( internal_file->io_handle->pages_cache == NULL )
+	{
+		*number_of_cache_hits   = 0;
+		*number_of_cache_misses = 0;
+	}
+	else
+	{
+		*number_of_cache_hits   = internal_file->io_handle->pages_cache->number_of_hits;
+		*number_of_cache_misses = internal_file->io_handle->pages_cache->number_of_misses;
+	}
 	return( 1 );
 }
 
-/* Retrieves the table for the UTF-8 encoded name
- * Returns 1 if successful, 0 if no table could be found or -1 on error
+/* Sets the checksum verification mode
+ * The verification mode applies to pages that are read from the file after the mode was set
+ * Returns 1 if successful or -1 on error
  */
-int libesedb_file_get_table_by_utf8_name(
+int libesedb_file_set_checksum_verification_mode(
      libesedb_file_t *file,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libesedb_table_t **table,
+     int verification_mode,
      libcerror_error_t **error )
 {
-	libesedb_internal_file_t *internal_file                = NULL;
-	libesedb_table_definition_t *table_definition          = NULL;
-	libesedb_table_definition_t *template_table_definition = NULL;
-	static char *function                                  = "libesedb_file_get_table_by_utf8_name";
-	int result                                             = 0;
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_set_checksum_verification_mode";
 
 	if( file == NULL )
 	{
@@ -1750,125 +1836,127 @@ int libesedb_file_get_table_by_utf8_name(
 	}
 	internal_file = (libesedb_internal_file_t *) file;
 
-	if( table == NULL )
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( verification_mode != LIBESEDB_CHECKSUM_VERIFICATION_MODE_NONE )
+	 && ( verification_mode != LIBESEDB_CHECKSUM_VERIFICATION_MODE_FLAG )
+	 && ( verification_mode != LIBESEDB_CHECKSUM_VERIFICATION_MODE_ENFORCE ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid table.",
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported checksum verification mode.",
 		 function );
 
 		return( -1 );
 	}
-	if( *table != NULL )
+	internal_file->io_handle->checksum_verification_mode = verification_mode;
+
+	return( 1 );
+}
+
+/* Retrieves the number of pages with a checksum mismatch
+ * Only pages that were read while checksum verification was enabled are counted
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_number_of_checksum_mismatches(
+     libesedb_file_t *file,
+     uint64_t *number_of_checksum_mismatches,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_number_of_checksum_mismatches";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid table value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	result = libesedb_catalog_get_table_definition_by_utf8_name(
-	          internal_file->catalog,
-	          utf8_string,
-	          utf8_string_length,
-	          &table_definition,
-	          error );
+	internal_file = (libesedb_internal_file_t *) file;
 
-	if( result == -1 )
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve table definition.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	else if( result != 0 )
+	if( number_of_checksum_mismatches == NULL )
 	{
-		if( table_definition == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing table definition.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of checksum mismatches.",
+		 function );
 
-			return( -1 );
-		}
-		if( table_definition->table_catalog_definition == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid table definition - missing table catalog definition.",
-			 function );
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_file->io_handle->file_io_handle_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab file IO handle mutex.",
+		 function );
 
-			return( -1 );
-		}
-		if( table_definition->table_catalog_definition->template_name != NULL )
-		{
-			if( libesedb_catalog_get_table_definition_by_name(
-			     internal_file->catalog,
-			     table_definition->table_catalog_definition->template_name,
-			     table_definition->table_catalog_definition->template_name_size,
-			     &template_table_definition,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve template table definition.",
-				 function );
+		return( -1 );
+	}
+#endif
+	*number_of_checksum_mismatches = internal_file->io_handle->number_of_checksum_mismatches;
 
-				return( -1 );
-			}
-		}
-		if( libesedb_table_initialize(
-		     table,
-		     internal_file->file_io_handle,
-		     internal_file->io_handle,
-		     table_definition,
-		     template_table_definition,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create table.",
-			 function );
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_file->io_handle->file_io_handle_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle mutex.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	return( result );
+#endif
+	return( 1 );
 }
 
-/* Retrieves the table for the UTF-16 encoded name
- * Returns 1 if successful, 0 if no table could be found or -1 on error
+/* Retrieves the number of pages
+ * Returns 1 if successful or -1 on error
  */
-int libesedb_file_get_table_by_utf16_name(
+int libesedb_file_get_number_of_pages(
      libesedb_file_t *file,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
-     libesedb_table_t **table,
+     uint32_t *number_of_pages,
      libcerror_error_t **error )
 {
-	libesedb_internal_file_t *internal_file                = NULL;
-	libesedb_table_definition_t *table_definition          = NULL;
-	libesedb_table_definition_t *template_table_definition = NULL;
-	static char *function                                  = "libesedb_file_get_table_by_utf16_name";
-	int result                                             = 0;
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_number_of_pages";
 
 	if( file == NULL )
 	{
@@ -1883,75 +1971,1473 @@ int libesedb_file_get_table_by_utf16_name(
 	}
 	internal_file = (libesedb_internal_file_t *) file;
 
-	if( table == NULL )
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_pages == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid table.",
+		 "%s: invalid number of pages.",
 		 function );
 
 		return( -1 );
 	}
-	if( *table != NULL )
+	*number_of_pages = internal_file->io_handle->last_page_number;
+
+	return( 1 );
+}
+
+/* Reads a specific page and verifies its checksum and page number
+ * The page is read into the page data, which must be of the page size, without using
+ * the page caches. Since the page is read without changing the offset of the file IO handle
+ * different pages can be verified concurrently
+ * Returns 1 if the page is valid, 0 if not or -1 on error
+ */
+int libesedb_file_verify_page(
+     libesedb_file_t *file,
+     uint32_t page_number,
+     uint8_t *page_data,
+     size_t page_data_size,
+     uint32_t *page_flags,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_verify_page";
+	ssize_t read_count                      = 0;
+	off64_t page_offset                     = 0;
+	int result                              = 0;
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid table value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	result = libesedb_catalog_get_table_definition_by_utf16_name(
-	          internal_file->catalog,
-	          utf16_string,
-	          utf16_string_length,
-	          &table_definition,
-	          error );
+	internal_file = (libesedb_internal_file_t *) file;
 
-	if( result == -1 )
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve table definition.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	else if( result != 0 )
+	if( ( page_number == 0 )
+	 || ( page_number > internal_file->io_handle->last_page_number ) )
 	{
-		if( table_definition == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing table definition.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page number value out of bounds.",
+		 function );
 
-			return( -1 );
-		}
-		if( table_definition->table_catalog_definition == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid table definition - missing table catalog definition.",
-			 function );
+		return( -1 );
+	}
+	if( page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page data.",
+		 function );
 
-			return( -1 );
-		}
-		if( table_definition->table_catalog_definition->template_name != NULL )
-		{
-			if( libesedb_catalog_get_table_definition_by_name(
-			     internal_file->catalog,
-			     table_definition->table_catalog_definition->template_name,
+		return( -1 );
+	}
+	if( page_data_size != (size_t) internal_file->io_handle->page_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page flags.",
+		 function );
+
+		return( -1 );
+	}
+	page_offset = internal_file->io_handle->pages_data_offset
+	            + ( (off64_t) ( page_number - 1 ) * internal_file->io_handle->page_size );
+
+	read_count = libesedb_io_handle_read_buffer_at_offset(
+	              internal_file->io_handle,
+	              internal_file->file_io_handle,
+	              page_data,
+	              page_data_size,
+	              page_offset,
+	              error );
+
+	if( read_count != (ssize_t) page_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page: %" PRIu32 " data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 page_number,
+		 page_offset,
+		 page_offset );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_page_header_t *) page_data )->page_flags,
+	 *page_flags );
+
+	result = libesedb_page_verify_checksum(
+	          internal_file->io_handle,
+	          page_data,
+	          page_data_size,
+	          page_number,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify page: %" PRIu32 " checksum.",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		result = libesedb_page_verify_page_number(
+		          internal_file->io_handle,
+		          page_data,
+		          page_data_size,
+		          page_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify page: %" PRIu32 " page number.",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Sets the filename of the layout index
+ * The layout index is read when the file is opened and used, instead of reading
+ * the catalog and page trees, if it matches the file header
+ * The layout index filename must be set before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_set_layout_index_filename(
+     libesedb_file_t *file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle        = NULL;
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_set_layout_index_filename";
+	size_t filename_length                  = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create layout index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in layout index file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( internal_file->layout_index_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->layout_index_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free layout index file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_file->layout_index_file_io_handle = file_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Sets the filename of the layout index
+ * The layout index filename must be set before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_set_layout_index_filename_wide(
+     libesedb_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle        = NULL;
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_set_layout_index_filename_wide";
+	size_t filename_length                  = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create layout index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in layout index file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( internal_file->layout_index_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->layout_index_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free layout index file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_file->layout_index_file_io_handle = file_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Writes the layout index of an opened file
+ * The layout index contains the catalog definitions and the leaf pages of the table,
+ * long value and index page trees
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_write_layout_index(
+     libesedb_file_t *file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle        = NULL;
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_write_layout_index";
+	size_t filename_length                  = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create layout index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in layout index file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libesedb_file_write_layout_index_file_io_handle(
+	     internal_file,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write layout index: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free layout index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Writes the layout index of an opened file
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_write_layout_index_wide(
+     libesedb_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle        = NULL;
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_write_layout_index_wide";
+	size_t filename_length                  = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create layout index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in layout index file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libesedb_file_write_layout_index_file_io_handle(
+	     internal_file,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write layout index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free layout index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Writes the layout index of an opened file using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_write_layout_index_file_io_handle(
+     libesedb_internal_file_t *internal_file,
+     libbfio_handle_t *layout_index_file_io_handle,
+     libcerror_error_t **error )
+{
+	libesedb_layout_index_t *layout_index = NULL;
+	libesedb_page_tree_t *page_tree       = NULL;
+	static char *function                 = "libesedb_file_write_layout_index_file_io_handle";
+	int file_io_handle_is_open            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_layout_index_initialize(
+	     &layout_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create layout index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_layout_index_set_database_values(
+	     layout_index,
+	     internal_file->io_handle->page_size,
+	     internal_file->io_handle->last_page_number,
+	     internal_file->io_handle->database_time,
+	     internal_file->io_handle->database_signature,
+	     28,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set database values in layout index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_initialize(
+	     &page_tree,
+	     internal_file->io_handle,
+	     0,
+	     NULL,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_append_layout_index_definitions(
+	     page_tree,
+	     internal_file->file_io_handle,
+	     LIBESEDB_PAGE_NUMBER_CATALOG,
+	     LIBESEDB_LAYOUT_INDEX_ENTRY_TYPE_CATALOG_DEFINITION,
+	     layout_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append catalog definitions to layout index.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->backup_catalog != NULL )
+	{
+		if( libesedb_page_tree_append_layout_index_definitions(
+		     page_tree,
+		     internal_file->file_io_handle,
+		     LIBESEDB_PAGE_NUMBER_CATALOG_BACKUP,
+		     LIBESEDB_LAYOUT_INDEX_ENTRY_TYPE_BACKUP_CATALOG_DEFINITION,
+		     layout_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append backup catalog definitions to layout index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_catalog_append_layout_index_trees(
+	     internal_file->catalog,
+	     page_tree,
+	     internal_file->file_io_handle,
+	     layout_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append catalog page trees to layout index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_free(
+	     &page_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     layout_index_file_io_handle,
+	     LIBBFIO_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open layout index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle_is_open = 1;
+
+	if( libesedb_layout_index_write_file_io_handle(
+	     layout_index,
+	     layout_index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write layout index.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle_is_open = 0;
+
+	if( libbfio_handle_close(
+	     layout_index_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close layout index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_layout_index_free(
+	     &layout_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free layout index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle_is_open != 0 )
+	{
+		libbfio_handle_close(
+		 layout_index_file_io_handle,
+		 NULL );
+	}
+	if( page_tree != NULL )
+	{
+		libesedb_page_tree_free(
+		 &page_tree,
+		 NULL );
+	}
+	if( layout_index != NULL )
+	{
+		libesedb_layout_index_free(
+		 &layout_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the layout index of the file
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libesedb_file_read_layout_index(
+     libesedb_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function      = "libesedb_file_read_layout_index";
+	int file_io_handle_is_open = 0;
+	int result                 = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->layout_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - layout index already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->layout_index_file_io_handle == NULL )
+	{
+		return( 0 );
+	}
+	if( libesedb_layout_index_initialize(
+	     &( internal_file->layout_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create layout index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     internal_file->layout_index_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open layout index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle_is_open = 1;
+
+	if( libesedb_layout_index_read_file_io_handle(
+	     internal_file->layout_index,
+	     internal_file->layout_index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read layout index.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle_is_open = 0;
+
+	if( libbfio_handle_close(
+	     internal_file->layout_index_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close layout index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* A layout index of a different or modified database is ignored
+	 */
+	result = libesedb_layout_index_compare_database_values(
+	          internal_file->layout_index,
+	          internal_file->io_handle->page_size,
+	          internal_file->io_handle->last_page_number,
+	          internal_file->io_handle->database_time,
+	          internal_file->io_handle->database_signature,
+	          28,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare layout index database values.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libesedb_layout_index_free(
+		     &( internal_file->layout_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free layout index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle_is_open != 0 )
+	{
+		libbfio_handle_close(
+		 internal_file->layout_index_file_io_handle,
+		 NULL );
+	}
+	if( internal_file->layout_index != NULL )
+	{
+		libesedb_layout_index_free(
+		 &( internal_file->layout_index ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of tables
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_number_of_tables(
+     libesedb_file_t *file,
+     int *number_of_tables,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_number_of_tables";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->catalog == NULL )
+	{
+		if( number_of_tables == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid number of tables.",
+			 function );
+
+			return( -1 );
+		}
+		*number_of_tables = 0;
+	}
+	else
+	{
+		if( libesedb_catalog_get_number_of_table_definitions(
+		     internal_file->catalog,
+		     number_of_tables,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of tables.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_table(
+     libesedb_file_t *file,
+     int table_entry,
+     libesedb_table_t **table,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file                = NULL;
+	libesedb_table_definition_t *table_definition          = NULL;
+	libesedb_table_definition_t *template_table_definition = NULL;
+	static char *function                                  = "libesedb_file_get_table";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_get_table_definition_by_index(
+	     internal_file->catalog,
+	     table_entry,
+	     &table_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve table definition: %d.",
+		 function,
+		 table_entry );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->table_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table definition - missing table catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->table_catalog_definition->template_name != NULL )
+	{
+		if( libesedb_catalog_get_table_definition_by_utf8_name(
+		     internal_file->catalog,
+		     table_definition->table_catalog_definition->template_name,
+		     table_definition->table_catalog_definition->template_name_size,
+		     &template_table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve template table definition.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libesedb_table_initialize(
+	     table,
+	     internal_file->file_io_handle,
+	     internal_file->io_handle,
+	     table_definition,
+	     template_table_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the table for the UTF-8 encoded name
+ * Returns 1 if successful, 0 if no table could be found or -1 on error
+ */
+int libesedb_file_get_table_by_utf8_name(
+     libesedb_file_t *file,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libesedb_table_t **table,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file                = NULL;
+	libesedb_table_definition_t *table_definition          = NULL;
+	libesedb_table_definition_t *template_table_definition = NULL;
+	static char *function                                  = "libesedb_file_get_table_by_utf8_name";
+	int result                                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_catalog_get_table_definition_by_utf8_name(
+	          internal_file->catalog,
+	          utf8_string,
+	          utf8_string_length,
+	          &table_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve table definition.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( table_definition == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing table definition.",
+			 function );
+
+			return( -1 );
+		}
+		if( table_definition->table_catalog_definition == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid table definition - missing table catalog definition.",
+			 function );
+
+			return( -1 );
+		}
+		if( table_definition->table_catalog_definition->template_name != NULL )
+		{
+			if( libesedb_catalog_get_table_definition_by_name(
+			     internal_file->catalog,
+			     table_definition->table_catalog_definition->template_name,
+			     table_definition->table_catalog_definition->template_name_size,
+			     &template_table_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve template table definition.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( libesedb_table_initialize(
+		     table,
+		     internal_file->file_io_handle,
+		     internal_file->io_handle,
+		     table_definition,
+		     template_table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the table for the UTF-16 encoded name
+ * Returns 1 if successful, 0 if no table could be found or -1 on error
+ */
+int libesedb_file_get_table_by_utf16_name(
+     libesedb_file_t *file,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libesedb_table_t **table,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file                = NULL;
+	libesedb_table_definition_t *table_definition          = NULL;
+	libesedb_table_definition_t *template_table_definition = NULL;
+	static char *function                                  = "libesedb_file_get_table_by_utf16_name";
+	int result                                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_catalog_get_table_definition_by_utf16_name(
+	          internal_file->catalog,
+	          utf16_string,
+	          utf16_string_length,
+	          &table_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve table definition.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( table_definition == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing table definition.",
+			 function );
+
+			return( -1 );
+		}
+		if( table_definition->table_catalog_definition == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid table definition - missing table catalog definition.",
+			 function );
+
+			return( -1 );
+		}
+		if( table_definition->table_catalog_definition->template_name != NULL )
+		{
+			if( libesedb_catalog_get_table_definition_by_name(
+			     internal_file->catalog,
+			     table_definition->table_catalog_definition->template_name,
 			     table_definition->table_catalog_definition->template_name_size,
 			     &template_table_definition,
 			     error ) != 1 )
@@ -1960,30 +3446,682 @@ int libesedb_file_get_table_by_utf16_name(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve template table definition.",
+				 "%s: unable to retrieve template table definition.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( libesedb_table_initialize(
+		     table,
+		     internal_file->file_io_handle,
+		     internal_file->io_handle,
+		     table_definition,
+		     template_table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Scans the records of all the tables in a single pass over the file
+ * The pages are read front to back and every leaf page is assigned to a table by
+ * its father data page (FDP) object identifier and, when the table has a space tree,
+ * by the extents of the pages owned by the table. The records are therefore not
+ * returned in key order and the records of different tables are interleaved
+ * The record callback function is called for every record with the table, its entry,
+ * the record and the callback data. The record is freed after the callback function
+ * returns. The callback function should return 1 to continue the scan, 0 to stop the
+ * scan or -1 on error
+ * Returns 1 if successful, 0 if the scan was stopped or -1 on error
+ */
+int libesedb_file_scan_tables(
+     libesedb_file_t *file,
+     int (*record_callback_function)(
+            libesedb_table_t *table,
+            int table_entry,
+            libesedb_record_t *record,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *data_definition = NULL;
+	libesedb_internal_file_t *internal_file     = NULL;
+	libesedb_internal_table_t *internal_table   = NULL;
+	libesedb_page_t *page                       = NULL;
+	libesedb_page_tree_t *page_tree             = NULL;
+	libesedb_record_t *record                   = NULL;
+	libesedb_table_t **tables                   = NULL;
+	uint32_t **tables_extents                   = NULL;
+	uint32_t *extents                           = NULL;
+	int *tables_number_of_extents               = NULL;
+	static char *function                       = "libesedb_file_scan_tables";
+	off64_t page_offset                         = 0;
+	uint32_t number_of_pages                    = 0;
+	uint32_t page_number                        = 0;
+	uint32_t read_ahead_page_number             = 0;
+	uint16_t data_offset                        = 0;
+	uint16_t data_size                          = 0;
+	uint16_t number_of_page_values              = 0;
+	uint16_t page_value_index                   = 0;
+	int extent_index                            = 0;
+	int is_owned                                = 0;
+	int lower_extent_index                      = 0;
+	int number_of_tables                        = 0;
+	int result                                  = 0;
+	int scan_result                             = 1;
+	int table_entry                             = 0;
+	int upper_extent_index                      = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_get_number_of_table_definitions(
+	     internal_file->catalog,
+	     &number_of_tables,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of tables.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_tables <= 0 )
+	{
+		return( 1 );
+	}
+	if( (size_t) number_of_tables > ( (size_t) SSIZE_MAX / sizeof( uint32_t * ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of tables value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	tables = (libesedb_table_t **) memory_allocate(
+	                                sizeof( libesedb_table_t * ) * number_of_tables );
+
+	tables_extents = (uint32_t **) memory_allocate(
+	                                sizeof( uint32_t * ) * number_of_tables );
+
+	tables_number_of_extents = (int *) memory_allocate(
+	                                    sizeof( int ) * number_of_tables );
+
+	if( ( tables == NULL )
+	 || ( tables_extents == NULL )
+	 || ( tables_number_of_extents == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create tables.",
+		 function );
+
+		goto on_error;
+	}
+	for( table_entry = 0;
+	     table_entry < number_of_tables;
+	     table_entry++ )
+	{
+		tables[ table_entry ]                   = NULL;
+		tables_extents[ table_entry ]           = NULL;
+		tables_number_of_extents[ table_entry ] = 0;
+	}
+	for( table_entry = 0;
+	     table_entry < number_of_tables;
+	     table_entry++ )
+	{
+		if( libesedb_file_get_table(
+		     file,
+		     table_entry,
+		     &( tables[ table_entry ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table: %d.",
+			 function,
+			 table_entry );
+
+			goto on_error;
+		}
+		internal_table = (libesedb_internal_table_t *) tables[ table_entry ];
+
+		/* Without owned page extents the pages of the table are determined
+		 * by the FDP object identifier only
+		 */
+		result = libesedb_page_tree_get_owned_page_extents(
+		          internal_table->table_page_tree,
+		          internal_file->file_io_handle,
+		          internal_table->table_definition->table_catalog_definition->father_data_page_number,
+		          &( tables_extents[ table_entry ] ),
+		          &( tables_number_of_extents[ table_entry ] ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve owned page extents of table: %d.",
+			 function,
+			 table_entry );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_data_definition_initialize(
+	     &data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data definition.",
+		 function );
+
+		goto on_error;
+	}
+	/* The pages are retrieved by the page tree of the first table
+	 * since all the tables share the pages vector and cache of the file
+	 */
+	page_tree = ( (libesedb_internal_table_t *) tables[ 0 ] )->table_page_tree;
+
+	for( page_number = 1;
+	     page_number <= internal_file->io_handle->last_page_number;
+	     page_number++ )
+	{
+		if( internal_file->io_handle->abort != 0 )
+		{
+			scan_result = 0;
+
+			break;
+		}
+		if( ( internal_file->io_handle->mapped_data == NULL )
+		 && ( page_number > read_ahead_page_number ) )
+		{
+			number_of_pages = internal_file->io_handle->last_page_number - page_number + 1;
+
+			if( number_of_pages > LIBESEDB_READ_AHEAD_MAXIMUM_NUMBER_OF_PAGES )
+			{
+				number_of_pages = LIBESEDB_READ_AHEAD_MAXIMUM_NUMBER_OF_PAGES;
+			}
+			if( number_of_pages > 1 )
+			{
+				if( libesedb_io_handle_read_pages(
+				     internal_file->io_handle,
+				     internal_file->file_io_handle,
+				     page_number,
+				     number_of_pages,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read %" PRIu32 " pages from page: %" PRIu32 ".",
+					 function,
+					 number_of_pages,
+					 page_number );
+
+					goto on_error;
+				}
+			}
+			read_ahead_page_number = page_number + number_of_pages - 1;
+		}
+		/* Determine the table that owns the page from the owned page extents
+		 */
+		is_owned = 0;
+
+		for( table_entry = 0;
+		     table_entry < number_of_tables;
+		     table_entry++ )
+		{
+			extents = tables_extents[ table_entry ];
+
+			if( extents == NULL )
+			{
+				continue;
+			}
+			lower_extent_index = 0;
+			upper_extent_index = tables_number_of_extents[ table_entry ];
+
+			while( lower_extent_index < upper_extent_index )
+			{
+				extent_index = lower_extent_index + ( ( upper_extent_index - lower_extent_index ) / 2 );
+
+				if( page_number < extents[ extent_index * 2 ] )
+				{
+					upper_extent_index = extent_index;
+				}
+				else if( ( page_number - extents[ extent_index * 2 ] ) >= extents[ ( extent_index * 2 ) + 1 ] )
+				{
+					lower_extent_index = extent_index + 1;
+				}
+				else
+				{
+					is_owned = 1;
+
+					break;
+				}
+			}
+			if( is_owned != 0 )
+			{
+				break;
+			}
+		}
+		if( libesedb_page_tree_get_page(
+		     page_tree,
+		     internal_file->file_io_handle,
+		     page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			if( is_owned != 0 )
+			{
+				goto on_error;
+			}
+			/* Pages that are not owned by a table, such as unused pages,
+			 * are not required to be readable
+			 */
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			continue;
+		}
+		if( ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) == 0 )
+		 || ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
+		 || ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_SPACE_TREE ) != 0 )
+		 || ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_INDEX ) != 0 )
+		 || ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LONG_VALUE ) != 0 ) )
+		{
+			if( libesedb_page_release(
+			     internal_file->io_handle,
+			     &page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release page.",
+				 function );
+
+				goto on_error;
+			}
+			continue;
+		}
+		if( is_owned != 0 )
+		{
+			internal_table = (libesedb_internal_table_t *) tables[ table_entry ];
+
+			if( page->father_data_page_object_identifier != internal_table->table_page_tree->object_identifier )
+			{
+				if( libesedb_page_release(
+				     internal_file->io_handle,
+				     &page,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to release page.",
+					 function );
+
+					goto on_error;
+				}
+				continue;
+			}
+		}
+		else
+		{
+			for( table_entry = 0;
+			     table_entry < number_of_tables;
+			     table_entry++ )
+			{
+				if( tables_extents[ table_entry ] != NULL )
+				{
+					continue;
+				}
+				internal_table = (libesedb_internal_table_t *) tables[ table_entry ];
+
+				if( page->father_data_page_object_identifier == internal_table->table_page_tree->object_identifier )
+				{
+					break;
+				}
+			}
+			if( table_entry >= number_of_tables )
+			{
+				if( libesedb_page_release(
+				     internal_file->io_handle,
+				     &page,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to release page.",
+					 function );
+
+					goto on_error;
+				}
+				continue;
+			}
+		}
+		if( libesedb_page_get_number_of_values(
+		     page,
+		     &number_of_page_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of page: %" PRIu32 " values.",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		page_offset  = page_number - 1;
+		page_offset *= internal_file->io_handle->page_size;
+
+		/* The first page value is the page tree header
+		 */
+		for( page_value_index = 1;
+		     page_value_index < number_of_page_values;
+		     page_value_index++ )
+		{
+			result = libesedb_page_get_value_data_range(
+			          page,
+			          page_value_index,
+			          NULL,
+			          &data_offset,
+			          &data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page: %" PRIu32 " value: %" PRIu16 " data range.",
+				 function,
+				 page_number,
+				 page_value_index );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				continue;
+			}
+			data_definition->page_offset      = page_offset;
+			data_definition->page_number      = page_number;
+			data_definition->page_value_index = page_value_index;
+			data_definition->data_offset      = data_offset;
+			data_definition->data_size        = data_size;
+
+			if( libesedb_record_initialize(
+			     &record,
+			     internal_table->file_io_handle,
+			     internal_table->io_handle,
+			     internal_table->table_definition,
+			     internal_table->template_table_definition,
+			     internal_table->column_mask,
+			     internal_table->column_mask_size,
+			     data_definition,
+			     internal_table->long_values_tree,
+			     internal_table->long_values_cache,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create record.",
 				 function );
 
-				return( -1 );
+				goto on_error;
+			}
+			result = record_callback_function(
+			          tables[ table_entry ],
+			          table_entry,
+			          record,
+			          callback_data,
+			          error );
+
+			if( libesedb_record_free(
+			     &record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record.",
+				 function );
+
+				goto on_error;
+			}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: record callback function failed for table: %d.",
+				 function,
+				 table_entry );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				scan_result = 0;
+
+				break;
 			}
 		}
-		if( libesedb_table_initialize(
-		     table,
-		     internal_file->file_io_handle,
+		if( libesedb_page_release(
 		     internal_file->io_handle,
-		     table_definition,
-		     template_table_definition,
+		     &page,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create table.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
 			 function );
 
-			return( -1 );
+			goto on_error;
+		}
+		if( scan_result == 0 )
+		{
+			break;
 		}
 	}
-	return( result );
+	if( libesedb_data_definition_free(
+	     &data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free data definition.",
+		 function );
+
+		goto on_error;
+	}
+	for( table_entry = 0;
+	     table_entry < number_of_tables;
+	     table_entry++ )
+	{
+		if( tables_extents[ table_entry ] != NULL )
+		{
+			memory_free(
+			 tables_extents[ table_entry ] );
+
+			tables_extents[ table_entry ] = NULL;
+		}
+		if( libesedb_table_free(
+		     &( tables[ table_entry ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free table: %d.",
+			 function,
+			 table_entry );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 tables_number_of_extents );
+
+	memory_free(
+	 tables_extents );
+
+	memory_free(
+	 tables );
+
+	return( scan_result );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 internal_file->io_handle,
+		 &page,
+		 NULL );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
+	if( ( tables != NULL )
+	 && ( tables_extents != NULL )
+	 && ( tables_number_of_extents != NULL ) )
+	{
+		for( table_entry = 0;
+		     table_entry < number_of_tables;
+		     table_entry++ )
+		{
+			if( ( tables_extents != NULL )
+			 && ( tables_extents[ table_entry ] != NULL ) )
+			{
+				memory_free(
+				 tables_extents[ table_entry ] );
+			}
+			if( tables[ table_entry ] != NULL )
+			{
+				libesedb_table_free(
+				 &( tables[ table_entry ] ),
+				 NULL );
+			}
+		}
+	}
+	if( tables != NULL )
+	{
+		memory_free(
+		 tables );
+	}
+	if( tables_number_of_extents != NULL )
+	{
+		memory_free(
+		 tables_number_of_extents );
+	}
+	if( tables_extents != NULL )
+	{
+		memory_free(
+		 tables_extents );
+	}
+	return( -1 );
 }
 
@@ -29,10 +29,9 @@
 #include "libesedb_database.h"
 #include "libesedb_extern.h"
 #include "libesedb_io_handle.h"
+#include "libesedb_layout_index.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
-#include "libesedb_libfcache.h"
-#include "libesedb_libfdata.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -58,14 +57,6 @@ struct libesedb_internal_file
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
-	/* The pages vector
-	 */
-	libfdata_vector_t *pages_vector;
-
-	/* The pages cache
-	 */
-	libfcache_cache_t *pages_cache;
-
 	/* The database
 	 */
 	libesedb_database_t *database;
@@ -77,6 +68,14 @@ struct libesedb_internal_file
 	/* The backup catalog
 	 */
 	libesedb_catalog_t *backup_catalog;
+
+	/* The layout index file IO handle
+	 */
+	libbfio_handle_t *layout_index_file_io_handle;
+
+	/* The layout index
+	 */
+	libesedb_layout_index_t *layout_index;
 };
 
 LIBESEDB_EXTERN \
@@ -155,6 +154,95 @@ int libesedb_file_get_page_size(
      uint32_t *page_size,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_file_set_cache_limits(
+     libesedb_file_t *file,
+     size64_t maximum_pages_cache_size,
+     size64_t maximum_values_cache_size,
+     size64_t maximum_long_values_cache_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_get_cache_usage(
+     libesedb_file_t *file,
+     size64_t *pages_cache_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_get_cache_statistics(
+     libesedb_file_t *file,
+     uint64_t *number_of_cache_hits,
+     uint64_t *number_of_cache_misses,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_set_checksum_verification_mode(
+     libesedb_file_t *file,
+     int verification_mode,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_get_number_of_checksum_mismatches(
+     libesedb_file_t *file,
+     uint64_t *number_of_checksum_mismatches,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_get_number_of_pages(
+     libesedb_file_t *file,
+     uint32_t *number_of_pages,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_verify_page(
+     libesedb_file_t *file,
+     uint32_t page_number,
+     uint8_t *page_data,
+     size_t page_data_size,
+     uint32_t *page_flags,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_set_layout_index_filename(
+     libesedb_file_t *file,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBESEDB_EXTERN \
+int libesedb_file_set_layout_index_filename_wide(
+     libesedb_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif
+
+LIBESEDB_EXTERN \
+int libesedb_file_write_layout_index(
+     libesedb_file_t *file,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBESEDB_EXTERN \
+int libesedb_file_write_layout_index_wide(
+     libesedb_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif
+
+int libesedb_file_write_layout_index_file_io_handle(
+     libesedb_internal_file_t *internal_file,
+     libbfio_handle_t *layout_index_file_io_handle,
+     libcerror_error_t **error );
+
+int libesedb_file_read_layout_index(
+     libesedb_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_file_get_number_of_tables(
      libesedb_file_t *file,
@@ -184,6 +272,18 @@ int libesedb_file_get_table_by_utf16_name(
      libesedb_table_t **table,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_file_scan_tables(
+     libesedb_file_t *file,
+     int (*record_callback_function)(
+            libesedb_table_t *table,
+            int table_entry,
+            libesedb_record_t *record,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -34,6 +34,7 @@
 #include "libesedb_libcnotify.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_page.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_record.h"
 #include "libesedb_types.h"
@@ -49,10 +50,7 @@ int libesedb_index_initialize(
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
      libesedb_catalog_definition_t *index_catalog_definition,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
-     libfdata_vector_t *long_values_pages_vector,
-     libfcache_cache_t *long_values_pages_cache,
+     libesedb_page_tree_t *table_page_tree,
      libfdata_btree_t *table_values_tree,
      libfcache_cache_t *table_values_cache,
      libfdata_btree_t *long_values_tree,
@@ -63,6 +61,7 @@ int libesedb_index_initialize(
 	libesedb_page_tree_t *index_page_tree     = NULL;
 	static char *function                     = "libesedb_index_initialize";
 	off64_t node_data_offset                  = 0;
+	int maximum_number_of_cache_entries       = 0;
 
 	if( index == NULL )
 	{
@@ -144,8 +143,6 @@ int libesedb_index_initialize(
 	if( libesedb_page_tree_initialize(
 	     &index_page_tree,
 	     io_handle,
-	     pages_vector,
-	     pages_cache,
 	     index_catalog_definition->identifier,
 	     NULL,
 	     NULL,
@@ -185,9 +182,27 @@ int libesedb_index_initialize(
 
 		goto on_error;
 	}
+	internal_index->index_page_tree = index_page_tree;
+
+	if( libesedb_io_handle_get_maximum_number_of_cache_entries(
+	     io_handle,
+	     LIBESEDB_CACHE_TYPE_VALUES,
+	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_INDEX_VALUES,
+	     &maximum_number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum number of index values cache entries.",
+		 function );
+
+		goto on_error;
+	}
 	if( libfcache_cache_initialize(
 	     &( internal_index->index_values_cache ),
-	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_INDEX_VALUES,
+	     maximum_number_of_cache_entries,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -224,10 +239,7 @@ int libesedb_index_initialize(
 	internal_index->table_definition          = table_definition;
 	internal_index->template_table_definition = template_table_definition;
 	internal_index->index_catalog_definition  = index_catalog_definition;
-	internal_index->pages_vector              = pages_vector;
-	internal_index->pages_cache               = pages_cache;
-	internal_index->long_values_pages_vector  = long_values_pages_vector;
-	internal_index->long_values_pages_cache   = long_values_pages_cache;
+	internal_index->table_page_tree           = table_page_tree;
 	internal_index->table_values_tree         = table_values_tree;
 	internal_index->table_values_cache        = table_values_cache;
 	internal_index->long_values_tree          = long_values_tree;
@@ -286,7 +298,7 @@ int libesedb_index_free(
 		*index         = NULL;
 
 		/* The io_handle, file_io_handle, table_definition, template_table_definition,
-		 * index_catalog_definition, pages_vector, pages_cache, table_values_tree,
+		 * index_catalog_definition, table_values_tree,
 		 * table_values_cache, long_values_tree and long_values_cache references are freed elsewhere
 		 */
 		if( libfdata_btree_free(
@@ -626,22 +638,20 @@ int libesedb_index_get_number_of_records(
 	return( 1 );
 }
 
-/* Retrieves a specific record
+/* Counts the number of records in the index
+ * The records are counted from the page tags of the leaf pages, without creating
+ * a data definition for every record. If LIBESEDB_COUNT_FLAG_ESTIMATE is set the number
+ * of records is estimated from the number of leaf pages and a sample of the leaf pages
  * Returns 1 if successful or -1 on error
  */
-int libesedb_index_get_record(
+int libesedb_index_count_records(
      libesedb_index_t *index,
-     int record_entry,
-     libesedb_record_t **record,
+     uint8_t flags,
+     uint64_t *number_of_records,
      libcerror_error_t **error )
 {
-	libesedb_data_definition_t *index_data_definition  = NULL;
-	libesedb_data_definition_t *record_data_definition = NULL;
-	libesedb_internal_index_t *internal_index          = NULL;
-	libesedb_key_t *key                                = NULL;
-	uint8_t *index_data                                = NULL;
-	static char *function                              = "libesedb_index_get_record";
-	size_t index_data_size                             = 0;
+	libesedb_internal_index_t *internal_index = NULL;
+	static char *function                     = "libesedb_index_count_records";
 
 	if( index == NULL )
 	{
@@ -656,65 +666,62 @@ int libesedb_index_get_record(
 	}
 	internal_index = (libesedb_internal_index_t *) index;
 
-	if( record == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
-		 function );
-
-		return( -1 );
-	}
-	if( *record != NULL )
+	if( internal_index->index_catalog_definition == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid record value already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing index catalog definition.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfdata_btree_get_leaf_value_by_index(
-	     internal_index->index_values_tree,
-	     (intptr_t *) internal_index->file_io_handle,
-	     internal_index->index_values_cache,
-	     record_entry,
-	     (intptr_t **) &index_data_definition,
-	     0,
+	if( libesedb_page_tree_count_leaf_values(
+	     internal_index->index_page_tree,
+	     internal_index->file_io_handle,
+	     internal_index->index_catalog_definition->father_data_page_number,
+	     flags,
+	     number_of_records,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve leaf value: %d from index values tree.",
-		 function,
-		 record_entry );
+		 "%s: unable to count leaf values in index page tree.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libesedb_data_definition_read_data(
-	     index_data_definition,
-	     internal_index->file_io_handle,
-	     internal_index->io_handle,
-	     internal_index->pages_vector,
-	     internal_index->pages_cache,
-	     &index_data,
-	     &index_data_size,
-	     error ) != 1 )
+	return( 1 );
+}
+
+/* Reads the record referenced by index data
+ * The index data contains the key of the record in the table values tree
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_read_record(
+     libesedb_internal_index_t *internal_index,
+     uint8_t *index_data,
+     size_t index_data_size,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *record_data_definition = NULL;
+	libesedb_key_t *key                                = NULL;
+	static char *function                              = "libesedb_index_read_record";
+
+	if( internal_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read index data definition data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( libesedb_key_initialize(
 	     &key,
@@ -785,10 +792,8 @@ int libesedb_index_get_record(
 	     internal_index->io_handle,
 	     internal_index->table_definition,
 	     internal_index->template_table_definition,
-	     internal_index->pages_vector,
-	     internal_index->pages_cache,
-	     internal_index->long_values_pages_vector,
-	     internal_index->long_values_pages_cache,
+	     NULL,
+	     0,
 	     record_data_definition,
 	     internal_index->long_values_tree,
 	     internal_index->long_values_cache,
@@ -815,3 +820,134 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves a specific record
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_get_record(
+     libesedb_index_t *index,
+     int record_entry,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *index_data_definition = NULL;
+	libesedb_internal_index_t *internal_index         = NULL;
+	libesedb_page_t *index_page                       = NULL;
+	uint8_t *index_data                               = NULL;
+	static char *function                             = "libesedb_index_get_record";
+	size_t index_data_size                            = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libesedb_internal_index_t *) index;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_btree_get_leaf_value_by_index(
+	     internal_index->index_values_tree,
+	     (intptr_t *) internal_index->file_io_handle,
+	     internal_index->index_values_cache,
+	     record_entry,
+	     (intptr_t **) &index_data_definition,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value: %d from index values tree.",
+		 function,
+		 record_entry );
+
+		return( -1 );
+	}
+	if( libesedb_data_definition_read_data(
+	     index_data_definition,
+	     internal_index->file_io_handle,
+	     internal_index->io_handle,
+	     &index_page,
+	     &index_data,
+	     &index_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index data definition data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_index_read_record(
+	     internal_index,
+	     index_data,
+	     index_data_size,
+	     record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_release(
+	     internal_index->io_handle,
+	     &index_page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release index data page.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( index_page != NULL )
+	{
+		libesedb_page_release(
+		 internal_index->io_handle,
+		 &index_page,
+		 NULL );
+	}
+	return( -1 );
+}
+
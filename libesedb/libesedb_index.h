@@ -32,6 +32,7 @@
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_page_tree.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
 
@@ -63,21 +64,9 @@ struct libesedb_internal_index
 	 */
 	libesedb_catalog_definition_t *index_catalog_definition;
 
-	/* The pages vector
+	/* The table page tree
 	 */
-	libfdata_vector_t *pages_vector;
-
-	/* The pages cache
-	 */
-	libfcache_cache_t *pages_cache;
-
-	/* The long values pages vector
-	 */
-	libfdata_vector_t *long_values_pages_vector;
-
-	/* The long values pages cache
-	 */
-	libfcache_cache_t *long_values_pages_cache;
+	libesedb_page_tree_t *table_page_tree;
 
 	/* The table values tree
 	 */
@@ -95,6 +84,10 @@ struct libesedb_internal_index
 	 */
 	libfcache_cache_t *long_values_cache;
 
+	/* The index page tree, owned by the index values tree
+	 */
+	libesedb_page_tree_t *index_page_tree;
+
 	/* The table values (data) tree
 	 */
 	libfdata_btree_t *index_values_tree;
@@ -111,10 +104,7 @@ int libesedb_index_initialize(
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
      libesedb_catalog_definition_t *index_catalog_definition,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
-     libfdata_vector_t *long_values_pages_vector,
-     libfcache_cache_t *long_values_pages_cache,
+     libesedb_page_tree_t *table_page_tree,
      libfdata_btree_t *table_values_tree,
      libfcache_cache_t *table_values_cache,
      libfdata_btree_t *long_values_tree,
@@ -164,6 +154,20 @@ int libesedb_index_get_number_of_records(
      int *number_of_records,
      libcerror_error_t **error );
 
+int libesedb_index_read_record(
+     libesedb_internal_index_t *internal_index,
+     uint8_t *index_data,
+     size_t index_data_size,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_count_records(
+     libesedb_index_t *index,
+     uint8_t flags,
+     uint64_t *number_of_records,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_index_get_record(
      libesedb_index_t *index,
@@ -0,0 +1,2311 @@
+/*
+ * Index cursor functions
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libesedb_data_definition.h"
+#include "libesedb_definitions.h"
+#include "libesedb_index.h"
+#include "libesedb_index_cursor.h"
+#include "libesedb_key.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libfdata.h"
+#include "libesedb_page.h"
+#include "libesedb_page_tree.h"
+#include "libesedb_record.h"
+#include "libesedb_types.h"
+
+/* Seeks a key in the index and creates an index cursor
+ * The cursor is positioned before the first index value with a key that is greater than or equal to the key data
+ * or, if LIBESEDB_SEEK_FLAG_GREATER is set, greater than the key data
+ * The key data contains the (normalized) key as it is stored in the index page tree,
+ * where empty key data positions the cursor before the first index value
+ * The cursor references the index and should be closed before the index is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_seek(
+     libesedb_index_t *index,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     uint8_t flags,
+     libesedb_index_cursor_t **cursor,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_cursor_t *internal_cursor = NULL;
+	libesedb_internal_index_t *internal_index         = NULL;
+	libesedb_page_t *page                             = NULL;
+	const uint8_t *common_key_data                    = NULL;
+	const uint8_t *local_key_data                     = NULL;
+	static char *function                             = "libesedb_index_seek";
+	uint32_t leaf_page_number                         = 0;
+	uint16_t common_key_size                          = 0;
+	uint16_t leaf_value_index                         = 0;
+	uint16_t local_key_size                           = 0;
+	uint8_t is_exact_match                            = 0;
+	int compare_result                                = 0;
+	int result                                        = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libesedb_internal_index_t *) index;
+
+	if( internal_index->index_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing index catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_data == NULL )
+	 && ( key_data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( LIBESEDB_SEEK_FLAG_GREATER ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = memory_allocate_structure(
+	                   libesedb_internal_index_cursor_t );
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_cursor,
+	     0,
+	     sizeof( libesedb_internal_index_cursor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cursor.",
+		 function );
+
+		memory_free(
+		 internal_cursor );
+
+		return( -1 );
+	}
+	internal_cursor->internal_index = internal_index;
+
+	result = libesedb_page_tree_seek_leaf_value(
+	          internal_index->index_page_tree,
+	          internal_index->file_io_handle,
+	          internal_index->index_catalog_definition->father_data_page_number,
+	          key_data,
+	          key_data_size,
+	          &leaf_page_number,
+	          &leaf_value_index,
+	          &is_exact_match,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to seek leaf value in index page tree.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libesedb_index_cursor_set_page(
+		     internal_cursor,
+		     leaf_page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set leaf page: %" PRIu32 ".",
+			 function,
+			 leaf_page_number );
+
+			goto on_error;
+		}
+		internal_cursor->page_value_index = leaf_value_index;
+
+		/* Skip the index values with a key that is equal to the key data
+		 */
+		while( ( ( flags & LIBESEDB_SEEK_FLAG_GREATER ) != 0 )
+		    && ( is_exact_match != 0 ) )
+		{
+			result = libesedb_index_cursor_get_next_value(
+			          internal_cursor,
+			          &page,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next index value.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			if( libesedb_page_get_value_key(
+			     page,
+			     internal_cursor->page_value_index,
+			     &common_key_data,
+			     &common_key_size,
+			     &local_key_data,
+			     &local_key_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page: %" PRIu32 " value: %" PRIu16 " key.",
+				 function,
+				 internal_cursor->page_number,
+				 internal_cursor->page_value_index );
+
+				goto on_error;
+			}
+			compare_result = libesedb_key_compare_data(
+			                  key_data,
+			                  key_data_size,
+			                  common_key_data,
+			                  (size_t) common_key_size,
+			                  local_key_data,
+			                  (size_t) local_key_size,
+			                  error );
+
+			if( compare_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare key data with index value key.",
+				 function );
+
+				goto on_error;
+			}
+			if( libesedb_page_release(
+			     internal_index->io_handle,
+			     &page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release page.",
+				 function );
+
+				goto on_error;
+			}
+			else if( compare_result != LIBFDATA_COMPARE_EQUAL )
+			{
+				break;
+			}
+			internal_cursor->page_value_index += 1;
+		}
+	}
+	*cursor = (libesedb_index_cursor_t *) internal_cursor;
+
+	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 internal_index->io_handle,
+		 &page,
+		 NULL );
+	}
+	if( internal_cursor != NULL )
+	{
+		memory_free(
+		 internal_cursor );
+	}
+	return( -1 );
+}
+
+/* Closes an index cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_cursor_close(
+     libesedb_index_cursor_t **cursor,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_cursor_t *internal_cursor = NULL;
+	static char *function                             = "libesedb_index_cursor_close";
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cursor != NULL )
+	{
+		internal_cursor = (libesedb_internal_index_cursor_t *) *cursor;
+		*cursor         = NULL;
+
+		/* The internal_index reference is freed elsewhere
+		 */
+		if( internal_cursor->end_key_data != NULL )
+		{
+			memory_free(
+			 internal_cursor->end_key_data );
+		}
+		memory_free(
+		 internal_cursor );
+	}
+	return( 1 );
+}
+
+/* Positions the cursor at the start of a specific leaf page
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_cursor_set_page(
+     libesedb_internal_index_cursor_t *internal_cursor,
+     uint32_t page_number,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page = NULL;
+	static char *function = "libesedb_index_cursor_set_page";
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - missing index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->internal_index->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - invalid index - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->number_of_pages >= internal_cursor->internal_index->io_handle->last_page_number )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: number of leaf pages exceeds number of pages in file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_get_page(
+	     internal_cursor->internal_index->index_page_tree,
+	     internal_cursor->internal_index->file_io_handle,
+	     page_number,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	internal_cursor->page_number           = page_number;
+	internal_cursor->previous_page_number  = 0;
+	internal_cursor->next_page_number      = 0;
+	internal_cursor->number_of_page_values = 0;
+	internal_cursor->page_value_index      = 1;
+
+	internal_cursor->number_of_pages += 1;
+
+	if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
+	{
+		if( libesedb_page_release(
+		     internal_cursor->internal_index->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported page: %" PRIu32 " - not a leaf page.",
+		 function,
+		 page_number );
+
+		goto on_error;
+	}
+	if( libesedb_page_get_number_of_values(
+	     page,
+	     &( internal_cursor->number_of_page_values ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of page values.",
+		 function );
+
+		goto on_error;
+	}
+	internal_cursor->previous_page_number = page->previous_page_number;
+	internal_cursor->next_page_number     = page->next_page_number;
+
+	if( libesedb_page_release(
+	     internal_cursor->internal_index->io_handle,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 internal_cursor->internal_index->io_handle,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Positions the cursor directly before the next index value that is not defunct
+ * The page contains the index value that follows the cursor
+ * The page is referenced on behalf of the caller and must be released using
+ * libesedb_page_release
+ * Returns 1 if successful, 0 if no such index value or -1 on error
+ */
+int libesedb_index_cursor_get_next_value(
+     libesedb_internal_index_cursor_t *internal_cursor,
+     libesedb_page_t **page,
+     libcerror_error_t **error )
+{
+	libesedb_page_value_t *page_value = NULL;
+	static char *function             = "libesedb_index_cursor_get_next_value";
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - missing index.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page value already set.",
+		 function );
+
+		return( -1 );
+	}
+	while( internal_cursor->page_number != 0 )
+	{
+		if( internal_cursor->page_value_index >= internal_cursor->number_of_page_values )
+		{
+			if( internal_cursor->next_page_number == 0 )
+			{
+				break;
+			}
+			if( libesedb_index_cursor_set_page(
+			     internal_cursor,
+			     internal_cursor->next_page_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set leaf page: %" PRIu32 ".",
+				 function,
+				 internal_cursor->next_page_number );
+
+				return( -1 );
+			}
+			continue;
+		}
+		if( libesedb_page_tree_get_page(
+		     internal_cursor->internal_index->index_page_tree,
+		     internal_cursor->internal_index->file_io_handle,
+		     internal_cursor->page_number,
+		     page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 internal_cursor->page_number );
+
+			return( -1 );
+		}
+		if( libesedb_page_get_value(
+		     *page,
+		     internal_cursor->page_value_index,
+		     &page_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 " value: %" PRIu16 ".",
+			 function,
+			 internal_cursor->page_number,
+			 internal_cursor->page_value_index );
+
+			goto on_error;
+		}
+		if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) == 0 )
+		{
+			return( 1 );
+		}
+		if( libesedb_page_release(
+		     internal_cursor->internal_index->io_handle,
+		     page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+		internal_cursor->page_value_index += 1;
+	}
+	return( 0 );
+
+on_error:
+	if( *page != NULL )
+	{
+		libesedb_page_release(
+		 internal_cursor->internal_index->io_handle,
+		 page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Positions the cursor directly before the previous index value that is not defunct
+ * The page contains the index value that follows the cursor
+ * The page is referenced on behalf of the caller and must be released using
+ * libesedb_page_release
+ * Returns 1 if successful, 0 if no such index value or -1 on error
+ */
+int libesedb_index_cursor_get_previous_value(
+     libesedb_internal_index_cursor_t *internal_cursor,
+     libesedb_page_t **page,
+     libcerror_error_t **error )
+{
+	libesedb_page_value_t *page_value = NULL;
+	static char *function             = "libesedb_index_cursor_get_previous_value";
+	uint32_t page_number              = 0;
+	uint16_t page_value_index         = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - missing index.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the current position if there is no previous index value
+	 */
+	page_number      = internal_cursor->page_number;
+	page_value_index = internal_cursor->page_value_index;
+
+	while( internal_cursor->page_number != 0 )
+	{
+		/* The first page value contains the page header
+		 */
+		if( internal_cursor->page_value_index <= 1 )
+		{
+			if( internal_cursor->previous_page_number == 0 )
+			{
+				break;
+			}
+			if( libesedb_index_cursor_set_page(
+			     internal_cursor,
+			     internal_cursor->previous_page_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set leaf page: %" PRIu32 ".",
+				 function,
+				 internal_cursor->previous_page_number );
+
+				return( -1 );
+			}
+			internal_cursor->page_value_index = internal_cursor->number_of_page_values;
+
+			continue;
+		}
+		internal_cursor->page_value_index -= 1;
+
+		if( libesedb_page_tree_get_page(
+		     internal_cursor->internal_index->index_page_tree,
+		     internal_cursor->internal_index->file_io_handle,
+		     internal_cursor->page_number,
+		     page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 internal_cursor->page_number );
+
+			return( -1 );
+		}
+		if( libesedb_page_get_value(
+		     *page,
+		     internal_cursor->page_value_index,
+		     &page_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 " value: %" PRIu16 ".",
+			 function,
+			 internal_cursor->page_number,
+			 internal_cursor->page_value_index );
+
+			goto on_error;
+		}
+		if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) == 0 )
+		{
+			return( 1 );
+		}
+		if( libesedb_page_release(
+		     internal_cursor->internal_index->io_handle,
+		     page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( internal_cursor->page_number != 0 )
+	 && ( internal_cursor->page_number != page_number ) )
+	{
+		if( libesedb_index_cursor_set_page(
+		     internal_cursor,
+		     page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set leaf page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+	}
+	internal_cursor->page_value_index = page_value_index;
+
+	return( 0 );
+
+on_error:
+	if( *page != NULL )
+	{
+		libesedb_page_release(
+		 internal_cursor->internal_index->io_handle,
+		 page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the record referenced by the index value that follows the cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_cursor_read_record(
+     libesedb_internal_index_cursor_t *internal_cursor,
+     libesedb_page_t *page,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_index_cursor_read_record";
+	uint16_t data_offset  = 0;
+	uint16_t data_size    = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_value_data_range(
+	     page,
+	     internal_cursor->page_value_index,
+	     NULL,
+	     &data_offset,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 " value: %" PRIu16 " data range.",
+		 function,
+		 internal_cursor->page_number,
+		 internal_cursor->page_value_index );
+
+		return( -1 );
+	}
+	/* The index value data contains the key of the record in the table
+	 */
+	if( libesedb_index_read_record(
+	     internal_cursor->internal_index,
+	     &( page->data[ data_offset ] ),
+	     (size_t) data_size,
+	     record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the bookmark of the index value that follows the cursor
+ * The key data of the bookmark is a copy of the index value data, since the page can be
+ * removed from the pages cache before the bookmark is resolved
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_cursor_read_bookmark(
+     libesedb_internal_index_cursor_t *internal_cursor,
+     libesedb_page_t *page,
+     libesedb_index_cursor_bookmark_t *bookmark,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_index_cursor_read_bookmark";
+	uint16_t data_offset  = 0;
+	uint16_t data_size    = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( bookmark == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bookmark.",
+		 function );
+
+		return( -1 );
+	}
+	if( bookmark->key_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid bookmark - key data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_value_data_range(
+	     page,
+	     internal_cursor->page_value_index,
+	     NULL,
+	     &data_offset,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 " value: %" PRIu16 " data range.",
+		 function,
+		 internal_cursor->page_number,
+		 internal_cursor->page_value_index );
+
+		return( -1 );
+	}
+	if( data_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page: %" PRIu32 " value: %" PRIu16 " data size value out of bounds.",
+		 function,
+		 internal_cursor->page_number,
+		 internal_cursor->page_value_index );
+
+		return( -1 );
+	}
+	bookmark->key_data = (uint8_t *) memory_allocate(
+	                                  sizeof( uint8_t ) * data_size );
+
+	if( bookmark->key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     bookmark->key_data,
+	     &( page->data[ data_offset ] ),
+	     sizeof( uint8_t ) * data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy key data.",
+		 function );
+
+		goto on_error;
+	}
+	bookmark->key_data_size = (size_t) data_size;
+
+	return( 1 );
+
+on_error:
+	if( bookmark->key_data != NULL )
+	{
+		memory_free(
+		 bookmark->key_data );
+
+		bookmark->key_data = NULL;
+	}
+	return( -1 );
+}
+
+/* Compares two bookmarks by their key data
+ * Bookmarks with equal key data are ordered by their record index
+ * Returns -1, 0 or 1 as expected by qsort
+ */
+int libesedb_index_cursor_bookmark_compare(
+     const void *first_bookmark,
+     const void *second_bookmark )
+{
+	const libesedb_index_cursor_bookmark_t *first  = (const libesedb_index_cursor_bookmark_t *) first_bookmark;
+	const libesedb_index_cursor_bookmark_t *second = (const libesedb_index_cursor_bookmark_t *) second_bookmark;
+	size_t compare_data_size                       = 0;
+	int compare_result                             = 0;
+
+	if( first->key_data_size < second->key_data_size )
+	{
+		compare_data_size = first->key_data_size;
+	}
+	else
+	{
+		compare_data_size = second->key_data_size;
+	}
+	compare_result = memory_compare(
+	                  first->key_data,
+	                  second->key_data,
+	                  compare_data_size );
+
+	if( compare_result < 0 )
+	{
+		return( -1 );
+	}
+	else if( compare_result > 0 )
+	{
+		return( 1 );
+	}
+	if( first->key_data_size < second->key_data_size )
+	{
+		return( -1 );
+	}
+	else if( first->key_data_size > second->key_data_size )
+	{
+		return( 1 );
+	}
+	if( first->record_index < second->record_index )
+	{
+		return( -1 );
+	}
+	else if( first->record_index > second->record_index )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Resolves bookmarks into records
+ * The bookmarks are expected to be sorted by key data. Each bookmark is first looked up
+ * in the table leaf page of the previous bookmark and its next leaf page, so that only
+ * bookmarks that are not stored near the previous bookmark require a descent of the table page tree
+ * The record of a bookmark is stored in records at the record index of the bookmark
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_cursor_resolve_bookmarks(
+     libesedb_internal_index_cursor_t *internal_cursor,
+     libesedb_index_cursor_bookmark_t *bookmarks,
+     int number_of_bookmarks,
+     libesedb_record_t **records,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *record_data_definition = NULL;
+	libesedb_internal_index_t *internal_index          = NULL;
+	libesedb_page_t *page                              = NULL;
+	static char *function                              = "libesedb_index_cursor_resolve_bookmarks";
+	off64_t page_offset                                = 0;
+	uint32_t leaf_page_number                          = 0;
+	uint32_t next_leaf_page_number                     = 0;
+	uint32_t root_page_number                          = 0;
+	uint16_t data_offset                               = 0;
+	uint16_t data_size                                 = 0;
+	uint16_t leaf_value_index                          = 0;
+	uint8_t is_exact_match                             = 0;
+	int bookmark_index                                 = 0;
+	int record_index                                   = 0;
+	int result                                         = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = internal_cursor->internal_index;
+
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - missing index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index->table_page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing table page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_index->table_definition == NULL )
+	 || ( internal_index->table_definition->table_catalog_definition == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing table catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( bookmarks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bookmarks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bookmarks < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of bookmarks value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records.",
+		 function );
+
+		return( -1 );
+	}
+	root_page_number = internal_index->table_definition->table_catalog_definition->father_data_page_number;
+
+	for( bookmark_index = 0;
+	     bookmark_index < number_of_bookmarks;
+	     bookmark_index++ )
+	{
+		record_index = bookmarks[ bookmark_index ].record_index;
+
+		if( ( record_index < 0 )
+		 || ( record_index >= number_of_bookmarks ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid bookmark: %d - record index value out of bounds.",
+			 function,
+			 bookmark_index );
+
+			goto on_error;
+		}
+		if( records[ record_index ] != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid record: %d value already set.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		result = 0;
+
+		/* The key data of the bookmark is greater than or equal to that of the previous bookmark,
+		 * hence if the leaf page of the previous bookmark or its next leaf page contains a leaf value
+		 * with a key that is greater than or equal to the key data it is the leaf value of the bookmark
+		 */
+		if( leaf_page_number != 0 )
+		{
+			if( libesedb_page_tree_get_page(
+			     internal_index->table_page_tree,
+			     internal_index->file_io_handle,
+			     leaf_page_number,
+			     &page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page: %" PRIu32 ".",
+				 function,
+				 leaf_page_number );
+
+				goto on_error;
+			}
+			next_leaf_page_number = page->next_page_number;
+
+			result = libesedb_page_get_value_index_by_key(
+			          page,
+			          bookmarks[ bookmark_index ].key_data,
+			          bookmarks[ bookmark_index ].key_data_size,
+			          &leaf_value_index,
+			          &is_exact_match,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value index from page: %" PRIu32 ".",
+				 function,
+				 leaf_page_number );
+
+				goto on_error;
+			}
+			if( libesedb_page_release(
+			     internal_index->io_handle,
+			     &page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release page.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( ( result == 0 )
+		 && ( leaf_page_number != 0 )
+		 && ( next_leaf_page_number != 0 ) )
+		{
+			if( libesedb_page_tree_get_page(
+			     internal_index->table_page_tree,
+			     internal_index->file_io_handle,
+			     next_leaf_page_number,
+			     &page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page: %" PRIu32 ".",
+				 function,
+				 next_leaf_page_number );
+
+				goto on_error;
+			}
+			if( ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+			 && ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) == 0 ) )
+			{
+				result = libesedb_page_get_value_index_by_key(
+				          page,
+				          bookmarks[ bookmark_index ].key_data,
+				          bookmarks[ bookmark_index ].key_data_size,
+				          &leaf_value_index,
+				          &is_exact_match,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve value index from page: %" PRIu32 ".",
+					 function,
+					 next_leaf_page_number );
+
+					goto on_error;
+				}
+				else if( result != 0 )
+				{
+					leaf_page_number = next_leaf_page_number;
+				}
+			}
+			if( libesedb_page_release(
+			     internal_index->io_handle,
+			     &page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release page.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( result == 0 )
+		{
+			result = libesedb_page_tree_seek_leaf_value(
+			          internal_index->table_page_tree,
+			          internal_index->file_io_handle,
+			          root_page_number,
+			          bookmarks[ bookmark_index ].key_data,
+			          bookmarks[ bookmark_index ].key_data_size,
+			          &leaf_page_number,
+			          &leaf_value_index,
+			          &is_exact_match,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to seek leaf value in table page tree.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( ( result == 0 )
+		 || ( is_exact_match == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing table record of bookmark: %d.",
+			 function,
+			 bookmark_index );
+
+			goto on_error;
+		}
+		if( libesedb_page_tree_get_page(
+		     internal_index->table_page_tree,
+		     internal_index->file_io_handle,
+		     leaf_page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 leaf_page_number );
+
+			goto on_error;
+		}
+		if( libesedb_page_get_value_data_range(
+		     page,
+		     leaf_value_index,
+		     NULL,
+		     &data_offset,
+		     &data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 " value: %" PRIu16 " data range.",
+			 function,
+			 leaf_page_number,
+			 leaf_value_index );
+
+			goto on_error;
+		}
+		if( libesedb_page_release(
+		     internal_index->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_data_definition_initialize(
+		     &record_data_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record data definition.",
+			 function );
+
+			goto on_error;
+		}
+		page_offset  = leaf_page_number - 1;
+		page_offset *= internal_index->io_handle->page_size;
+
+		record_data_definition->page_offset      = page_offset;
+		record_data_definition->page_number      = leaf_page_number;
+		record_data_definition->page_value_index = leaf_value_index;
+		record_data_definition->data_offset      = data_offset;
+		record_data_definition->data_size        = data_size;
+
+		if( libesedb_record_initialize(
+		     &( records[ record_index ] ),
+		     internal_index->file_io_handle,
+		     internal_index->io_handle,
+		     internal_index->table_definition,
+		     internal_index->template_table_definition,
+		     NULL,
+		     0,
+		     record_data_definition,
+		     internal_index->long_values_tree,
+		     internal_index->long_values_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		if( libesedb_data_definition_free(
+		     &record_data_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record data definition.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 internal_index->io_handle,
+		 &page,
+		 NULL );
+	}
+	if( record_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &record_data_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the end key
+ * The cursor does not return index values with a key that is greater than the end key data
+ * when moving to the next index value
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_cursor_set_end_key(
+     libesedb_index_cursor_t *cursor,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_cursor_t *internal_cursor = NULL;
+	static char *function                             = "libesedb_index_cursor_set_end_key";
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libesedb_internal_index_cursor_t *) cursor;
+
+	if( internal_cursor->end_key_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cursor - end key data already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_data_size == 0 )
+	 || ( key_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor->end_key_data = (uint8_t *) memory_allocate(
+	                                             sizeof( uint8_t ) * key_data_size );
+
+	if( internal_cursor->end_key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create end key data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     internal_cursor->end_key_data,
+	     key_data,
+	     sizeof( uint8_t ) * key_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy end key data.",
+		 function );
+
+		goto on_error;
+	}
+	internal_cursor->end_key_data_size = key_data_size;
+
+	return( 1 );
+
+on_error:
+	if( internal_cursor->end_key_data != NULL )
+	{
+		memory_free(
+		 internal_cursor->end_key_data );
+
+		internal_cursor->end_key_data = NULL;
+	}
+	return( -1 );
+}
+
+/* Determines if the key of the index value that follows the cursor is greater than the end key
+ * Returns 1 if the key is greater than the end key, 0 if not or -1 on error
+ */
+int libesedb_index_cursor_is_past_end_key(
+     libesedb_internal_index_cursor_t *internal_cursor,
+     libesedb_page_t *page,
+     libcerror_error_t **error )
+{
+	const uint8_t *common_key_data = NULL;
+	const uint8_t *local_key_data  = NULL;
+	static char *function          = "libesedb_index_cursor_is_past_end_key";
+	uint16_t common_key_size       = 0;
+	uint16_t local_key_size        = 0;
+	int compare_result             = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->end_key_data == NULL )
+	{
+		return( 0 );
+	}
+	if( libesedb_page_get_value_key(
+	     page,
+	     internal_cursor->page_value_index,
+	     &common_key_data,
+	     &common_key_size,
+	     &local_key_data,
+	     &local_key_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 " value: %" PRIu16 " key.",
+		 function,
+		 internal_cursor->page_number,
+		 internal_cursor->page_value_index );
+
+		return( -1 );
+	}
+	compare_result = libesedb_key_compare_data(
+	                  internal_cursor->end_key_data,
+	                  internal_cursor->end_key_data_size,
+	                  common_key_data,
+	                  (size_t) common_key_size,
+	                  local_key_data,
+	                  (size_t) local_key_size,
+	                  error );
+
+	if( compare_result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare end key data with index value key.",
+		 function );
+
+		return( -1 );
+	}
+	else if( compare_result == LIBFDATA_COMPARE_LESS )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the record of the next index value
+ * Returns 1 if successful, 0 if no more records are available or -1 on error
+ */
+int libesedb_index_cursor_next(
+     libesedb_index_cursor_t *cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_cursor_t *internal_cursor = NULL;
+	libesedb_page_t *page                             = NULL;
+	static char *function                             = "libesedb_index_cursor_next";
+	int result                                        = 0;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libesedb_internal_index_cursor_t *) cursor;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* Reset the loop detection when the direction changes
+	 */
+	if( internal_cursor->direction != LIBESEDB_INDEX_CURSOR_DIRECTION_NEXT )
+	{
+		internal_cursor->direction       = LIBESEDB_INDEX_CURSOR_DIRECTION_NEXT;
+		internal_cursor->number_of_pages = 0;
+	}
+	result = libesedb_index_cursor_get_next_value(
+	          internal_cursor,
+	          &page,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next index value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = libesedb_index_cursor_is_past_end_key(
+	          internal_cursor,
+	          page,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to determine if index value is past end key.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libesedb_page_release(
+		     internal_cursor->internal_index->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	if( libesedb_index_cursor_read_record(
+	     internal_cursor,
+	     page,
+	     record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_release(
+	     internal_cursor->internal_index->io_handle,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page.",
+		 function );
+
+		goto on_error;
+	}
+	internal_cursor->page_value_index += 1;
+
+	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 internal_cursor->internal_index->io_handle,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the records of the next index values
+ * Up to maximum number of records index values are read, after which the table records
+ * they reference are looked up in key order. Records that are stored in the same table
+ * leaf page share a single descent of the table page tree
+ * The records are stored in index order, records should contain maximum number of records entries set to NULL
+ * Returns 1 if successful, 0 if no more records are available or -1 on error
+ */
+int libesedb_index_cursor_next_records(
+     libesedb_index_cursor_t *cursor,
+     libesedb_record_t **records,
+     int maximum_number_of_records,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libesedb_index_cursor_bookmark_t *bookmarks       = NULL;
+	libesedb_internal_index_cursor_t *internal_cursor = NULL;
+	libesedb_page_t *page                             = NULL;
+	static char *function                             = "libesedb_index_cursor_next_records";
+	int number_of_bookmarks                           = 0;
+	int record_index                                  = 0;
+	int result                                        = 0;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libesedb_internal_index_cursor_t *) cursor;
+
+	if( records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_records <= 0 )
+	 || ( (size_t) maximum_number_of_records > ( (size_t) SSIZE_MAX / sizeof( libesedb_index_cursor_bookmark_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < maximum_number_of_records;
+	     record_index++ )
+	{
+		if( records[ record_index ] != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid record: %d value already set.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+	}
+	bookmarks = (libesedb_index_cursor_bookmark_t *) memory_allocate(
+	                                                  sizeof( libesedb_index_cursor_bookmark_t ) * maximum_number_of_records );
+
+	if( bookmarks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bookmarks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     bookmarks,
+	     0,
+	     sizeof( libesedb_index_cursor_bookmark_t ) * maximum_number_of_records ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear bookmarks.",
+		 function );
+
+		goto on_error;
+	}
+	/* Reset the loop detection when the direction changes
+	 */
+	if( internal_cursor->direction != LIBESEDB_INDEX_CURSOR_DIRECTION_NEXT )
+	{
+		internal_cursor->direction       = LIBESEDB_INDEX_CURSOR_DIRECTION_NEXT;
+		internal_cursor->number_of_pages = 0;
+	}
+	while( number_of_bookmarks < maximum_number_of_records )
+	{
+		result = libesedb_index_cursor_get_next_value(
+		          internal_cursor,
+		          &page,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next index value.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		result = libesedb_index_cursor_is_past_end_key(
+		          internal_cursor,
+		          page,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to determine if index value is past end key.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libesedb_page_release(
+			     internal_cursor->internal_index->io_handle,
+			     &page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release page.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+		}
+		/* The index value data contains the key of the record in the table
+		 */
+		if( libesedb_index_cursor_read_bookmark(
+		     internal_cursor,
+		     page,
+		     &( bookmarks[ number_of_bookmarks ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read bookmark: %d.",
+			 function,
+			 number_of_bookmarks );
+
+			goto on_error;
+		}
+		if( libesedb_page_release(
+		     internal_cursor->internal_index->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+		bookmarks[ number_of_bookmarks ].record_index = number_of_bookmarks;
+
+		number_of_bookmarks++;
+
+		internal_cursor->page_value_index += 1;
+	}
+	if( number_of_bookmarks > 1 )
+	{
+		qsort(
+		 bookmarks,
+		 (size_t) number_of_bookmarks,
+		 sizeof( libesedb_index_cursor_bookmark_t ),
+		 &libesedb_index_cursor_bookmark_compare );
+	}
+	if( libesedb_index_cursor_resolve_bookmarks(
+	     internal_cursor,
+	     bookmarks,
+	     number_of_bookmarks,
+	     records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve bookmarks.",
+		 function );
+
+		goto on_error;
+	}
+	for( record_index = 0;
+	     record_index < number_of_bookmarks;
+	     record_index++ )
+	{
+		memory_free(
+		 bookmarks[ record_index ].key_data );
+	}
+	memory_free(
+	 bookmarks );
+
+	*number_of_records = number_of_bookmarks;
+
+	if( number_of_bookmarks == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 internal_cursor->internal_index->io_handle,
+		 &page,
+		 NULL );
+	}
+	for( record_index = 0;
+	     record_index < maximum_number_of_records;
+	     record_index++ )
+	{
+		if( records[ record_index ] != NULL )
+		{
+			libesedb_record_free(
+			 &( records[ record_index ] ),
+			 NULL );
+		}
+	}
+	if( bookmarks != NULL )
+	{
+		for( record_index = 0;
+		     record_index < number_of_bookmarks;
+		     record_index++ )
+		{
+			if( bookmarks[ record_index ].key_data != NULL )
+			{
+				memory_free(
+				 bookmarks[ record_index ].key_data );
+			}
+		}
+		memory_free(
+		 bookmarks );
+	}
+	return( -1 );
+}
+
+/* Retrieves the record of the previous index value
+ * Returns 1 if successful, 0 if no more records are available or -1 on error
+ */
+int libesedb_index_cursor_previous(
+     libesedb_index_cursor_t *cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_cursor_t *internal_cursor = NULL;
+	libesedb_page_t *page                             = NULL;
+	static char *function                             = "libesedb_index_cursor_previous";
+	int result                                        = 0;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libesedb_internal_index_cursor_t *) cursor;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* Reset the loop detection when the direction changes
+	 */
+	if( internal_cursor->direction != LIBESEDB_INDEX_CURSOR_DIRECTION_PREVIOUS )
+	{
+		internal_cursor->direction       = LIBESEDB_INDEX_CURSOR_DIRECTION_PREVIOUS;
+		internal_cursor->number_of_pages = 0;
+	}
+	result = libesedb_index_cursor_get_previous_value(
+	          internal_cursor,
+	          &page,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve previous index value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libesedb_index_cursor_read_record(
+	     internal_cursor,
+	     page,
+	     record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_release(
+	     internal_cursor->internal_index->io_handle,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 internal_cursor->internal_index->io_handle,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,193 @@
+/*
+ * Index cursor functions
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_INTERNAL_INDEX_CURSOR_H )
+#define _LIBESEDB_INTERNAL_INDEX_CURSOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_extern.h"
+#include "libesedb_index.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_page.h"
+#include "libesedb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_internal_index_cursor libesedb_internal_index_cursor_t;
+typedef struct libesedb_index_cursor_bookmark libesedb_index_cursor_bookmark_t;
+
+/* The index cursor is positioned in between the leaf values of the index page tree
+ * and moves using the previous and next page numbers stored in the page header
+ */
+struct libesedb_internal_index_cursor
+{
+	/* The index
+	 */
+	libesedb_internal_index_t *internal_index;
+
+	/* The current leaf page number or 0 if the cursor is not positioned
+	 */
+	uint32_t page_number;
+
+	/* The previous leaf page number
+	 */
+	uint32_t previous_page_number;
+
+	/* The next leaf page number
+	 */
+	uint32_t next_page_number;
+
+	/* The number of values in the current leaf page
+	 */
+	uint16_t number_of_page_values;
+
+	/* The index of the value in the current leaf page that follows the cursor
+	 */
+	uint16_t page_value_index;
+
+	/* The number of leaf pages visited since the direction changed, used to detect loops in the leaf page chain
+	 */
+	uint32_t number_of_pages;
+
+	/* The direction of the last move
+	 */
+	uint8_t direction;
+
+	/* The end key data
+	 */
+	uint8_t *end_key_data;
+
+	/* The end key data size
+	 */
+	size_t end_key_data_size;
+};
+
+/* The bookmark is the key of the table record referenced by an index value
+ */
+struct libesedb_index_cursor_bookmark
+{
+	/* The key data
+	 */
+	uint8_t *key_data;
+
+	/* The key data size
+	 */
+	size_t key_data_size;
+
+	/* The index of the record in the records array
+	 */
+	int record_index;
+};
+
+LIBESEDB_EXTERN \
+int libesedb_index_seek(
+     libesedb_index_t *index,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     uint8_t flags,
+     libesedb_index_cursor_t **cursor,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_cursor_close(
+     libesedb_index_cursor_t **cursor,
+     libcerror_error_t **error );
+
+int libesedb_index_cursor_set_page(
+     libesedb_internal_index_cursor_t *internal_cursor,
+     uint32_t page_number,
+     libcerror_error_t **error );
+
+int libesedb_index_cursor_get_next_value(
+     libesedb_internal_index_cursor_t *internal_cursor,
+     libesedb_page_t **page,
+     libcerror_error_t **error );
+
+int libesedb_index_cursor_get_previous_value(
+     libesedb_internal_index_cursor_t *internal_cursor,
+     libesedb_page_t **page,
+     libcerror_error_t **error );
+
+int libesedb_index_cursor_read_record(
+     libesedb_internal_index_cursor_t *internal_cursor,
+     libesedb_page_t *page,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+int libesedb_index_cursor_read_bookmark(
+     libesedb_internal_index_cursor_t *internal_cursor,
+     libesedb_page_t *page,
+     libesedb_index_cursor_bookmark_t *bookmark,
+     libcerror_error_t **error );
+
+int libesedb_index_cursor_bookmark_compare(
+     const void *first_bookmark,
+     const void *second_bookmark );
+
+int libesedb_index_cursor_resolve_bookmarks(
+     libesedb_internal_index_cursor_t *internal_cursor,
+     libesedb_index_cursor_bookmark_t *bookmarks,
+     int number_of_bookmarks,
+     libesedb_record_t **records,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_cursor_set_end_key(
+     libesedb_index_cursor_t *cursor,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libcerror_error_t **error );
+
+int libesedb_index_cursor_is_past_end_key(
+     libesedb_internal_index_cursor_t *internal_cursor,
+     libesedb_page_t *page,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_cursor_next(
+     libesedb_index_cursor_t *cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_cursor_next_records(
+     libesedb_index_cursor_t *cursor,
+     libesedb_record_t **records,
+     int maximum_number_of_records,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_cursor_previous(
+     libesedb_index_cursor_t *cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_INTERNAL_INDEX_CURSOR_H ) */
+
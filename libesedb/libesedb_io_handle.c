@@ -24,17 +24,39 @@
 #include <memory.h>
 #include <types.h>
 
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
 #include "libesedb_checksum.h"
 #include "libesedb_codepage.h"
+#include "libesedb_data_definition.h"
 #include "libesedb_debug.h"
 #include "libesedb_definitions.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
+#include "libesedb_libcthreads.h"
 #include "libesedb_libfcache.h"
-#include "libesedb_libfdata.h"
 #include "libesedb_page.h"
+#include "libesedb_page_cache.h"
 #include "libesedb_unused.h"
 
 #include "esedb_file_header.h"
@@ -62,69 +84,1429 @@ int libesedb_io_handle_initialize(
 
 		return( -1 );
 	}
-	if( *io_handle != NULL )
+	if( *io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*io_handle = memory_allocate_structure(
+	              libesedb_io_handle_t );
+
+	if( *io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *io_handle,
+	     0,
+	     sizeof( libesedb_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		memory_free(
+		 *io_handle );
+
+		*io_handle = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *io_handle )->file_io_handle_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *io_handle )->file_descriptor = -1;
+	( *io_handle )->ascii_codepage  = LIBESEDB_CODEPAGE_WINDOWS_1252;
+
+	return( 1 );
+
+on_error:
+	if( *io_handle != NULL )
+	{
+		memory_free(
+		 *io_handle );
+
+		*io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_free(
+     libesedb_io_handle_t **io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_free";
+	int result            = 1;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_handle != NULL )
+	{
+		if( libesedb_io_handle_close_file(
+		     *io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *io_handle )->file_io_handle_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *io_handle );
+
+		*io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clears the IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_clear(
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_t *file_io_handle_mutex = NULL;
+#endif
+	static char *function                     = "libesedb_io_handle_clear";
+	size64_t maximum_long_values_cache_size   = 0;
+	size64_t maximum_pages_cache_size         = 0;
+	size64_t maximum_values_cache_size        = 0;
+	int checksum_verification_mode            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_io_handle_close_file(
+	     io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	file_io_handle_mutex = io_handle->file_io_handle_mutex;
+#endif
+	/* The cache size limits and checksum verification mode are retained
+	 */
+	maximum_pages_cache_size       = io_handle->maximum_pages_cache_size;
+	maximum_values_cache_size      = io_handle->maximum_values_cache_size;
+	maximum_long_values_cache_size = io_handle->maximum_long_values_cache_size;
+	checksum_verification_mode     = io_handle->checksum_verification_mode;
+
+	if( memory_set(
+	     io_handle,
+	     0,
+	     sizeof( libesedb_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	io_handle->file_io_handle_mutex = file_io_handle_mutex;
+#endif
+	io_handle->maximum_pages_cache_size       = maximum_pages_cache_size;
+	io_handle->maximum_values_cache_size      = maximum_values_cache_size;
+	io_handle->maximum_long_values_cache_size = maximum_long_values_cache_size;
+	io_handle->checksum_verification_mode     = checksum_verification_mode;
+	io_handle->file_descriptor = -1;
+	io_handle->ascii_codepage  = LIBESEDB_CODEPAGE_WINDOWS_1252;
+
+	return( 1 );
+}
+
+/* Retrieves the (estimated) size of an entry of a specific cache type
+ * The entries of the pages cache are pages, the entries of the values
+ * and long values caches are data definitions
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_get_cache_entry_size(
+     libesedb_io_handle_t *io_handle,
+     int cache_type,
+     size_t *cache_entry_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_get_cache_entry_size";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_entry_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache entry size.",
+		 function );
+
+		return( -1 );
+	}
+	switch( cache_type )
+	{
+		case LIBESEDB_CACHE_TYPE_PAGES:
+			if( io_handle->page_size == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: invalid IO handle - missing page size.",
+				 function );
+
+				return( -1 );
+			}
+			*cache_entry_size = sizeof( libesedb_page_t ) + (size_t) io_handle->page_size;
+			break;
+
+		case LIBESEDB_CACHE_TYPE_VALUES:
+		case LIBESEDB_CACHE_TYPE_LONG_VALUES:
+			*cache_entry_size = sizeof( libesedb_data_definition_t );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported cache type: %d.",
+			 function,
+			 cache_type );
+
+			return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the maximum number of cache entries of a specific cache type
+ * The number of entries is derived from the cache size limit when set,
+ * otherwise the default maximum number of cache entries is used
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_get_maximum_number_of_cache_entries(
+     libesedb_io_handle_t *io_handle,
+     int cache_type,
+     int default_maximum_number_of_cache_entries,
+     int *maximum_number_of_cache_entries,
+     libcerror_error_t **error )
+{
+	static char *function      = "libesedb_io_handle_get_maximum_number_of_cache_entries";
+	size64_t cache_size        = 0;
+	size64_t number_of_entries = 0;
+	size_t cache_entry_size    = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( default_maximum_number_of_cache_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid default maximum number of cache entries value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_cache_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of cache entries.",
+		 function );
+
+		return( -1 );
+	}
+	switch( cache_type )
+	{
+		case LIBESEDB_CACHE_TYPE_PAGES:
+			cache_size = io_handle->maximum_pages_cache_size;
+			break;
+
+		case LIBESEDB_CACHE_TYPE_VALUES:
+			cache_size = io_handle->maximum_values_cache_size;
+			break;
+
+		case LIBESEDB_CACHE_TYPE_LONG_VALUES:
+			cache_size = io_handle->maximum_long_values_cache_size;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported cache type: %d.",
+			 function,
+			 cache_type );
+
+			return( -1 );
+	}
+	if( cache_size == 0 )
+	{
+		*maximum_number_of_cache_entries = default_maximum_number_of_cache_entries;
+
+		return( 1 );
+	}
+	if( libesedb_io_handle_get_cache_entry_size(
+	     io_handle,
+	     cache_type,
+	     &cache_entry_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache entry size.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_entries = cache_size / cache_entry_size;
+
+	if( number_of_entries < (size64_t) LIBESEDB_MINIMUM_CACHE_ENTRIES )
+	{
+		number_of_entries = (size64_t) LIBESEDB_MINIMUM_CACHE_ENTRIES;
+	}
+	else if( number_of_entries > (size64_t) INT_MAX )
+	{
+		number_of_entries = (size64_t) INT_MAX;
+	}
+	*maximum_number_of_cache_entries = (int) number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the (estimated) size in bytes of the values stored in a cache of a specific cache type
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_get_cache_size(
+     libesedb_io_handle_t *io_handle,
+     int cache_type,
+     libfcache_cache_t *cache,
+     size64_t *cache_size,
+     libcerror_error_t **error )
+{
+	static char *function      = "libesedb_io_handle_get_cache_size";
+	size_t cache_entry_size    = 0;
+	int number_of_cache_values = 0;
+
+	if( cache_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_io_handle_get_cache_entry_size(
+	     io_handle,
+	     cache_type,
+	     &cache_entry_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache entry size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_cache_get_number_of_cache_values(
+	     cache,
+	     &number_of_cache_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache values.",
+		 function );
+
+		return( -1 );
+	}
+	*cache_size = (size64_t) number_of_cache_values * cache_entry_size;
+
+	return( 1 );
+}
+
+/* Retrieves the (estimated) size in bytes of the pages stored in the pages cache
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_get_pages_cache_size(
+     libesedb_io_handle_t *io_handle,
+     size64_t *cache_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "libesedb_io_handle_get_pages_cache_size";
+	size_t cache_entry_size = 0;
+	int number_of_pages     = 0;
+	int result              = 1;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache size.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->pages_cache == NULL )
+	{
+		*cache_size = 0;
+
+		return( 1 );
+	}
+	if( libesedb_io_handle_get_cache_entry_size(
+	     io_handle,
+	     LIBESEDB_CACHE_TYPE_PAGES,
+	     &cache_entry_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache entry size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     io_handle->file_io_handle_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab file IO handle mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libesedb_page_cache_get_number_of_pages(
+	     io_handle->pages_cache,
+	     &number_of_pages,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of pages in cache.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     io_handle->file_io_handle_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		*cache_size = (size64_t) number_of_pages * cache_entry_size;
+	}
+	return( result );
+}
+
+/* Opens a file for positional reads
+ * The file descriptor is used by libesedb_io_handle_read_buffer_at_offset
+ * to read without changing the offset of the file IO handle
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libesedb_io_handle_open_file(
+     libesedb_io_handle_t *io_handle,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_open_file";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle - file descriptor already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if ( defined( HAVE_PREAD ) || defined( HAVE_MMAP ) ) && !defined( WINAPI )
+	io_handle->file_descriptor = open(
+	                              filename,
+	                              O_RDONLY );
+
+	if( io_handle->file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Maps the file opened by libesedb_io_handle_open_file into memory (read-only)
+ * The mapping is used by libesedb_page_read instead of reading the file
+ * Returns 1 if successful, 0 if the file cannot be memory mapped or -1 on error
+ */
+int libesedb_io_handle_map_file(
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_MMAP ) && !defined( WINAPI )
+	struct stat file_statistics;
+
+	void *mapped_data     = NULL;
+#endif
+	static char *function = "libesedb_io_handle_map_file";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->mapped_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle - mapped data already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_MMAP ) && !defined( WINAPI )
+	if( fstat(
+	     io_handle->file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	/* Empty files and files that do not fit in the address space
+	 * are read using the file descriptor
+	 */
+	if( ( file_statistics.st_size <= 0 )
+	 || ( (size64_t) file_statistics.st_size > (size64_t) SSIZE_MAX ) )
+	{
+		return( 0 );
+	}
+	mapped_data = mmap(
+	               NULL,
+	               (size_t) file_statistics.st_size,
+	               PROT_READ,
+	               MAP_PRIVATE,
+	               io_handle->file_descriptor,
+	               0 );
+
+	if( mapped_data == MAP_FAILED )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to map file.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->mapped_data      = (uint8_t *) mapped_data;
+	io_handle->mapped_data_size = (size64_t) file_statistics.st_size;
+
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Closes the file opened by libesedb_io_handle_open_file, removes its memory mapping
+ * and frees the pages cache and the read-ahead data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_close_file(
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_close_file";
+	int result            = 1;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MMAP ) && !defined( WINAPI )
+	if( io_handle->mapped_data != NULL )
+	{
+		if( munmap(
+		     io_handle->mapped_data,
+		     (size_t) io_handle->mapped_data_size ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 errno,
+			 "%s: unable to unmap file.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	io_handle->mapped_data      = NULL;
+	io_handle->mapped_data_size = 0;
+
+#if ( defined( HAVE_PREAD ) || defined( HAVE_MMAP ) ) && !defined( WINAPI )
+	if( io_handle->file_descriptor != -1 )
+	{
+		if( close(
+		     io_handle->file_descriptor ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to close file.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	io_handle->file_descriptor = -1;
+
+	if( io_handle->pages_cache != NULL )
+	{
+		if( libesedb_page_cache_free(
+		     &( io_handle->pages_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free pages cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	io_handle->read_ahead_first_page_number = 0;
+	io_handle->read_ahead_last_page_number  = 0;
+
+	return( result );
+}
+
+/* Reads a buffer at a specific offset without changing the offset of the file IO handle
+ * The data is copied from the memory mapped file, otherwise it is read using pread( )
+ * on the file opened by libesedb_io_handle_open_file or, for other file IO handles,
+ * read with seek and read while holding the file IO handle mutex
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libesedb_io_handle_read_buffer_at_offset(
+         libesedb_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libesedb_io_handle_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+#if defined( HAVE_PREAD ) && !defined( WINAPI )
+	size_t buffer_offset  = 0;
+#endif
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->mapped_data != NULL )
+	{
+		if( (size64_t) offset >= io_handle->mapped_data_size )
+		{
+			return( 0 );
+		}
+		if( (size64_t) buffer_size > ( io_handle->mapped_data_size - (size64_t) offset ) )
+		{
+			buffer_size = (size_t) ( io_handle->mapped_data_size - (size64_t) offset );
+		}
+		if( memory_copy(
+		     buffer,
+		     &( io_handle->mapped_data[ offset ] ),
+		     buffer_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy mapped data.",
+			 function );
+
+			return( -1 );
+		}
+		return( (ssize_t) buffer_size );
+	}
+#if defined( HAVE_PREAD ) && !defined( WINAPI )
+	if( io_handle->file_descriptor != -1 )
+	{
+		while( buffer_offset < buffer_size )
+		{
+			read_count = pread(
+			              io_handle->file_descriptor,
+			              &( buffer[ buffer_offset ] ),
+			              buffer_size - buffer_offset,
+			              (off_t) ( offset + buffer_offset ) );
+
+			if( read_count == -1 )
+			{
+				if( errno == EINTR )
+				{
+					continue;
+				}
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 errno,
+				 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 offset,
+				 offset );
+
+				return( -1 );
+			}
+			if( read_count == 0 )
+			{
+				break;
+			}
+			buffer_offset += (size_t) read_count;
+		}
+		return( (ssize_t) buffer_offset );
+	}
+#endif
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     io_handle->file_io_handle_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab file IO handle mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		read_count = -1;
+	}
+	else
+	{
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              buffer,
+		              buffer_size,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+		}
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     io_handle->file_io_handle_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Reads a run of contiguous pages using a single read
+ * Every page of the run that is not cached is stored in the pages cache as its own entry.
+ * The run is limited to the size of the recent queue of the pages cache, since the pages
+ * at the end of a longer run would evict the pages at its start before these are used.
+ * Pages that cannot be read are not cached, their error is reported when these are
+ * retrieved from the pages cache
+ * The pages are read synchronously, this function returns after the run was read
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_io_handle_read_pages(
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t first_page_number,
+     uint32_t number_of_pages,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page         = NULL;
+	uint8_t *pages_data           = NULL;
+	static char *function         = "libesedb_io_handle_read_pages";
+	size_t read_size              = 0;
+	ssize_t read_count            = 0;
+	off64_t read_offset           = 0;
+	uint32_t number_of_read_pages = 0;
+	uint32_t page_index           = 0;
+	uint32_t page_number          = 0;
+	int entry_index               = 0;
+	int is_cached                 = 0;
+	int result                    = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->page_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing page size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_page_number == 0 )
+	 || ( first_page_number > io_handle->last_page_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first page number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_pages == 0 )
+	 || ( number_of_pages > LIBESEDB_READ_AHEAD_MAXIMUM_NUMBER_OF_PAGES )
+	 || ( number_of_pages > ( io_handle->last_page_number - first_page_number + 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of pages value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->pages_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing pages cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_pages > (uint32_t) io_handle->pages_cache->maximum_number_of_recent_pages )
+	{
+		number_of_pages = (uint32_t) io_handle->pages_cache->maximum_number_of_recent_pages;
+	}
+	read_size = (size_t) number_of_pages * io_handle->page_size;
+
+	if( read_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid IO handle value already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid read size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	*io_handle = memory_allocate_structure(
-	              libesedb_io_handle_t );
+	read_offset = io_handle->pages_data_offset
+	            + ( (off64_t) ( first_page_number - 1 ) * io_handle->page_size );
 
-	if( *io_handle == NULL )
+	pages_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * read_size );
+
+	if( pages_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create IO handle.",
+		 "%s: unable to create pages data.",
 		 function );
 
 		goto on_error;
 	}
-	if( memory_set(
-	     *io_handle,
-	     0,
-	     sizeof( libesedb_io_handle_t ) ) == NULL )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading %" PRIu32 " pages from page: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 number_of_pages,
+		 first_page_number,
+		 read_offset,
+		 read_offset );
+	}
+#endif
+	read_count = libesedb_io_handle_read_buffer_at_offset(
+	              io_handle,
+	              file_io_handle,
+	              pages_data,
+	              read_size,
+	              read_offset,
+	              error );
+
+	if( read_count == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read pages.",
 		 function );
 
 		goto on_error;
 	}
-	( *io_handle )->ascii_codepage = LIBESEDB_CODEPAGE_WINDOWS_1252;
+	number_of_read_pages = (uint32_t) ( (size_t) read_count / io_handle->page_size );
+
+	for( page_index = 0;
+	     page_index < number_of_read_pages;
+	     page_index++ )
+	{
+		page_number = first_page_number + page_index;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     io_handle->file_io_handle_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab file IO handle mutex.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		/* The entry is looked up directly since retrieving the page
+		 * would count as a use of the page in the pages cache
+		 */
+		entry_index = libesedb_page_cache_get_entry_index(
+		               io_handle->pages_cache,
+		               page_number );
+
+		is_cached = 0;
+
+		if( ( entry_index != -1 )
+		 && ( io_handle->pages_cache->entries[ entry_index ].page != NULL ) )
+		{
+			is_cached = 1;
+		}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     io_handle->file_io_handle_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release file IO handle mutex.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		if( is_cached != 0 )
+		{
+			continue;
+		}
+		if( libesedb_page_initialize(
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		page->data = (uint8_t *) memory_allocate(
+		                          (size_t) io_handle->page_size );
+
+		if( page->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create page: %" PRIu32 " data.",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		page->data_size = (size_t) io_handle->page_size;
+		page->offset    = read_offset + ( (off64_t) page_index * io_handle->page_size );
+
+		if( memory_copy(
+		     page->data,
+		     &( pages_data[ (size_t) page_index * io_handle->page_size ] ),
+		     page->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy page: %" PRIu32 " data.",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		if( libesedb_page_read_data(
+		     page,
+		     io_handle,
+		     error ) != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( libcnotify_verbose != 0 )
+			 && ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			if( libesedb_page_free(
+			     &page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free page: %" PRIu32 ".",
+				 function,
+				 page_number );
+
+				goto on_error;
+			}
+			continue;
+		}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     io_handle->file_io_handle_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab file IO handle mutex.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		/* The reference of the pages cache
+		 */
+		page->number_of_references = 1;
+
+		/* If another reader cached the page in the meantime the page read here
+		 * is freed and replaced by the cached page
+		 */
+		result = libesedb_page_cache_set_page(
+		          io_handle->pages_cache,
+		          page_number,
+		          (intptr_t **) &page,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set page: %" PRIu32 " in cache.",
+			 function,
+			 page_number );
+
+			result = -1;
+		}
+		else
+		{
+			/* The page is owned by the pages cache
+			 */
+			page = NULL;
+		}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     io_handle->file_io_handle_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release file IO handle mutex.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		if( result != 1 )
+		{
+			goto on_error;
+		}
+	}
+	memory_free(
+	 pages_data );
 
 	return( 1 );
 
 on_error:
-	if( *io_handle != NULL )
+	if( page != NULL )
+	{
+		libesedb_page_free(
+		 &page,
+		 NULL );
+	}
+	if( pages_data != NULL )
 	{
 		memory_free(
-		 *io_handle );
-
-		*io_handle = NULL;
+		 pages_data );
 	}
 	return( -1 );
 }
 
-/* Frees an IO handle
- * Returns 1 if successful or -1 on error
+/* Reads ahead the pages following a leaf page
+ * The read-ahead window is started when the page read is the next page of
+ * the previously read leaf page, it doubles on every following page of the
+ * same chain, up to LIBESEDB_READ_AHEAD_MAXIMUM_NUMBER_OF_PAGES, and is
+ * reset when the chain is left. When the next page is not within the run
+ * of pages read-ahead before, the pages that follow the next page in file
+ * order are read-ahead. For a memory mapped file the operating system is
+ * advised to read-ahead the pages using madvise( ), otherwise the pages are
+ * read as a single run and stored in the pages cache by
+ * libesedb_io_handle_read_pages
+ * The read-ahead is synchronous, there is no background thread, hence the read of
+ * the leaf page that triggered the read-ahead also waits for the read of the run,
+ * the benefit is a single large read instead of a read per page
+ * The read-ahead state is only accessed while holding the file IO handle mutex
+ * Returns 1 if pages were read-ahead, 0 if not or -1 on error
  */
-int libesedb_io_handle_free(
-     libesedb_io_handle_t **io_handle,
+int libesedb_io_handle_read_ahead(
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t page_number,
+     uint32_t next_page_number,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_io_handle_free";
-	int result            = 1;
+	static char *function              = "libesedb_io_handle_read_ahead";
+	uint32_t number_of_pages           = 0;
+
+#if defined( HAVE_MADVISE ) && defined( HAVE_MMAP ) && !defined( WINAPI )
+	off64_t aligned_read_ahead_offset  = 0;
+	off64_t read_ahead_offset          = 0;
+	size64_t read_ahead_size           = 0;
+	long system_page_size              = 0;
+#endif
 
 	if( io_handle == NULL )
 	{
@@ -137,52 +1519,162 @@ int libesedb_io_handle_free(
 
 		return( -1 );
 	}
-	if( *io_handle != NULL )
+	if( io_handle->page_size == 0 )
 	{
-		memory_free(
-		 *io_handle );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing page size.",
+		 function );
 
-		*io_handle = NULL;
+		return( -1 );
 	}
-	return( result );
-}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     io_handle->file_io_handle_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab file IO handle mutex.",
+		 function );
 
-/* Clears the IO handle
- * Returns 1 if successful or -1 on error
- */
-int libesedb_io_handle_clear(
-     libesedb_io_handle_t *io_handle,
-     libcerror_error_t **error )
-{
-	static char *function = "libesedb_io_handle_clear";
+		return( -1 );
+	}
+#endif
+	if( ( next_page_number == 0 )
+	 || ( next_page_number <= page_number )
+	 || ( next_page_number > io_handle->last_page_number ) )
+	{
+		io_handle->read_ahead_expected_page_number = 0;
+		io_handle->read_ahead_number_of_pages      = 0;
+	}
+	else if( ( page_number == 0 )
+	      || ( page_number != io_handle->read_ahead_expected_page_number ) )
+	{
+		io_handle->read_ahead_expected_page_number = next_page_number;
+		io_handle->read_ahead_number_of_pages      = 0;
+	}
+	else
+	{
+		io_handle->read_ahead_expected_page_number = next_page_number;
 
-	if( io_handle == NULL )
+		if( io_handle->read_ahead_number_of_pages == 0 )
+		{
+			io_handle->read_ahead_number_of_pages = LIBESEDB_READ_AHEAD_MINIMUM_NUMBER_OF_PAGES;
+		}
+		else if( io_handle->read_ahead_number_of_pages < LIBESEDB_READ_AHEAD_MAXIMUM_NUMBER_OF_PAGES )
+		{
+			io_handle->read_ahead_number_of_pages *= 2;
+
+			if( io_handle->read_ahead_number_of_pages > LIBESEDB_READ_AHEAD_MAXIMUM_NUMBER_OF_PAGES )
+			{
+				io_handle->read_ahead_number_of_pages = LIBESEDB_READ_AHEAD_MAXIMUM_NUMBER_OF_PAGES;
+			}
+		}
+		/* Do not read-ahead when the next page is part of the previous run
+		 */
+		if( ( next_page_number < io_handle->read_ahead_first_page_number )
+		 || ( next_page_number > io_handle->read_ahead_last_page_number ) )
+		{
+			number_of_pages = io_handle->read_ahead_number_of_pages;
+
+			if( number_of_pages > ( io_handle->last_page_number - next_page_number + 1 ) )
+			{
+				number_of_pages = io_handle->last_page_number - next_page_number + 1;
+			}
+			/* The run is claimed before it is read so that concurrent readers
+			 * of the same chain do not read it again
+			 */
+			io_handle->read_ahead_first_page_number = next_page_number;
+			io_handle->read_ahead_last_page_number  = next_page_number + number_of_pages - 1;
+		}
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     io_handle->file_io_handle_mutex,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle mutex.",
 		 function );
 
 		return( -1 );
 	}
-	if( memory_set(
+#endif
+	if( number_of_pages == 0 )
+	{
+		return( 0 );
+	}
+	if( io_handle->mapped_data != NULL )
+	{
+#if defined( HAVE_MADVISE ) && defined( HAVE_MMAP ) && !defined( WINAPI )
+		read_ahead_offset = io_handle->pages_data_offset
+		                  + ( (off64_t) ( next_page_number - 1 ) * io_handle->page_size );
+		read_ahead_size   = (size64_t) number_of_pages * io_handle->page_size;
+
+		if( (size64_t) read_ahead_offset >= io_handle->mapped_data_size )
+		{
+			return( 0 );
+		}
+		if( read_ahead_size > ( io_handle->mapped_data_size - (size64_t) read_ahead_offset ) )
+		{
+			read_ahead_size = io_handle->mapped_data_size - (size64_t) read_ahead_offset;
+		}
+		/* madvise( ) requires an address aligned to the system page size
+		 */
+		system_page_size = sysconf(
+		                    _SC_PAGESIZE );
+
+		if( system_page_size <= 0 )
+		{
+			return( 0 );
+		}
+		aligned_read_ahead_offset = read_ahead_offset - ( read_ahead_offset % (off64_t) system_page_size );
+
+		/* The advice is a hint hence failures are ignored
+		 */
+		if( madvise(
+		     &( io_handle->mapped_data[ aligned_read_ahead_offset ] ),
+		     (size_t) ( read_ahead_size + (size64_t) ( read_ahead_offset - aligned_read_ahead_offset ) ),
+		     MADV_WILLNEED ) != 0 )
+		{
+			return( 0 );
+		}
+		return( 1 );
+#else
+		return( 0 );
+#endif
+	}
+	if( ( io_handle->file_descriptor == -1 )
+	 && ( file_io_handle == NULL ) )
+	{
+		return( 0 );
+	}
+	if( libesedb_io_handle_read_pages(
 	     io_handle,
-	     0,
-	     sizeof( libesedb_io_handle_t ) ) == NULL )
+	     file_io_handle,
+	     next_page_number,
+	     number_of_pages,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear IO handle.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read %" PRIu32 " pages from page: %" PRIu32 ".",
+		 function,
+		 number_of_pages,
+		 next_page_number );
 
 		return( -1 );
 	}
-	io_handle->ascii_codepage = LIBESEDB_CODEPAGE_WINDOWS_1252;
-
 	return( 1 );
 }
 
@@ -234,10 +1726,13 @@ int libesedb_io_handle_read_file_header(
      off64_t file_offset,
      libcerror_error_t **error )
 {
+	uint8_t database_signature[ 28 ];
+
 	uint8_t *file_header_data          = NULL;
 	static char *function              = "libesedb_io_handle_read_file_header";
 	size_t read_size                   = 2048;
 	ssize_t read_count                 = 0;
+	uint64_t database_time             = 0;
 	uint32_t calculated_xor32_checksum = 0;
 	uint32_t creation_format_revision  = 0;
 	uint32_t creation_format_version   = 0;
@@ -399,6 +1894,24 @@ int libesedb_io_handle_read_file_header(
 	 ( (esedb_file_header_t *) file_header_data )->creation_format_revision,
 	 creation_format_revision );
 
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (esedb_file_header_t *) file_header_data )->database_time,
+	 database_time );
+
+	if( memory_copy(
+	     database_signature,
+	     ( (esedb_file_header_t *) file_header_data )->database_signature,
+	     28 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy database signature.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -836,6 +2349,22 @@ int libesedb_io_handle_read_file_header(
 		io_handle->page_size                = page_size;
 		io_handle->creation_format_version  = creation_format_version;
 		io_handle->creation_format_revision = creation_format_revision;
+		io_handle->database_time            = database_time;
+
+		if( memory_copy(
+		     io_handle->database_signature,
+		     database_signature,
+		     28 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy database signature.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	else
 	{
@@ -906,88 +2435,3 @@ on_error:
 	return( -1 );
 }
 
-/* Reads a page
- * Callback function for the page vector
- * Returns 1 if successful or -1 on error
- */
-int libesedb_io_handle_read_page(
-     libesedb_io_handle_t *io_handle,
-     libbfio_handle_t *file_io_handle,
-     libfdata_vector_t *vector,
-     libfcache_cache_t *cache,
-     int element_index,
-     int element_file_index LIBESEDB_ATTRIBUTE_UNUSED,
-     off64_t element_offset,
-     size64_t element_size LIBESEDB_ATTRIBUTE_UNUSED,
-     uint32_t element_flags LIBESEDB_ATTRIBUTE_UNUSED,
-     uint8_t read_flags LIBESEDB_ATTRIBUTE_UNUSED,
-     libcerror_error_t **error )
-{
-	libesedb_page_t *page = NULL;
-	static char *function = "libesedb_io_handle_read_page";
-
-	LIBESEDB_UNREFERENCED_PARAMETER( element_file_index );
-	LIBESEDB_UNREFERENCED_PARAMETER( element_size );
-	LIBESEDB_UNREFERENCED_PARAMETER( element_flags );
-	LIBESEDB_UNREFERENCED_PARAMETER( read_flags );
-
-	if( libesedb_page_initialize(
-	     &page,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create page.",
-		 function );
-
-		goto on_error;
-	}
-	if( libesedb_page_read(
-	     page,
-	     io_handle,
-	     file_io_handle,
-	     element_offset,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read page.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfdata_vector_set_element_value_by_index(
-	     vector,
-	     (intptr_t *) file_io_handle,
-	     cache,
-	     element_index,
-	     (intptr_t *) page,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_free,
-	     LIBFDATA_VECTOR_ELEMENT_VALUE_FLAG_MANAGED,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set page as element value.",
-		 function );
-
-		goto on_error;
-	}
-	return( 1 );
-
-on_error:
-	if( page != NULL )
-	{
-		libesedb_page_free(
-		 &page,
-		 NULL );
-	}
-	return( -1 );
-}
-
@@ -25,10 +25,12 @@
 #include <common.h>
 #include <types.h>
 
+#include "libesedb_layout_index.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
+#include "libesedb_libcthreads.h"
 #include "libesedb_libfcache.h"
-#include "libesedb_libfdata.h"
+#include "libesedb_page_cache.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -60,6 +62,14 @@ struct libesedb_io_handle
 	 */
 	uint32_t creation_format_revision;
 
+	/* The database time
+	 */
+	uint64_t database_time;
+
+	/* The database signature
+	 */
+	uint8_t database_signature[ 28 ];
+
 	/* The pages data offset
 	 */
 	off64_t pages_data_offset;
@@ -76,6 +86,63 @@ struct libesedb_io_handle
 	 */
 	uint32_t last_page_number;
 
+	/* The file descriptor used for positional reads
+	 */
+	int file_descriptor;
+
+	/* The memory mapped file data
+	 */
+	uint8_t *mapped_data;
+
+	/* The memory mapped file data size
+	 */
+	size64_t mapped_data_size;
+
+	/* The pages cache
+	 */
+	libesedb_page_cache_t *pages_cache;
+
+	/* The page number expected to be read next by a forward leaf page scan
+	 */
+	uint32_t read_ahead_expected_page_number;
+
+	/* The read-ahead window in number of pages
+	 */
+	uint32_t read_ahead_number_of_pages;
+
+	/* The first page number of the run of pages that was read-ahead
+	 */
+	uint32_t read_ahead_first_page_number;
+
+	/* The last page number of the run of pages that was read-ahead
+	 */
+	uint32_t read_ahead_last_page_number;
+
+	/* The maximum size of the pages cache in bytes, 0 represents the default
+	 */
+	size64_t maximum_pages_cache_size;
+
+	/* The maximum size of the (table and index) values caches in bytes, 0 represents the default
+	 */
+	size64_t maximum_values_cache_size;
+
+	/* The maximum size of the long values caches in bytes, 0 represents the default
+	 */
+	size64_t maximum_long_values_cache_size;
+
+	/* The checksum verification mode
+	 */
+	int checksum_verification_mode;
+
+	/* The number of pages with a checksum mismatch
+	 * which is accessed while holding the file IO handle mutex
+	 */
+	uint64_t number_of_checksum_mismatches;
+
+	/* The layout index, owned by the file
+	 */
+	libesedb_layout_index_t *layout_index;
+
 	/* The codepage of the ASCII strings
 	 */
 	int ascii_codepage;
@@ -83,6 +150,12 @@ struct libesedb_io_handle
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	/* The mutex serializing seek and read on the file IO handle
+	 */
+	libcthreads_mutex_t *file_io_handle_mutex;
+#endif
 };
 
 int libesedb_io_handle_initialize(
@@ -97,28 +170,75 @@ int libesedb_io_handle_clear(
      libesedb_io_handle_t *io_handle,
      libcerror_error_t **error );
 
-int libesedb_io_handle_set_pages_data_range(
+int libesedb_io_handle_get_cache_entry_size(
      libesedb_io_handle_t *io_handle,
-     size64_t file_size,
+     int cache_type,
+     size_t *cache_entry_size,
      libcerror_error_t **error );
 
-int libesedb_io_handle_read_file_header(
+int libesedb_io_handle_get_maximum_number_of_cache_entries(
+     libesedb_io_handle_t *io_handle,
+     int cache_type,
+     int default_maximum_number_of_cache_entries,
+     int *maximum_number_of_cache_entries,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_get_cache_size(
+     libesedb_io_handle_t *io_handle,
+     int cache_type,
+     libfcache_cache_t *cache,
+     size64_t *cache_size,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_get_pages_cache_size(
+     libesedb_io_handle_t *io_handle,
+     size64_t *cache_size,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_open_file(
+     libesedb_io_handle_t *io_handle,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_map_file(
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_close_file(
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+ssize_t libesedb_io_handle_read_buffer_at_offset(
+         libesedb_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libesedb_io_handle_read_pages(
      libesedb_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
+     uint32_t first_page_number,
+     uint32_t number_of_pages,
      libcerror_error_t **error );
 
-int libesedb_io_handle_read_page(
+int libesedb_io_handle_read_ahead(
      libesedb_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     libfdata_vector_t *vector,
-     libfcache_cache_t *cache,
-     int element_index,
-     int element_file_index,
-     off64_t element_offset,
-     size64_t element_size,
-     uint32_t element_flags,
-     uint8_t read_flags,
+     uint32_t page_number,
+     uint32_t next_page_number,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_set_pages_data_range(
+     libesedb_io_handle_t *io_handle,
+     size64_t file_size,
+     libcerror_error_t **error );
+
+int libesedb_io_handle_read_file_header(
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
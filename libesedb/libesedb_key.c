@@ -670,3 +670,137 @@ fprintf( stderr, "MARKER\n" );
 	return( result );
 }
 
+/* Compares key data with the key of a page value
+ * The key of the page value consists of the common key data followed by the local key data
+ * The key data is compared byte by byte, where a key that is a prefix of the other key is the lesser
+ * Returns LIBFDATA_COMPARE_LESS, LIBFDATA_COMPARE_EQUAL, LIBFDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libesedb_key_compare_data(
+     const uint8_t *key_data,
+     size_t key_data_size,
+     const uint8_t *common_key_data,
+     size_t common_key_data_size,
+     const uint8_t *local_key_data,
+     size_t local_key_data_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "libesedb_key_compare_data";
+	size_t compare_data_size = 0;
+	size_t key_data_offset   = 0;
+	int compare_result       = 0;
+
+	if( ( key_data == NULL )
+	 && ( key_data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( common_key_data == NULL )
+	 && ( common_key_data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid common key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( local_key_data == NULL )
+	 && ( local_key_data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid local key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( common_key_data_size > 0 )
+	{
+		if( key_data_size < common_key_data_size )
+		{
+			compare_data_size = key_data_size;
+		}
+		else
+		{
+			compare_data_size = common_key_data_size;
+		}
+		if( compare_data_size > 0 )
+		{
+			compare_result = memory_compare(
+			                  key_data,
+			                  common_key_data,
+			                  compare_data_size );
+		}
+		if( compare_result < 0 )
+		{
+			return( LIBFDATA_COMPARE_LESS );
+		}
+		else if( compare_result > 0 )
+		{
+			return( LIBFDATA_COMPARE_GREATER );
+		}
+		if( key_data_size < common_key_data_size )
+		{
+			return( LIBFDATA_COMPARE_LESS );
+		}
+		key_data_offset = common_key_data_size;
+	}
+	key_data_size -= key_data_offset;
+
+	if( key_data_size < local_key_data_size )
+	{
+		compare_data_size = key_data_size;
+	}
+	else
+	{
+		compare_data_size = local_key_data_size;
+	}
+	if( compare_data_size > 0 )
+	{
+		compare_result = memory_compare(
+		                  &( key_data[ key_data_offset ] ),
+		                  local_key_data,
+		                  compare_data_size );
+
+		if( compare_result < 0 )
+		{
+			return( LIBFDATA_COMPARE_LESS );
+		}
+		else if( compare_result > 0 )
+		{
+			return( LIBFDATA_COMPARE_GREATER );
+		}
+	}
+	if( key_data_size < local_key_data_size )
+	{
+		return( LIBFDATA_COMPARE_LESS );
+	}
+	else if( key_data_size > local_key_data_size )
+	{
+		return( LIBFDATA_COMPARE_GREATER );
+	}
+	return( LIBFDATA_COMPARE_EQUAL );
+}
+
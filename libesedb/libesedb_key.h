@@ -73,6 +73,15 @@ int libesedb_key_compare(
      libesedb_key_t *second_key,
      libcerror_error_t **error );
 
+int libesedb_key_compare_data(
+     const uint8_t *key_data,
+     size_t key_data_size,
+     const uint8_t *common_key_data,
+     size_t common_key_data_size,
+     const uint8_t *local_key_data,
+     size_t local_key_data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
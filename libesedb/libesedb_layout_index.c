@@ -0,0 +1,1878 @@
+/*
+ * Layout index functions
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_checksum.h"
+#include "libesedb_definitions.h"
+#include "libesedb_layout_index.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcdata.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libcnotify.h"
+
+#include "esedb_layout_index.h"
+
+const uint8_t esedb_layout_index_signature[ 8 ] = { 'E', 'S', 'E', 'D', 'B', 'L', 'I', 'X' };
+
+/* Frees a layout index definition
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_layout_index_definition_free(
+     libesedb_layout_index_definition_t **definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_layout_index_definition_free";
+
+	if( definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( *definition != NULL )
+	{
+		if( ( *definition )->data != NULL )
+		{
+			memory_free(
+			 ( *definition )->data );
+		}
+		memory_free(
+		 *definition );
+
+		*definition = NULL;
+	}
+	return( 1 );
+}
+
+/* Creates a layout index tree
+ * Make sure the value tree is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_layout_index_tree_initialize(
+     libesedb_layout_index_tree_t **tree,
+     uint32_t root_page_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_layout_index_tree_initialize";
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( *tree != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid tree value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( root_page_number == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid root page number value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*tree = memory_allocate_structure(
+	         libesedb_layout_index_tree_t );
+
+	if( *tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *tree,
+	     0,
+	     sizeof( libesedb_layout_index_tree_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear tree.",
+		 function );
+
+		goto on_error;
+	}
+	( *tree )->root_page_number = root_page_number;
+
+	return( 1 );
+
+on_error:
+	if( *tree != NULL )
+	{
+		memory_free(
+		 *tree );
+
+		*tree = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a layout index tree
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_layout_index_tree_free(
+     libesedb_layout_index_tree_t **tree,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_layout_index_tree_free";
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( *tree != NULL )
+	{
+		if( ( *tree )->leaf_page_number_of_values != NULL )
+		{
+			memory_free(
+			 ( *tree )->leaf_page_number_of_values );
+		}
+		if( ( *tree )->leaf_page_numbers != NULL )
+		{
+			memory_free(
+			 ( *tree )->leaf_page_numbers );
+		}
+		memory_free(
+		 *tree );
+
+		*tree = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a leaf page to a layout index tree
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_layout_index_tree_append_leaf_page(
+     libesedb_layout_index_tree_t *tree,
+     uint32_t page_number,
+     uint32_t number_of_leaf_values,
+     libcerror_error_t **error )
+{
+	uint32_t *reallocation = NULL;
+	static char *function  = "libesedb_layout_index_tree_append_leaf_page";
+	int leaf_pages_size    = 0;
+
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_number == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid page number value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( tree->number_of_leaf_pages >= tree->leaf_pages_size )
+	{
+		if( tree->leaf_pages_size == 0 )
+		{
+			leaf_pages_size = 64;
+		}
+		else
+		{
+			if( tree->leaf_pages_size > ( INT_MAX / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid tree - number of leaf pages value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			leaf_pages_size = tree->leaf_pages_size * 2;
+		}
+		if( (size_t) leaf_pages_size > ( (size_t) SSIZE_MAX / sizeof( uint32_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid leaf pages size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = (uint32_t *) memory_reallocate(
+		                             tree->leaf_page_numbers,
+		                             sizeof( uint32_t ) * leaf_pages_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize leaf page numbers.",
+			 function );
+
+			return( -1 );
+		}
+		tree->leaf_page_numbers = reallocation;
+
+		reallocation = (uint32_t *) memory_reallocate(
+		                             tree->leaf_page_number_of_values,
+		                             sizeof( uint32_t ) * leaf_pages_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize leaf page number of values.",
+			 function );
+
+			return( -1 );
+		}
+		tree->leaf_page_number_of_values = reallocation;
+		tree->leaf_pages_size            = leaf_pages_size;
+	}
+	tree->leaf_page_numbers[ tree->number_of_leaf_pages ]          = page_number;
+	tree->leaf_page_number_of_values[ tree->number_of_leaf_pages ] = number_of_leaf_values;
+
+	tree->number_of_leaf_pages  += 1;
+	tree->number_of_leaf_values += number_of_leaf_values;
+
+	return( 1 );
+}
+
+/* Creates a layout index
+ * Make sure the value layout_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_layout_index_initialize(
+     libesedb_layout_index_t **layout_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_layout_index_initialize";
+
+	if( layout_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *layout_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid layout index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*layout_index = memory_allocate_structure(
+	                 libesedb_layout_index_t );
+
+	if( *layout_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create layout index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *layout_index,
+	     0,
+	     sizeof( libesedb_layout_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear layout index.",
+		 function );
+
+		memory_free(
+		 *layout_index );
+
+		*layout_index = NULL;
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( ( *layout_index )->definitions_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create definitions array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( ( *layout_index )->trees_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create trees array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *layout_index != NULL )
+	{
+		if( ( *layout_index )->definitions_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *layout_index )->definitions_array ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 *layout_index );
+
+		*layout_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a layout index
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_layout_index_free(
+     libesedb_layout_index_t **layout_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_layout_index_free";
+	int result            = 1;
+
+	if( layout_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *layout_index != NULL )
+	{
+		if( libcdata_array_free(
+		     &( ( *layout_index )->definitions_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_layout_index_definition_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free definitions array.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_array_free(
+		     &( ( *layout_index )->trees_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_layout_index_tree_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free trees array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *layout_index );
+
+		*layout_index = NULL;
+	}
+	return( result );
+}
+
+/* Sets the values of the database file the layout index describes
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_layout_index_set_database_values(
+     libesedb_layout_index_t *layout_index,
+     uint32_t page_size,
+     uint32_t last_page_number,
+     uint64_t database_time,
+     const uint8_t *database_signature,
+     size_t database_signature_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_layout_index_set_database_values";
+
+	if( layout_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout index.",
+		 function );
+
+		return( -1 );
+	}
+	if( database_signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid database signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( database_signature_size != 28 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid database signature size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     layout_index->database_signature,
+	     database_signature,
+	     28 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy database signature.",
+		 function );
+
+		return( -1 );
+	}
+	layout_index->page_size        = page_size;
+	layout_index->last_page_number = last_page_number;
+	layout_index->database_time    = database_time;
+
+	return( 1 );
+}
+
+/* Compares the values of the database file with those the layout index describes
+ * Returns 1 if the values match, 0 if not or -1 on error
+ */
+int libesedb_layout_index_compare_database_values(
+     libesedb_layout_index_t *layout_index,
+     uint32_t page_size,
+     uint32_t last_page_number,
+     uint64_t database_time,
+     const uint8_t *database_signature,
+     size_t database_signature_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_layout_index_compare_database_values";
+
+	if( layout_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout index.",
+		 function );
+
+		return( -1 );
+	}
+	if( database_signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid database signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( database_signature_size != 28 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid database signature size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( layout_index->page_size != page_size )
+	 || ( layout_index->last_page_number != last_page_number )
+	 || ( layout_index->database_time != database_time ) )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     layout_index->database_signature,
+	     database_signature,
+	     28 ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Appends a (catalog) definition to the layout index
+ * The definition data is copied
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_layout_index_append_definition(
+     libesedb_layout_index_t *layout_index,
+     uint32_t type,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libesedb_layout_index_definition_t *definition = NULL;
+	static char *function                          = "libesedb_layout_index_append_definition";
+	int entry_index                                = 0;
+
+	if( layout_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( type != LIBESEDB_LAYOUT_INDEX_ENTRY_TYPE_CATALOG_DEFINITION )
+	 && ( type != LIBESEDB_LAYOUT_INDEX_ENTRY_TYPE_BACKUP_CATALOG_DEFINITION ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported type: %" PRIu32 ".",
+		 function,
+		 type );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	definition = memory_allocate_structure(
+	              libesedb_layout_index_definition_t );
+
+	if( definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create definition.",
+		 function );
+
+		goto on_error;
+	}
+	definition->type      = type;
+	definition->data_size = data_size;
+	definition->data      = (uint8_t *) memory_allocate(
+	                                     sizeof( uint8_t ) * data_size );
+
+	if( definition->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create definition data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     definition->data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy definition data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     layout_index->definitions_array,
+	     &entry_index,
+	     (intptr_t *) definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append definition to array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( definition != NULL )
+	{
+		if( definition->data != NULL )
+		{
+			memory_free(
+			 definition->data );
+		}
+		memory_free(
+		 definition );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of (catalog) definitions
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_layout_index_get_number_of_definitions(
+     libesedb_layout_index_t *layout_index,
+     int *number_of_definitions,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_layout_index_get_number_of_definitions";
+
+	if( layout_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     layout_index->definitions_array,
+	     number_of_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from definitions array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific (catalog) definition
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_layout_index_get_definition_by_index(
+     libesedb_layout_index_t *layout_index,
+     int definition_index,
+     libesedb_layout_index_definition_t **definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_layout_index_get_definition_by_index";
+
+	if( layout_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     layout_index->definitions_array,
+	     definition_index,
+	     (intptr_t **) definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve definition: %d from array.",
+		 function,
+		 definition_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a (page) tree to the layout index
+ * The layout index takes over management of the tree
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_layout_index_append_tree(
+     libesedb_layout_index_t *layout_index,
+     libesedb_layout_index_tree_t *tree,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_layout_index_append_tree";
+	int entry_index       = 0;
+
+	if( layout_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout index.",
+		 function );
+
+		return( -1 );
+	}
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_append_entry(
+	     layout_index->trees_array,
+	     &entry_index,
+	     (intptr_t *) tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append tree to array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the (page) tree for a specific root page number
+ * Returns 1 if successful, 0 if no such tree or -1 on error
+ */
+int libesedb_layout_index_get_tree_by_root_page_number(
+     libesedb_layout_index_t *layout_index,
+     uint32_t root_page_number,
+     libesedb_layout_index_tree_t **tree,
+     libcerror_error_t **error )
+{
+	libesedb_layout_index_tree_t *safe_tree = NULL;
+	static char *function                   = "libesedb_layout_index_get_tree_by_root_page_number";
+	int number_of_trees                     = 0;
+	int tree_index                          = 0;
+
+	if( layout_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout index.",
+		 function );
+
+		return( -1 );
+	}
+	if( tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     layout_index->trees_array,
+	     &number_of_trees,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from trees array.",
+		 function );
+
+		return( -1 );
+	}
+	for( tree_index = 0;
+	     tree_index < number_of_trees;
+	     tree_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     layout_index->trees_array,
+		     tree_index,
+		     (intptr_t **) &safe_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve tree: %d from array.",
+			 function,
+			 tree_index );
+
+			return( -1 );
+		}
+		if( ( safe_tree != NULL )
+		 && ( safe_tree->root_page_number == root_page_number ) )
+		{
+			*tree = safe_tree;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Reads a layout index tree from the entry data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_layout_index_read_tree_data(
+     libesedb_layout_index_t *layout_index,
+     uint32_t root_page_number,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libesedb_layout_index_tree_t *tree = NULL;
+	static char *function              = "libesedb_layout_index_read_tree_data";
+	size_t data_offset                 = 0;
+	uint32_t number_of_leaf_values     = 0;
+	uint32_t page_number               = 0;
+
+	if( layout_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout index.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size % sizeof( esedb_layout_index_leaf_page_t ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( root_page_number > layout_index->last_page_number )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid root page number: %" PRIu32 " value out of bounds.",
+		 function,
+		 root_page_number );
+
+		return( -1 );
+	}
+	if( libesedb_layout_index_tree_initialize(
+	     &tree,
+	     root_page_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create tree.",
+		 function );
+
+		goto on_error;
+	}
+	while( data_offset < data_size )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_layout_index_leaf_page_t *) &( data[ data_offset ] ) )->page_number,
+		 page_number );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_layout_index_leaf_page_t *) &( data[ data_offset ] ) )->number_of_leaf_values,
+		 number_of_leaf_values );
+
+		data_offset += sizeof( esedb_layout_index_leaf_page_t );
+
+		if( ( page_number == 0 )
+		 || ( page_number > layout_index->last_page_number ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid leaf page number: %" PRIu32 " value out of bounds.",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		if( libesedb_layout_index_tree_append_leaf_page(
+		     tree,
+		     page_number,
+		     number_of_leaf_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append leaf page: %" PRIu32 " to tree.",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_layout_index_append_tree(
+	     layout_index,
+	     tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append tree.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( tree != NULL )
+	{
+		libesedb_layout_index_tree_free(
+		 &tree,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a layout index
+ * The layout index is read as a whole, its size is small compared to the database file
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_layout_index_read_file_io_handle(
+     libesedb_layout_index_t *layout_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *layout_index_data         = NULL;
+	static char *function              = "libesedb_layout_index_read_file_io_handle";
+	size64_t file_size                 = 0;
+	size_t data_offset                 = 0;
+	size_t layout_index_data_size      = 0;
+	ssize_t read_count                 = 0;
+	uint32_t calculated_xor32_checksum = 0;
+	uint32_t entry_data_size           = 0;
+	uint32_t entry_identifier          = 0;
+	uint32_t entry_index               = 0;
+	uint32_t entry_type                = 0;
+	uint32_t format_version            = 0;
+	uint32_t number_of_entries         = 0;
+	uint32_t stored_xor32_checksum     = 0;
+
+	if( layout_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_size < (size64_t) sizeof( esedb_layout_index_file_header_t ) )
+	 || ( file_size > (size64_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	layout_index_data_size = (size_t) file_size;
+
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek layout index offset: 0.",
+		 function );
+
+		goto on_error;
+	}
+	layout_index_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * layout_index_data_size );
+
+	if( layout_index_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create layout index data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              layout_index_data,
+	              layout_index_data_size,
+	              error );
+
+	if( read_count != (ssize_t) layout_index_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read layout index data.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: file header data:\n",
+		 function );
+		libcnotify_print_data(
+		 layout_index_data,
+		 sizeof( esedb_layout_index_file_header_t ),
+		 0 );
+	}
+#endif
+	if( memory_compare(
+	     ( (esedb_layout_index_file_header_t *) layout_index_data )->signature,
+	     esedb_layout_index_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported layout index signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_layout_index_file_header_t *) layout_index_data )->format_version,
+	 format_version );
+
+	if( format_version != LIBESEDB_LAYOUT_INDEX_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported layout index format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_layout_index_file_header_t *) layout_index_data )->checksum,
+	 stored_xor32_checksum );
+
+	if( libesedb_checksum_calculate_little_endian_xor32(
+	     &calculated_xor32_checksum,
+	     &( layout_index_data[ sizeof( esedb_layout_index_file_header_t ) ] ),
+	     layout_index_data_size - sizeof( esedb_layout_index_file_header_t ),
+	     0x89abcdef,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( stored_xor32_checksum != calculated_xor32_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in layout index checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+		 function,
+		 stored_xor32_checksum,
+		 calculated_xor32_checksum );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_layout_index_file_header_t *) layout_index_data )->page_size,
+	 layout_index->page_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_layout_index_file_header_t *) layout_index_data )->last_page_number,
+	 layout_index->last_page_number );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (esedb_layout_index_file_header_t *) layout_index_data )->database_time,
+	 layout_index->database_time );
+
+	if( memory_copy(
+	     layout_index->database_signature,
+	     ( (esedb_layout_index_file_header_t *) layout_index_data )->database_signature,
+	     28 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy database signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_layout_index_file_header_t *) layout_index_data )->number_of_entries,
+	 number_of_entries );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: format version\t\t: %" PRIu32 "\n",
+		 function,
+		 format_version );
+
+		libcnotify_printf(
+		 "%s: page size\t\t\t: %" PRIu32 "\n",
+		 function,
+		 layout_index->page_size );
+
+		libcnotify_printf(
+		 "%s: last page number\t\t: %" PRIu32 "\n",
+		 function,
+		 layout_index->last_page_number );
+
+		libcnotify_printf(
+		 "%s: database time\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 layout_index->database_time );
+
+		libcnotify_printf(
+		 "%s: number of entries\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_entries );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	data_offset = sizeof( esedb_layout_index_file_header_t );
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( sizeof( esedb_layout_index_entry_header_t ) > ( layout_index_data_size - data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry: %" PRIu32 " header data size value out of bounds.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_layout_index_entry_header_t *) &( layout_index_data[ data_offset ] ) )->type,
+		 entry_type );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_layout_index_entry_header_t *) &( layout_index_data[ data_offset ] ) )->identifier,
+		 entry_identifier );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_layout_index_entry_header_t *) &( layout_index_data[ data_offset ] ) )->data_size,
+		 entry_data_size );
+
+		data_offset += sizeof( esedb_layout_index_entry_header_t );
+
+		if( (size_t) entry_data_size > ( layout_index_data_size - data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry: %" PRIu32 " data size value out of bounds.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		switch( entry_type )
+		{
+			case LIBESEDB_LAYOUT_INDEX_ENTRY_TYPE_CATALOG_DEFINITION:
+			case LIBESEDB_LAYOUT_INDEX_ENTRY_TYPE_BACKUP_CATALOG_DEFINITION:
+				if( libesedb_layout_index_append_definition(
+				     layout_index,
+				     entry_type,
+				     &( layout_index_data[ data_offset ] ),
+				     (size_t) entry_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append definition of entry: %" PRIu32 ".",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+				break;
+
+			case LIBESEDB_LAYOUT_INDEX_ENTRY_TYPE_PAGE_TREE:
+				if( libesedb_layout_index_read_tree_data(
+				     layout_index,
+				     entry_identifier,
+				     &( layout_index_data[ data_offset ] ),
+				     (size_t) entry_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read tree of entry: %" PRIu32 ".",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported entry: %" PRIu32 " type: %" PRIu32 ".",
+				 function,
+				 entry_index,
+				 entry_type );
+
+				goto on_error;
+		}
+		data_offset += (size_t) entry_data_size;
+	}
+	if( data_offset != layout_index_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid layout index data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 layout_index_data );
+
+	return( 1 );
+
+on_error:
+	if( layout_index_data != NULL )
+	{
+		memory_free(
+		 layout_index_data );
+	}
+	libcdata_array_empty(
+	 layout_index->definitions_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_layout_index_definition_free,
+	 NULL );
+
+	libcdata_array_empty(
+	 layout_index->trees_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_layout_index_tree_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Writes a layout index
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_layout_index_write_file_io_handle(
+     libesedb_layout_index_t *layout_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libesedb_layout_index_definition_t *definition = NULL;
+	libesedb_layout_index_tree_t *tree             = NULL;
+	uint8_t *layout_index_data                     = NULL;
+	static char *function                          = "libesedb_layout_index_write_file_io_handle";
+	size_t data_offset                             = 0;
+	size_t entry_data_size                         = 0;
+	size_t layout_index_data_size                  = 0;
+	ssize_t write_count                            = 0;
+	uint32_t calculated_xor32_checksum             = 0;
+	int definition_index                           = 0;
+	int leaf_page_index                            = 0;
+	int number_of_definitions                      = 0;
+	int number_of_trees                            = 0;
+	int tree_index                                 = 0;
+
+	if( layout_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     layout_index->definitions_array,
+	     &number_of_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from definitions array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     layout_index->trees_array,
+	     &number_of_trees,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from trees array.",
+		 function );
+
+		goto on_error;
+	}
+	/* Determine the size of the layout index data
+	 */
+	layout_index_data_size = sizeof( esedb_layout_index_file_header_t );
+
+	for( definition_index = 0;
+	     definition_index < number_of_definitions;
+	     definition_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     layout_index->definitions_array,
+		     definition_index,
+		     (intptr_t **) &definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve definition: %d from array.",
+			 function,
+			 definition_index );
+
+			goto on_error;
+		}
+		if( definition == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing definition: %d.",
+			 function,
+			 definition_index );
+
+			goto on_error;
+		}
+		if( definition->data_size > ( (size_t) SSIZE_MAX - layout_index_data_size - sizeof( esedb_layout_index_entry_header_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid layout index data size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		layout_index_data_size += sizeof( esedb_layout_index_entry_header_t ) + definition->data_size;
+	}
+	for( tree_index = 0;
+	     tree_index < number_of_trees;
+	     tree_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     layout_index->trees_array,
+		     tree_index,
+		     (intptr_t **) &tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve tree: %d from array.",
+			 function,
+			 tree_index );
+
+			goto on_error;
+		}
+		if( tree == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing tree: %d.",
+			 function,
+			 tree_index );
+
+			goto on_error;
+		}
+		entry_data_size = (size_t) tree->number_of_leaf_pages * sizeof( esedb_layout_index_leaf_page_t );
+
+		if( ( entry_data_size > (size_t) UINT32_MAX )
+		 || ( entry_data_size > ( (size_t) SSIZE_MAX - layout_index_data_size - sizeof( esedb_layout_index_entry_header_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid layout index data size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		layout_index_data_size += sizeof( esedb_layout_index_entry_header_t ) + entry_data_size;
+	}
+	layout_index_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * layout_index_data_size );
+
+	if( layout_index_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create layout index data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     layout_index_data,
+	     0,
+	     sizeof( esedb_layout_index_file_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file header data.",
+		 function );
+
+		goto on_error;
+	}
+	data_offset = sizeof( esedb_layout_index_file_header_t );
+
+	for( definition_index = 0;
+	     definition_index < number_of_definitions;
+	     definition_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     layout_index->definitions_array,
+		     definition_index,
+		     (intptr_t **) &definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve definition: %d from array.",
+			 function,
+			 definition_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (esedb_layout_index_entry_header_t *) &( layout_index_data[ data_offset ] ) )->type,
+		 definition->type );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (esedb_layout_index_entry_header_t *) &( layout_index_data[ data_offset ] ) )->identifier,
+		 0 );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (esedb_layout_index_entry_header_t *) &( layout_index_data[ data_offset ] ) )->data_size,
+		 (uint32_t) definition->data_size );
+
+		data_offset += sizeof( esedb_layout_index_entry_header_t );
+
+		if( memory_copy(
+		     &( layout_index_data[ data_offset ] ),
+		     definition->data,
+		     definition->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy definition: %d data.",
+			 function,
+			 definition_index );
+
+			goto on_error;
+		}
+		data_offset += definition->data_size;
+	}
+	for( tree_index = 0;
+	     tree_index < number_of_trees;
+	     tree_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     layout_index->trees_array,
+		     tree_index,
+		     (intptr_t **) &tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve tree: %d from array.",
+			 function,
+			 tree_index );
+
+			goto on_error;
+		}
+		entry_data_size = (size_t) tree->number_of_leaf_pages * sizeof( esedb_layout_index_leaf_page_t );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (esedb_layout_index_entry_header_t *) &( layout_index_data[ data_offset ] ) )->type,
+		 LIBESEDB_LAYOUT_INDEX_ENTRY_TYPE_PAGE_TREE );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (esedb_layout_index_entry_header_t *) &( layout_index_data[ data_offset ] ) )->identifier,
+		 tree->root_page_number );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (esedb_layout_index_entry_header_t *) &( layout_index_data[ data_offset ] ) )->data_size,
+		 (uint32_t) entry_data_size );
+
+		data_offset += sizeof( esedb_layout_index_entry_header_t );
+
+		for( leaf_page_index = 0;
+		     leaf_page_index < tree->number_of_leaf_pages;
+		     leaf_page_index++ )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (esedb_layout_index_leaf_page_t *) &( layout_index_data[ data_offset ] ) )->page_number,
+			 tree->leaf_page_numbers[ leaf_page_index ] );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (esedb_layout_index_leaf_page_t *) &( layout_index_data[ data_offset ] ) )->number_of_leaf_values,
+			 tree->leaf_page_number_of_values[ leaf_page_index ] );
+
+			data_offset += sizeof( esedb_layout_index_leaf_page_t );
+		}
+	}
+	if( libesedb_checksum_calculate_little_endian_xor32(
+	     &calculated_xor32_checksum,
+	     &( layout_index_data[ sizeof( esedb_layout_index_file_header_t ) ] ),
+	     layout_index_data_size - sizeof( esedb_layout_index_file_header_t ),
+	     0x89abcdef,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     ( (esedb_layout_index_file_header_t *) layout_index_data )->signature,
+	     esedb_layout_index_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_layout_index_file_header_t *) layout_index_data )->format_version,
+	 LIBESEDB_LAYOUT_INDEX_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_layout_index_file_header_t *) layout_index_data )->page_size,
+	 layout_index->page_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_layout_index_file_header_t *) layout_index_data )->last_page_number,
+	 layout_index->last_page_number );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (esedb_layout_index_file_header_t *) layout_index_data )->database_time,
+	 layout_index->database_time );
+
+	if( memory_copy(
+	     ( (esedb_layout_index_file_header_t *) layout_index_data )->database_signature,
+	     layout_index->database_signature,
+	     28 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy database signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_layout_index_file_header_t *) layout_index_data )->number_of_entries,
+	 (uint32_t) ( number_of_definitions + number_of_trees ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_layout_index_file_header_t *) layout_index_data )->checksum,
+	 calculated_xor32_checksum );
+
+	write_count = libbfio_handle_write_buffer(
+	               file_io_handle,
+	               layout_index_data,
+	               layout_index_data_size,
+	               error );
+
+	if( write_count != (ssize_t) layout_index_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write layout index data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 layout_index_data );
+
+	return( 1 );
+
+on_error:
+	if( layout_index_data != NULL )
+	{
+		memory_free(
+		 layout_index_data );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,209 @@
+/*
+ * Layout index functions
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_LAYOUT_INDEX_H )
+#define _LIBESEDB_LAYOUT_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_libbfio.h"
+#include "libesedb_libcdata.h"
+#include "libesedb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+extern const uint8_t esedb_layout_index_signature[ 8 ];
+
+typedef struct libesedb_layout_index_definition libesedb_layout_index_definition_t;
+
+struct libesedb_layout_index_definition
+{
+	/* The entry type
+	 */
+	uint32_t type;
+
+	/* The (catalog) definition data
+	 */
+	uint8_t *data;
+
+	/* The (catalog) definition data size
+	 */
+	size_t data_size;
+};
+
+typedef struct libesedb_layout_index_tree libesedb_layout_index_tree_t;
+
+struct libesedb_layout_index_tree
+{
+	/* The root page number
+	 */
+	uint32_t root_page_number;
+
+	/* The leaf page numbers, in the order of the leaf page chain
+	 */
+	uint32_t *leaf_page_numbers;
+
+	/* The number of leaf values of every leaf page
+	 */
+	uint32_t *leaf_page_number_of_values;
+
+	/* The number of leaf pages
+	 */
+	int number_of_leaf_pages;
+
+	/* The number of allocated leaf page entries
+	 */
+	int leaf_pages_size;
+
+	/* The total number of leaf values
+	 */
+	uint64_t number_of_leaf_values;
+};
+
+typedef struct libesedb_layout_index libesedb_layout_index_t;
+
+struct libesedb_layout_index
+{
+	/* The page size of the database file
+	 */
+	uint32_t page_size;
+
+	/* The last page number of the database file
+	 */
+	uint32_t last_page_number;
+
+	/* The database time of the database file header
+	 */
+	uint64_t database_time;
+
+	/* The database signature of the database file header
+	 */
+	uint8_t database_signature[ 28 ];
+
+	/* The (catalog) definitions array
+	 */
+	libcdata_array_t *definitions_array;
+
+	/* The (page) trees array
+	 */
+	libcdata_array_t *trees_array;
+};
+
+int libesedb_layout_index_definition_free(
+     libesedb_layout_index_definition_t **definition,
+     libcerror_error_t **error );
+
+int libesedb_layout_index_tree_initialize(
+     libesedb_layout_index_tree_t **tree,
+     uint32_t root_page_number,
+     libcerror_error_t **error );
+
+int libesedb_layout_index_tree_free(
+     libesedb_layout_index_tree_t **tree,
+     libcerror_error_t **error );
+
+int libesedb_layout_index_tree_append_leaf_page(
+     libesedb_layout_index_tree_t *tree,
+     uint32_t page_number,
+     uint32_t number_of_leaf_values,
+     libcerror_error_t **error );
+
+int libesedb_layout_index_initialize(
+     libesedb_layout_index_t **layout_index,
+     libcerror_error_t **error );
+
+int libesedb_layout_index_free(
+     libesedb_layout_index_t **layout_index,
+     libcerror_error_t **error );
+
+int libesedb_layout_index_set_database_values(
+     libesedb_layout_index_t *layout_index,
+     uint32_t page_size,
+     uint32_t last_page_number,
+     uint64_t database_time,
+     const uint8_t *database_signature,
+     size_t database_signature_size,
+     libcerror_error_t **error );
+
+int libesedb_layout_index_compare_database_values(
+     libesedb_layout_index_t *layout_index,
+     uint32_t page_size,
+     uint32_t last_page_number,
+     uint64_t database_time,
+     const uint8_t *database_signature,
+     size_t database_signature_size,
+     libcerror_error_t **error );
+
+int libesedb_layout_index_append_definition(
+     libesedb_layout_index_t *layout_index,
+     uint32_t type,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libesedb_layout_index_get_number_of_definitions(
+     libesedb_layout_index_t *layout_index,
+     int *number_of_definitions,
+     libcerror_error_t **error );
+
+int libesedb_layout_index_get_definition_by_index(
+     libesedb_layout_index_t *layout_index,
+     int definition_index,
+     libesedb_layout_index_definition_t **definition,
+     libcerror_error_t **error );
+
+int libesedb_layout_index_append_tree(
+     libesedb_layout_index_t *layout_index,
+     libesedb_layout_index_tree_t *tree,
+     libcerror_error_t **error );
+
+int libesedb_layout_index_get_tree_by_root_page_number(
+     libesedb_layout_index_t *layout_index,
+     uint32_t root_page_number,
+     libesedb_layout_index_tree_t **tree,
+     libcerror_error_t **error );
+
+int libesedb_layout_index_read_tree_data(
+     libesedb_layout_index_t *layout_index,
+     uint32_t root_page_number,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libesedb_layout_index_read_file_io_handle(
+     libesedb_layout_index_t *layout_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libesedb_layout_index_write_file_io_handle(
+     libesedb_layout_index_t *layout_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_LAYOUT_INDEX_H ) */
+
@@ -27,71 +27,72 @@
 #include "libesedb_checksum.h"
 #include "libesedb_debug.h"
 #include "libesedb_definitions.h"
+#include "libesedb_key.h"
 #include "libesedb_libbfio.h"
-#include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
+#include "libesedb_libfdata.h"
 #include "libesedb_page.h"
 #include "libesedb_page_value.h"
 
 #include "esedb_page.h"
 
-/* Creates a page tags value
- * Make sure the value page_tags_value is referencing, is set to NULL
+/* Creates a page
+ * Make sure the value page is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
-int libesedb_page_tags_value_initialize(
-     libesedb_page_tags_value_t **page_tags_value,
+int libesedb_page_initialize(
+     libesedb_page_t **page,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_page_tags_value_initialize";
+	static char *function = "libesedb_page_initialize";
 
-	if( page_tags_value == NULL )
+	if( page == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid page tags value.",
+		 "%s: invalid page.",
 		 function );
 
 		return( -1 );
 	}
-	if( *page_tags_value != NULL )
+	if( *page != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid page tags value value already set.",
+		 "%s: invalid page value already set.",
 		 function );
 
 		return( -1 );
 	}
-	*page_tags_value = memory_allocate_structure(
-	                    libesedb_page_tags_value_t );
+	*page = memory_allocate_structure(
+	         libesedb_page_t );
 
-	if( *page_tags_value == NULL )
+	if( *page == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create page tags value.",
+		 "%s: unable to create page.",
 		 function );
 
 		goto on_error;
 	}
 	if( memory_set(
-	     *page_tags_value,
+	     *page,
 	     0,
-	     sizeof( libesedb_page_tags_value_t ) ) == NULL )
+	     sizeof( libesedb_page_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear page tags value.",
+		 "%s: unable to clear page.",
 		 function );
 
 		goto on_error;
@@ -99,55 +100,68 @@ int libesedb_page_tags_value_initialize(
 	return( 1 );
 
 on_error:
-	if( *page_tags_value != NULL )
+	if( *page != NULL )
 	{
 		memory_free(
-		 *page_tags_value );
+		 *page );
 
-		*page_tags_value = NULL;
+		*page = NULL;
 	}
 	return( -1 );
 }
 
-/* Frees a page tags value
+/* Frees a page
  * Returns 1 if successful or -1 on error
  */
-int libesedb_page_tags_value_free(
-     libesedb_page_tags_value_t **page_tags_value,
+int libesedb_page_free(
+     libesedb_page_t **page,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_page_tags_value_free";
+	static char *function = "libesedb_page_free";
 
-	if( page_tags_value == NULL )
+	if( page == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid page tags value.",
+		 "%s: invalid page.",
 		 function );
 
 		return( -1 );
 	}
-	if( *page_tags_value != NULL )
+	if( *page != NULL )
 	{
+		if( ( *page )->values != NULL )
+		{
+			memory_free(
+			 ( *page )->values );
+		}
+		if( ( ( *page )->data != NULL )
+		 && ( ( *page )->data_is_mapped == 0 ) )
+		{
+			memory_free(
+			 ( *page )->data );
+		}
 		memory_free(
-		 *page_tags_value );
+		 *page );
 
-		*page_tags_value = NULL;
+		*page = NULL;
 	}
 	return( 1 );
 }
 
-/* Creates a page
- * Make sure the value page is referencing, is set to NULL
+/* Releases a reference to a page
+ * The page is freed when the last reference is released
+ * This function is used as the free page function of the pages cache,
+ * the caller must hold the file IO handle mutex when the page is shared
  * Returns 1 if successful or -1 on error
  */
-int libesedb_page_initialize(
+int libesedb_page_release_reference(
      libesedb_page_t **page,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_page_initialize";
+	static char *function = "libesedb_page_release_reference";
 
 	if( page == NULL )
 	{
@@ -160,81 +174,50 @@ int libesedb_page_initialize(
 
 		return( -1 );
 	}
-	if( *page != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid page value already set.",
-		 function );
-
-		return( -1 );
-	}
-	*page = memory_allocate_structure(
-	         libesedb_page_t );
-
 	if( *page == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create page.",
-		 function );
-
-		goto on_error;
+		return( 1 );
 	}
-	if( memory_set(
-	     *page,
-	     0,
-	     sizeof( libesedb_page_t ) ) == NULL )
+	if( ( *page )->number_of_references > 1 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear page.",
-		 function );
+		( *page )->number_of_references -= 1;
 
-		goto on_error;
+		*page = NULL;
+
+		return( 1 );
 	}
-	if( libcdata_array_initialize(
-	     &( ( *page )->values_array ),
-	     0,
+	if( libesedb_page_free(
+	     page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create page values array.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	return( 1 );
-
-on_error:
-	if( *page != NULL )
-	{
-		memory_free(
-		 *page );
-
-		*page = NULL;
-	}
-	return( -1 );
 }
 
-/* Frees a page
+/* Reads a page and its values
  * Returns 1 if successful or -1 on error
  */
-int libesedb_page_free(
-     libesedb_page_t **page,
+int libesedb_page_read(
+     libesedb_page_t *page,
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_page_free";
-	int result            = 1;
+	static char *function           = "libesedb_page_read";
+	ssize_t read_count              = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint32_t calculated_page_number = 0;
+#endif
 
 	if( page == NULL )
 	{
@@ -247,61 +230,164 @@ int libesedb_page_free(
 
 		return( -1 );
 	}
-	if( *page != NULL )
+	if( page->data != NULL )
 	{
-		if( libcdata_array_free(
-		     &( ( *page )->values_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_value_free,
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page data already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	page->offset = file_offset;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		calculated_page_number = (uint32_t) ( ( file_offset - io_handle->page_size ) / io_handle->page_size );
+
+		libcnotify_printf(
+		 "%s: reading page: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 calculated_page_number,
+		 page->offset,
+		 page->offset );
+	}
+#endif
+	if( io_handle->mapped_data != NULL )
+	{
+		if( ( page->offset < 0 )
+		 || ( (size64_t) page->offset > io_handle->mapped_data_size )
+		 || ( (size64_t) io_handle->page_size > ( io_handle->mapped_data_size - (size64_t) page->offset ) ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free the page values array.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid page offset: %" PRIi64 " value out of bounds.",
+			 function,
+			 page->offset );
+
+			goto on_error;
+		}
+		/* The page tags flags of the extended page header are stripped from the page values
+		 * when the page is read, hence these pages require a writable copy
+		 */
+		if( ( io_handle->format_revision < LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+		 || ( io_handle->page_size < 16384 ) )
+		{
+			page->data           = &( io_handle->mapped_data[ page->offset ] );
+			page->data_size      = (size_t) io_handle->page_size;
+			page->data_is_mapped = 1;
+		}
+	}
+	if( page->data == NULL )
+	{
+		page->data = (uint8_t *) memory_allocate(
+		                          (size_t) io_handle->page_size );
+
+		if( page->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create page data.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
-		if( ( *page )->data != NULL )
+		page->data_size = (size_t) io_handle->page_size;
+
+		read_count = libesedb_io_handle_read_buffer_at_offset(
+		              io_handle,
+		              file_io_handle,
+		              page->data,
+		              page->data_size,
+		              page->offset,
+		              error );
+
+		if( read_count != (ssize_t) page->data_size )
 		{
-			memory_free(
-			 ( *page )->data );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read page data at offset: %" PRIi64 ".",
+			 function,
+			 page->offset );
+
+			goto on_error;
 		}
-		memory_free(
-		 *page );
+	}
+	if( libesedb_page_read_data(
+	     page,
+	     io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page data at offset: %" PRIi64 ".",
+		 function,
+		 page->offset );
 
-		*page = NULL;
+		goto on_error;
 	}
-	return( result );
+	return( 1 );
+
+on_error:
+	if( page->data != NULL )
+	{
+		if( page->data_is_mapped == 0 )
+		{
+			memory_free(
+			 page->data );
+		}
+		page->data           = NULL;
+		page->data_is_mapped = 0;
+	}
+	return( -1 );
 }
 
-/* Reads a page and its values
+/* Reads the page header and values from the page data
+ * The page data and offset must be set before calling this function,
+ * the page data is not freed on error
  * Returns 1 if successful or -1 on error
  */
-int libesedb_page_read(
+int libesedb_page_read_data(
      libesedb_page_t *page,
      libesedb_io_handle_t *io_handle,
-     libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
      libcerror_error_t **error )
 {
-	libcdata_array_t *page_tags_array  = NULL;
 	uint8_t *page_values_data          = NULL;
-	static char *function              = "libesedb_page_read";
+	static char *function              = "libesedb_page_read_data";
 	size_t page_values_data_offset     = 0;
 	size_t page_values_data_size       = 0;
-	ssize_t read_count                 = 0;
-	uint32_t calculated_ecc32_checksum = 0;
 	uint32_t calculated_page_number    = 0;
-	uint32_t calculated_xor32_checksum = 0;
-	uint32_t stored_ecc32_checksum     = 0;
-	uint32_t stored_page_number        = 0;
-	uint32_t stored_xor32_checksum     = 0;
 	uint16_t available_data_size       = 0;
 	uint16_t available_page_tag        = 0;
+	uint16_t value_index               = 0;
+	int result                         = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
+	uint32_t stored_ecc32_checksum     = 0;
+	uint32_t stored_page_number        = 0;
+	uint32_t stored_xor32_checksum     = 0;
 	uint64_t value_64bit               = 0;
 	uint16_t value_16bit               = 0;
 #endif
@@ -317,92 +403,53 @@ int libesedb_page_read(
 
 		return( -1 );
 	}
-	if( page->data != NULL )
+	if( page->data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid page data already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page - missing data.",
 		 function );
 
 		return( -1 );
 	}
-	if( io_handle == NULL )
+	if( page->values != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page values already set.",
 		 function );
 
 		return( -1 );
 	}
-	calculated_page_number = (uint32_t) ( ( file_offset - io_handle->page_size ) / io_handle->page_size );
-
-	page->offset = file_offset;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: reading page: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-		 function,
-		 calculated_page_number,
-		 page->offset,
-		 page->offset );
-	}
-#endif
-	if( libbfio_handle_seek_offset(
-	     file_io_handle,
-	     page->offset,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek page offset: %" PRIi64 ".",
-		 function,
-		 page->offset );
-
-		goto on_error;
-	}
-	page->data = (uint8_t *) memory_allocate(
-	                          (size_t) io_handle->page_size );
-
-	if( page->data == NULL )
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create page data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	page->data_size = (size_t) io_handle->page_size;
-
-	read_count = libbfio_handle_read_buffer(
-	              file_io_handle,
-	              page->data,
-	              page->data_size,
-	              error );
-
-	if( read_count != (ssize_t) page->data_size )
+	if( ( io_handle->page_size == 0 )
+	 || ( page->data_size != (size_t) io_handle->page_size ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read page data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page - data size value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
+	calculated_page_number = (uint32_t) ( ( page->offset - io_handle->page_size ) / io_handle->page_size );
+
 	page_values_data      = page->data;
 	page_values_data_size = page->data_size;
 
@@ -442,12 +489,14 @@ int libesedb_page_read(
 	 ( (esedb_page_header_t *) page_values_data )->page_flags,
 	 page->flags );
 
+#if defined( HAVE_DEBUG_OUTPUT )
 	/* Make sure to read after the page flags
 	 */
 	if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
 	 && ( io_handle->page_size >= 16384 ) )
 	{
-		/* TODO handle checksum */
+		/* The checksums are stored per block, see libesedb_page_verify_extended_checksums
+		 */
 	}
 	else
 	{
@@ -469,7 +518,6 @@ int libesedb_page_read(
 			 stored_page_number );
 		}
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
@@ -480,8 +528,6 @@ int libesedb_page_read(
 		if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
 		 && ( io_handle->page_size >= 16384 ) )
 		{
-			/* TODO handle checksum */
-
 			byte_stream_copy_to_uint64_little_endian(
 			 page_values_data,
 			 value_64bit );
@@ -570,106 +616,82 @@ int libesedb_page_read(
 		 "\n" );
 	}
 #endif
-	/* TODO for now don't bother calculating a checksum for uninitialized pages */
-
-	if( ( page_values_data[ 0 ] != 0 )
-	 || ( page_values_data[ 1 ] != 0 )
-	 || ( page_values_data[ 2 ] != 0 )
-	 || ( page_values_data[ 3 ] != 0 ) )
+	/* The checksum is only calculated when checksum verification is enabled
+	 */
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( ( io_handle->checksum_verification_mode != LIBESEDB_CHECKSUM_VERIFICATION_MODE_NONE )
+	 || ( libcnotify_verbose != 0 ) )
+#else
+	if( io_handle->checksum_verification_mode != LIBESEDB_CHECKSUM_VERIFICATION_MODE_NONE )
+#endif
 	{
-		if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
-		 && ( io_handle->page_size >= 16384 ) )
+		result = libesedb_page_verify_checksum(
+		          io_handle,
+		          page->data,
+		          page->data_size,
+		          calculated_page_number,
+		          error );
+
+		if( result == -1 )
 		{
-			/* TODO handle checksum */
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify page: %" PRIu32 " checksum.",
+			 function,
+			 calculated_page_number );
+
+			goto on_error;
 		}
-		else if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_NEW_RECORD_FORMAT )
-		      && ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_NEW_RECORD_FORMAT ) != 0 ) )
+		else if( result == 0 )
 		{
-			if( libesedb_checksum_calculate_little_endian_ecc32(
-			     &calculated_ecc32_checksum,
-			     &calculated_xor32_checksum,
-			     page_values_data,
-			     page_values_data_size,
-			     8,
-			     calculated_page_number,
+			/* Pages can be read concurrently by different tables
+			 */
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+			if( libcthreads_mutex_grab(
+			     io_handle->file_io_handle_mutex,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unable to calculate ECC-32 and XOR-32 checksum.",
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab file IO handle mutex.",
 				 function );
 
 				goto on_error;
 			}
-		}
-		else
-		{
-			if( libesedb_checksum_calculate_little_endian_xor32(
-			     &calculated_xor32_checksum,
-			     &( page_values_data[ 4 ] ),
-			     page_values_data_size - 4,
-			     0x89abcdef,
+#endif
+			io_handle->number_of_checksum_mismatches += 1;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+			if( libcthreads_mutex_release(
+			     io_handle->file_io_handle_mutex,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unable to calculate XOR-32 checksum.",
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release file IO handle mutex.",
 				 function );
 
 				goto on_error;
 			}
-		}
-		if( stored_xor32_checksum != calculated_xor32_checksum )
-		{
-#ifdef TODO
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_INPUT,
-			 LIBCERROR_INPUT_ERROR_CRC_MISMATCH,
-			 "%s: mismatch in page XOR-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
-			 function,
-			 stored_xor32_checksum,
-			 calculated_xor32_checksum );
-
-			goto on_error;
-#else
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: mismatch in page XOR-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
-				 function,
-				 stored_xor32_checksum,
-				 calculated_xor32_checksum );
-			}
 #endif
-		}
-		if( stored_ecc32_checksum != calculated_ecc32_checksum )
-		{
-#ifdef TODO
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_INPUT,
-			 LIBCERROR_INPUT_ERROR_CRC_MISMATCH,
-			 "%s: mismatch in page ECC-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
-			 function,
-			 stored_ecc32_checksum,
-			 calculated_ecc32_checksum );
-
-			goto on_error;
-#else
-			if( libcnotify_verbose != 0 )
+			if( io_handle->checksum_verification_mode == LIBESEDB_CHECKSUM_VERIFICATION_MODE_ENFORCE )
 			{
-				libcnotify_printf(
-				 "%s: mismatch in page ECC-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_INPUT,
+				 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+				 "%s: mismatch in page: %" PRIu32 " checksum.",
 				 function,
-				 stored_ecc32_checksum,
-				 calculated_ecc32_checksum );
+				 calculated_page_number );
+
+				goto on_error;
 			}
-#endif
 		}
 	}
 	page_values_data        += sizeof( esedb_page_header_t );
@@ -739,589 +761,1307 @@ int libesedb_page_read(
 		page_values_data_size   -= sizeof( esedb_extended_page_header_t );
 		page_values_data_offset += sizeof( esedb_extended_page_header_t );
 	}
+	page->values_data_offset = page_values_data_offset;
+
+	if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+	 && ( io_handle->page_size >= 16384 ) )
+	{
+		page->has_extended_page_header = 1;
+	}
 	if( available_page_tag > 0 )
 	{
-		/* Create the page tags array
+		/* The page tags are stored at the end of the page data
 		 */
-		if( libcdata_array_initialize(
-		     &page_tags_array,
-		     0,
-		     error ) != 1 )
+		if( ( (size_t) available_page_tag * 4 ) > page_values_data_size )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create page tags array.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid available page tag value out of bounds.",
 			 function );
 
 			goto on_error;
 		}
-		if( libesedb_page_read_tags(
-		     page_tags_array,
-		     io_handle,
-		     available_page_tag,
-		     page->data,
-		     page->data_size,
-		     error ) != 1 )
+		/* The page values are stored in a single array that references the page data
+		 */
+		page->values = (libesedb_page_value_t *) memory_allocate(
+		                                          sizeof( libesedb_page_value_t ) * available_page_tag );
+
+		if( page->values == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read page tags.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create page values.",
 			 function );
 
 			goto on_error;
 		}
-		/* The offsets in the page tags are relative after the page header
-		 */
-		if( libesedb_page_read_values(
-		     page,
-		     io_handle,
-		     page_tags_array,
-		     page_values_data,
-		     page_values_data_size,
-		     page_values_data_offset,
-		     error ) != 1 )
+		if( memory_set(
+		     page->values,
+		     0,
+		     sizeof( libesedb_page_value_t ) * available_page_tag ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read page values.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear page values.",
 			 function );
 
 			goto on_error;
 		}
-		if( libcdata_array_free(
-		     &page_tags_array,
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_tags_value_free,
-		     error ) != 1 )
+		page->number_of_values = available_page_tag;
+
+		/* The page values are decoded before the page is stored in the pages cache
+		 * since the page tags flags of the extended page header are stripped from
+		 * the page data, after that the page data and values are only read
+		 */
+		for( value_index = 0;
+		     value_index < page->number_of_values;
+		     value_index++ )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free the page tags array.",
-			 function );
+			if( libesedb_page_read_value(
+			     page,
+			     value_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read page value: %" PRIu16 ".",
+				 function,
+				 value_index );
 
-			goto on_error;
+				goto on_error;
+			}
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "\n" );
 		}
+#endif
 	}
 	return( 1 );
 
 on_error:
-	if( page_tags_array != NULL )
-	{
-		libcdata_array_free(
-		 &page_tags_array,
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_tags_value_free,
-		 NULL );
-	}
-	if( page->data != NULL )
+	if( page->values != NULL )
 	{
 		memory_free(
-		 page->data );
+		 page->values );
 
-		page->data = NULL;
+		page->values = NULL;
 	}
+	page->number_of_values = 0;
+
 	return( -1 );
 }
 
-/* Reads the page tags
+/* Retrieves a specific page from the pages cache
+ * The page is read and stored in the pages cache when it is not cached
+ * The page is referenced on behalf of the caller and remains valid, also when
+ * it is evicted from the pages cache, until the caller releases it using
+ * libesedb_page_release
  * Returns 1 if successful or -1 on error
  */
-int libesedb_page_read_tags(
-     libcdata_array_t *page_tags_array,
+int libesedb_page_get_from_cache(
      libesedb_io_handle_t *io_handle,
-     uint16_t number_of_page_tags,
-     uint8_t *page_data,
-     size_t page_data_size,
+     libbfio_handle_t *file_io_handle,
+     uint32_t page_number,
+     libesedb_page_t **page,
      libcerror_error_t **error )
 {
-	libesedb_page_tags_value_t *page_tags_value = NULL;
-	uint8_t *page_tags_data                     = NULL;
-	static char *function                       = "libesedb_page_read_tags";
-	uint16_t page_tag_offset                    = 0;
-	uint16_t page_tag_size                      = 0;
-	uint16_t page_tags_index                    = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	size_t page_tags_data_size                  = 0;
-#endif
+	libesedb_page_t *read_page = NULL;
+	static char *function      = "libesedb_page_get_from_cache";
+	off64_t file_offset        = 0;
+	int result                 = 0;
 
-	if( page_tags_array == NULL )
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid page tags array.",
+		 "%s: invalid IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( io_handle == NULL )
+	if( io_handle->pages_cache == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing pages cache.",
 		 function );
 
 		return( -1 );
 	}
-	if( page_data == NULL )
+	if( ( page_number == 0 )
+	 || ( page_number > io_handle->last_page_number ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid page data.",
-		 function );
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page number: %" PRIu32 " value out of bounds.",
+		 function,
+		 page_number );
 
 		return( -1 );
 	}
-	if( page_data_size > (size_t) SSIZE_MAX )
+	if( page == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid page data size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_resize(
-	     page_tags_array,
-	     number_of_page_tags,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_tags_value_free,
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     io_handle->file_io_handle_mutex,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
-		 "%s: unable to resize page tags array.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab file IO handle mutex.",
 		 function );
 
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		page_tags_data_size = 4 * number_of_page_tags;
-
-		libcnotify_printf(
-		 "%s: page tags:\n",
-		 function );
-		libcnotify_print_data(
-		 &( page_data[ page_data_size - page_tags_data_size ] ),
-		 page_tags_data_size,
-		 0 );
+		return( -1 );
 	}
 #endif
-	/* Read the page tags back to front
-	 */
-	page_tags_data = &( page_data[ page_data_size - 2 ] );
-
-	for( page_tags_index = 0;
-	     page_tags_index < number_of_page_tags;
-	     page_tags_index++ )
-	{
-		if( libesedb_page_tags_value_initialize(
-		     &page_tags_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create page tags value.",
-			 function );
-
-			goto on_error;
-		}
-		byte_stream_copy_to_uint16_little_endian(
-		 page_tags_data,
-		 page_tag_offset );
-
-		page_tags_data -= 2;
-
-		byte_stream_copy_to_uint16_little_endian(
-		 page_tags_data,
-		 page_tag_size );
-
-		page_tags_data -= 2;
-
-		if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
-		 && ( io_handle->page_size >= 16384 ) )
-		{
-			page_tags_value->flags  = 0;
-			page_tags_value->offset = page_tag_offset & 0x7fff;
-			page_tags_value->size   = page_tag_size & 0x7fff;;
-		}
-		else
-		{
-			page_tags_value->flags  = page_tag_offset >> 13;
-			page_tags_value->offset = page_tag_offset & 0x1fff;
-			page_tags_value->size   = page_tag_size & 0x1fff;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: page tag: %03" PRIu16 " offset\t\t\t\t: %" PRIu16 " (0x%04" PRIx16 ")\n",
-			 function,
-			 page_tags_index,
-			 page_tags_value->offset,
-			 page_tag_offset );
-
-			libcnotify_printf(
-			 "%s: page tag: %03" PRIu16 " size\t\t\t\t: %" PRIu16 " (0x%04" PRIx16 ")\n",
-			 function,
-			 page_tags_index,
-			 page_tags_value->size,
-			 page_tag_size );
-
-			if( ( io_handle->format_revision < LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
-			 && ( io_handle->page_size < 16384 ) )
-			{
-				libcnotify_printf(
-				 "%s: page tag: %03" PRIu16 " flags\t\t\t\t: 0x%02" PRIx8 "",
-				 function,
-				 page_tags_index,
-				 page_tags_value->flags );
-				libesedb_debug_print_page_tag_flags(
-				 page_tags_value->flags );
-				libcnotify_printf(
-				 "\n" );
-			}
-		}
-#endif
-		if( libcdata_array_set_entry_by_index(
-		     page_tags_array,
-		     (int) page_tags_index,
-		     (intptr_t *) page_tags_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set page tag: %" PRIu16 ".",
-			 function,
-			 page_tags_index );
+	result = libesedb_page_cache_get_page(
+	          io_handle->pages_cache,
+	          page_number,
+	          (intptr_t **) page,
+	          error );
 
-			goto on_error;
-		}
-		page_tags_value = NULL;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( result == -1 )
 	{
-		libcnotify_printf(
-		 "\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 " from cache.",
+		 function,
+		 page_number );
 	}
-#endif
-	return( 1 );
-
-on_error:
-	if( page_tags_value != NULL )
+	else if( result != 0 )
 	{
-		libesedb_page_tags_value_free(
-		 &page_tags_value,
-		 NULL );
+		( *page )->number_of_references += 1;
 	}
-	return( -1 );
-}
-
-/* Reads the page values
- * Returns 1 if successful or -1 on error
- */
-int libesedb_page_read_values(
-     libesedb_page_t *page,
-     libesedb_io_handle_t *io_handle,
-     libcdata_array_t *page_tags_array,
-     uint8_t *page_values_data,
-     size_t page_values_data_size,
-     size_t page_values_data_offset,
-     libcerror_error_t **error )
-{
-	libesedb_page_tags_value_t *page_tags_value = NULL;
-	libesedb_page_value_t *page_value           = NULL;
-	static char *function                       = "libesedb_page_read_values";
-	uint16_t page_tags_index                    = 0;
-	int number_of_page_tags                     = 0;
-
-	if( page == NULL )
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     io_handle->file_io_handle_mutex,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid page.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle mutex.",
 		 function );
 
 		return( -1 );
 	}
-	if( page->values_array == NULL )
+#endif
+	if( result != 0 )
+	{
+		return( result );
+	}
+	/* The page is read without holding the mutex
+	 * since libesedb_page_read grabs it to read the page data
+	 */
+	file_offset = io_handle->pages_data_offset
+	            + ( (off64_t) ( page_number - 1 ) * io_handle->page_size );
+
+	if( libesedb_page_initialize(
+	     &read_page,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid page  - missing values array.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( io_handle == NULL )
+	if( libesedb_page_read(
+	     read_page,
+	     io_handle,
+	     file_io_handle,
+	     file_offset,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page: %" PRIu32 ".",
+		 function,
+		 page_number );
 
-		return( -1 );
+		goto on_error;
+	}
+	if( ( read_page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+	{
+		if( libesedb_io_handle_read_ahead(
+		     io_handle,
+		     file_io_handle,
+		     read_page->page_number,
+		     read_page->next_page_number,
+		     error ) == -1 )
+		{
+			/* The read-ahead is a hint hence failures do not fail the read of the page
+			 */
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( libcnotify_verbose != 0 )
+			 && ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
 	}
-	if( page_tags_array == NULL )
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     io_handle->file_io_handle_mutex,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab file IO handle mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* The reference of the pages cache
+	 */
+	read_page->number_of_references = 1;
+
+	/* If another reader cached the page in the meantime the page read here
+	 * is freed and replaced by the cached page
+	 */
+	result = libesedb_page_cache_set_page(
+	          io_handle->pages_cache,
+	          page_number,
+	          (intptr_t **) &read_page,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set page: %" PRIu32 " in cache.",
+		 function,
+		 page_number );
+
+		result = -1;
+	}
+	else
+	{
+		/* The reference of the caller
+		 */
+		read_page->number_of_references += 1;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     io_handle->file_io_handle_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle mutex.",
+		 function );
+
+		if( result == 1 )
+		{
+			return( -1 );
+		}
+		result = -1;
+	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	*page = read_page;
+
+	return( 1 );
+
+on_error:
+	if( read_page != NULL )
+	{
+		libesedb_page_free(
+		 &read_page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Releases a page retrieved from the pages cache
+ * The page is freed when it was evicted from the pages cache and this was
+ * the last reference to the page
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_release(
+     libesedb_io_handle_t *io_handle,
+     libesedb_page_t **page,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_release";
+	int result            = 1;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page == NULL )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     io_handle->file_io_handle_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab file IO handle mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libesedb_page_release_reference(
+	     page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page reference.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     io_handle->file_io_handle_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Verifies the checksums of page data with an extended page header
+ * The page data is divided into 4 blocks that each have an ECC-32 and XOR-32 checksum.
+ * The checksums of the first block are stored in the page header and do not cover
+ * the first 8 bytes, the checksums of the other blocks are stored in the extended page header
+ * Returns 1 if the checksums match, 0 if not or -1 on error
+ */
+int libesedb_page_verify_extended_checksums(
+     const uint8_t *page_data,
+     size_t page_data_size,
+     uint32_t page_number,
+     libcerror_error_t **error )
+{
+	const uint8_t *stored_checksum_data = NULL;
+	static char *function               = "libesedb_page_verify_extended_checksums";
+	size_t block_offset                 = 0;
+	size_t block_size                   = 0;
+	uint32_t calculated_ecc32_checksum  = 0;
+	uint32_t calculated_xor32_checksum  = 0;
+	uint32_t stored_ecc32_checksum      = 0;
+	uint32_t stored_xor32_checksum      = 0;
+	int block_index                     = 0;
+	int result                          = 1;
+
+	if( page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_data_size < ( 4 * ( sizeof( esedb_page_header_t ) + sizeof( esedb_extended_page_header_t ) ) ) )
+	 || ( page_data_size > (size_t) SSIZE_MAX )
+	 || ( ( page_data_size % 16 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	block_size = page_data_size / 4;
+
+	for( block_index = 0;
+	     block_index < 4;
+	     block_index++ )
+	{
+		if( block_index == 0 )
+		{
+			stored_checksum_data = page_data;
+		}
+		else
+		{
+			stored_checksum_data = &( page_data[ sizeof( esedb_page_header_t ) + ( ( block_index - 1 ) * 8 ) ] );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 stored_checksum_data,
+		 stored_xor32_checksum );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( stored_checksum_data[ 4 ] ),
+		 stored_ecc32_checksum );
+
+		if( libesedb_checksum_calculate_little_endian_ecc32(
+		     &calculated_ecc32_checksum,
+		     &calculated_xor32_checksum,
+		     &( page_data[ block_offset ] ),
+		     block_size,
+		     ( block_index == 0 ) ? 8 : 0,
+		     page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unable to calculate block: %d ECC-32 and XOR-32 checksum.",
+			 function,
+			 block_index );
+
+			return( -1 );
+		}
+		if( ( stored_xor32_checksum != calculated_xor32_checksum )
+		 || ( stored_ecc32_checksum != calculated_ecc32_checksum ) )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: mismatch in page: %" PRIu32 " block: %d checksum ( 0x%08" PRIx32 "%08" PRIx32 " != 0x%08" PRIx32 "%08" PRIx32 " ).\n",
+				 function,
+				 page_number,
+				 block_index,
+				 stored_ecc32_checksum,
+				 stored_xor32_checksum,
+				 calculated_ecc32_checksum,
+				 calculated_xor32_checksum );
+			}
+#endif
+			result = 0;
+		}
+		block_offset += block_size;
+	}
+	return( result );
+}
+
+/* Verifies the checksum of the page data
+ * Returns 1 if the checksum matches or the page is uninitialized, 0 if not or -1 on error
+ */
+int libesedb_page_verify_checksum(
+     libesedb_io_handle_t *io_handle,
+     const uint8_t *page_data,
+     size_t page_data_size,
+     uint32_t page_number,
+     libcerror_error_t **error )
+{
+	static char *function              = "libesedb_page_verify_checksum";
+	uint32_t calculated_ecc32_checksum = 0;
+	uint32_t calculated_xor32_checksum = 0;
+	uint32_t page_flags                = 0;
+	uint32_t stored_ecc32_checksum     = 0;
+	uint32_t stored_xor32_checksum     = 0;
+	int result                         = 1;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_data_size < sizeof( esedb_page_header_t ) )
+	 || ( page_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The checksum of uninitialized pages is not calculated
+	 */
+	if( ( page_data[ 0 ] == 0 )
+	 && ( page_data[ 1 ] == 0 )
+	 && ( page_data[ 2 ] == 0 )
+	 && ( page_data[ 3 ] == 0 ) )
+	{
+		return( 1 );
+	}
+	if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+	 && ( io_handle->page_size >= 16384 ) )
+	{
+		return( libesedb_page_verify_extended_checksums(
+		         page_data,
+		         page_data_size,
+		         page_number,
+		         error ) );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_page_header_t *) page_data )->xor_checksum,
+	 stored_xor32_checksum );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_page_header_t *) page_data )->page_flags,
+	 page_flags );
+
+	if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_NEW_RECORD_FORMAT )
+	 && ( ( page_flags & LIBESEDB_PAGE_FLAG_IS_NEW_RECORD_FORMAT ) != 0 ) )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_page_header_t *) page_data )->ecc_checksum,
+		 stored_ecc32_checksum );
+
+		if( libesedb_checksum_calculate_little_endian_ecc32(
+		     &calculated_ecc32_checksum,
+		     &calculated_xor32_checksum,
+		     page_data,
+		     page_data_size,
+		     8,
+		     page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unable to calculate ECC-32 and XOR-32 checksum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( libesedb_checksum_calculate_little_endian_xor32(
+		     &calculated_xor32_checksum,
+		     &( page_data[ 4 ] ),
+		     page_data_size - 4,
+		     0x89abcdef,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unable to calculate XOR-32 checksum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( stored_xor32_checksum != calculated_xor32_checksum )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in page: %" PRIu32 " XOR-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
+			 function,
+			 page_number,
+			 stored_xor32_checksum,
+			 calculated_xor32_checksum );
+		}
+#endif
+		result = 0;
+	}
+	if( stored_ecc32_checksum != calculated_ecc32_checksum )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in page: %" PRIu32 " ECC-32 checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
+			 function,
+			 page_number,
+			 stored_ecc32_checksum,
+			 calculated_ecc32_checksum );
+		}
+#endif
+		result = 0;
+	}
+	return( result );
+}
+
+/* Verifies the page number stored in the page data
+ * Pages of the new record format do not store the page number in the page header,
+ * instead the page number is part of the checksum
+ * Returns 1 if the page number matches or is not stored, 0 if not or -1 on error
+ */
+int libesedb_page_verify_page_number(
+     libesedb_io_handle_t *io_handle,
+     const uint8_t *page_data,
+     size_t page_data_size,
+     uint32_t page_number,
+     libcerror_error_t **error )
+{
+	static char *function       = "libesedb_page_verify_page_number";
+	uint64_t stored_page_number = 0;
+	uint32_t page_flags         = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_data_size < ( sizeof( esedb_page_header_t ) + sizeof( esedb_extended_page_header_t ) ) )
+	 || ( page_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_data[ 0 ] == 0 )
+	 && ( page_data[ 1 ] == 0 )
+	 && ( page_data[ 2 ] == 0 )
+	 && ( page_data[ 3 ] == 0 ) )
+	{
+		return( 1 );
+	}
+	if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+	 && ( io_handle->page_size >= 16384 ) )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (esedb_extended_page_header_t *) &( page_data[ sizeof( esedb_page_header_t ) ] ) )->page_number,
+		 stored_page_number );
+	}
+	else
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_page_header_t *) page_data )->page_flags,
+		 page_flags );
+
+		if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_NEW_RECORD_FORMAT )
+		 && ( ( page_flags & LIBESEDB_PAGE_FLAG_IS_NEW_RECORD_FORMAT ) != 0 ) )
+		{
+			return( 1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_page_header_t *) page_data )->page_number,
+		 stored_page_number );
+	}
+	if( stored_page_number != (uint64_t) page_number )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in page number ( %" PRIu64 " != %" PRIu32 " ).\n",
+			 function,
+			 stored_page_number,
+			 page_number );
+		}
+#endif
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Reads a specific page value
+ * Decodes the page tag of the value and resolves the value data in the page data
+ * This function modifies the page data and is only called by libesedb_page_read
+ * before the page is shared
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_read_value(
+     libesedb_page_t *page,
+     uint16_t value_index,
+     libcerror_error_t **error )
+{
+	libesedb_page_value_t *page_value = NULL;
+	uint8_t *page_tags_data           = NULL;
+	uint8_t *page_values_data         = NULL;
+	static char *function             = "libesedb_page_read_value";
+	size_t page_values_data_size      = 0;
+	uint16_t page_tag_offset          = 0;
+	uint16_t page_tag_size            = 0;
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( page->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( page->values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page - missing values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page->values_data_offset > page->data_size )
+	 || ( ( (size_t) page->number_of_values * 4 ) > ( page->data_size - page->values_data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page - values data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_index >= page->number_of_values )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	page_value = &( page->values[ value_index ] );
+
+	/* The page tags are stored back to front at the end of the page data
+	 */
+	page_tags_data = &( page->data[ page->data_size - ( 4 * ( (size_t) value_index + 1 ) ) ] );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( page_tags_data[ 0 ] ),
+	 page_tag_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( page_tags_data[ 2 ] ),
+	 page_tag_offset );
+
+	if( page->has_extended_page_header != 0 )
+	{
+		page_value->flags  = 0;
+		page_value->offset = page_tag_offset & 0x7fff;
+		page_value->size   = page_tag_size & 0x7fff;
+	}
+	else
+	{
+		page_value->flags  = (uint8_t) ( page_tag_offset >> 13 );
+		page_value->offset = page_tag_offset & 0x1fff;
+		page_value->size   = page_tag_size & 0x1fff;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: page tag: %03" PRIu16 " offset\t\t\t\t: %" PRIu16 " (0x%04" PRIx16 ")\n",
+		 function,
+		 value_index,
+		 page_value->offset,
+		 page_tag_offset );
+
+		libcnotify_printf(
+		 "%s: page tag: %03" PRIu16 " size\t\t\t\t: %" PRIu16 " (0x%04" PRIx16 ")\n",
+		 function,
+		 value_index,
+		 page_value->size,
+		 page_tag_size );
+	}
+#endif
+	/* The offsets in the page tags are relative after the page header
+	 */
+	page_values_data      = &( page->data[ page->values_data_offset ] );
+	page_values_data_size = page->data_size - page->values_data_offset;
+
+	if( (size_t) page_value->offset > page_values_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: unsupported page tags value offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) page_value->size > ( page_values_data_size - page_value->offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: unsupported page tags value size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page->has_extended_page_header != 0 )
+	 && ( page_value->size >= 2 ) )
+	{
+		/* The page tags flags are stored in the upper byte of the first 16-bit value
+		 */
+		page_value->flags = page_values_data[ page_value->offset + 1 ] >> 5;
+
+		page_values_data[ page_value->offset + 1 ] &= 0x1f;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: page value: %03" PRIu16 " offset: % 5" PRIu16 ", size: % 5" PRIu16 ", flags: 0x%02" PRIx8 "",
+		 function,
+		 value_index,
+		 page_value->offset,
+		 page_value->size,
+		 page_value->flags );
+		libesedb_debug_print_page_tag_flags(
+		 page_value->flags );
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	page_value->data    = &( page_values_data[ page_value->offset ] );
+	page_value->offset += (uint16_t) page->values_data_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the number of page values
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_get_number_of_values(
+     libesedb_page_t *page,
+     uint16_t *number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_get_number_of_values";
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of values.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_values = page->number_of_values;
+
+	return( 1 );
+}
+
+/* Retrieves the page value at the index
+ * The page value is owned by the page and should not be freed
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_get_value(
+     libesedb_page_t *page,
+     uint16_t value_index,
+     libesedb_page_value_t **page_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_get_value";
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_index >= page->number_of_values )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The page values are read only once the page has been read
+	 * since the page can be shared by multiple threads
+	 */
+	if( page->values[ value_index ].data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page value: %" PRIu16 " - missing data.",
+		 function,
+		 value_index );
+
+		return( -1 );
+	}
+	*page_value = &( page->values[ value_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the key of a specific page value
+ * The key consists of the common key data, stored in the page header value,
+ * followed by the local key data, stored in the page value
+ * The common and local key data reference the page data
+ * Returns 1 if successful, 0 if the page value is defunct or -1 on error
+ */
+int libesedb_page_get_value_key(
+     libesedb_page_t *page,
+     uint16_t value_index,
+     const uint8_t **common_key_data,
+     uint16_t *common_key_size,
+     const uint8_t **local_key_data,
+     uint16_t *local_key_size,
+     libcerror_error_t **error )
+{
+	libesedb_page_value_t *header_page_value = NULL;
+	libesedb_page_value_t *page_value        = NULL;
+	uint8_t *page_value_data                 = NULL;
+	static char *function                    = "libesedb_page_get_value_key";
+	uint16_t page_value_size                 = 0;
+	uint16_t value_16bit                     = 0;
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid page tags array.",
+		 "%s: invalid page.",
 		 function );
 
 		return( -1 );
 	}
-	if( page_values_data == NULL )
+	if( common_key_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid page values data.",
+		 "%s: invalid common key data.",
 		 function );
 
 		return( -1 );
 	}
-	if( page_values_data_size > (size_t) SSIZE_MAX )
+	if( common_key_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid page values data size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid common key size.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     page_tags_array,
-	     &number_of_page_tags,
-	     error ) != 1 )
+	if( local_key_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of page tags.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid local key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( local_key_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid local key size.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_resize(
-	     page->values_array,
-	     number_of_page_tags,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_value_free,
+	if( libesedb_page_get_value(
+	     page,
+	     value_index,
+	     &page_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
-		 "%s: unable to resize page values array.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page value: %" PRIu16 ".",
+		 function,
+		 value_index );
 
-		goto on_error;
+		return( -1 );
 	}
-	for( page_tags_index = 0;
-	     page_tags_index < number_of_page_tags;
-	     page_tags_index++ )
+	if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     page_tags_array,
-		     page_tags_index,
-		     (intptr_t **) &page_tags_value,
-		     error ) != 1 )
+		return( 0 );
+	}
+	page_value_data = page_value->data;
+	page_value_size = page_value->size;
+
+	*common_key_data = NULL;
+	*common_key_size = 0;
+
+	if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE ) != 0 )
+	{
+		if( page_value_size < 2 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve page tag: %" PRIu16 ".",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: page value: %" PRIu16 " size value out of bounds.",
 			 function,
-			 page_tags_index );
+			 value_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( page_tags_value == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-			 "%s: invalid page tags value.",
-			 function );
+		byte_stream_copy_to_uint16_little_endian(
+		 page_value_data,
+		 value_16bit );
 
-			goto on_error;
-		}
-		if( libesedb_page_value_initialize(
-		     &page_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create tags value.",
-			 function );
+		page_value_data += 2;
+		page_value_size -= 2;
 
-			goto on_error;
-		}
-		if( page_tags_value->offset > page->data_size )
+		if( libesedb_page_get_value(
+		     page,
+		     0,
+		     &header_page_value,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: unsupported page tags value offset value out of bounds.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page value: 0.",
 			 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: page value: %03" PRIu16 " offset: % 5" PRIu16 ", size: % 5" PRIu16 "\n",
-				 function,
-				 page_tags_index,
-				 page_tags_value->offset,
-				 page_tags_value->size );
-			}
-#endif
-			goto on_error;
+			return( -1 );
 		}
-		if( page_tags_value->size > ( page->data_size - page_tags_value->offset ) )
+		if( value_16bit > header_page_value->size )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: unsupported page tags value size value out of bounds.",
+			 "%s: common key size exceeds header page value size.",
 			 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: page value: %03" PRIu16 " offset: % 5" PRIu16 ", size: % 5" PRIu16 "\n",
-				 function,
-				 page_tags_index,
-				 page_tags_value->offset,
-				 page_tags_value->size );
-			}
-#endif
-			goto on_error;
-		}
-		if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
-		 && ( io_handle->page_size >= 16384 ) )
-		{
-			/* The page tags flags are stored in the upper byte of the first 16-bit value
-			 */
-			page_tags_value->flags = page_values_data[ page_tags_value->offset + 1 ] >> 5;
-
-			page_values_data[ page_tags_value->offset + 1 ] &= 0x1f;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: page value: %03" PRIu16 " offset: % 5" PRIu16 ", size: % 5" PRIu16 ", flags: 0x%02" PRIx8 "",
-			 function,
-			 page_tags_index,
-			 page_tags_value->offset,
-			 page_tags_value->size,
-			 page_tags_value->flags );
-			libesedb_debug_print_page_tag_flags(
-			 page_tags_value->flags );
-			libcnotify_printf(
-			 "\n" );
-		}
-#endif
-		page_value->data   = &( page_values_data[ page_tags_value->offset ] );
-		page_value->offset = (uint16_t) ( page_values_data_offset + page_tags_value->offset );
-		page_value->size   = page_tags_value->size;
-		page_value->flags  = page_tags_value->flags;
-
-		if( libcdata_array_set_entry_by_index(
-		     page->values_array,
-		     (int) page_tags_index,
-		     (intptr_t *) page_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set page value: %" PRIu16 ".",
-			 function,
-			 page_tags_index );
-
-			goto on_error;
+			return( -1 );
 		}
-		page_value = NULL;
+		*common_key_data = header_page_value->data;
+		*common_key_size = value_16bit;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( page_value_size < 2 )
 	{
-		libcnotify_printf(
-		"\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: page value: %" PRIu16 " size value out of bounds.",
+		 function,
+		 value_index );
+
+		return( -1 );
 	}
-#endif
-	return( 1 );
+	byte_stream_copy_to_uint16_little_endian(
+	 page_value_data,
+	 value_16bit );
 
-on_error:
-	if( page_value != NULL )
+	page_value_data += 2;
+	page_value_size -= 2;
+
+	if( value_16bit > page_value_size )
 	{
-		libesedb_page_value_free(
-		 &page_value,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: local key size exceeds page value size.",
+		 function );
+
+		return( -1 );
 	}
-	libcdata_array_empty(
-	 page->values_array,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_value_free,
-	 NULL );
+	*local_key_data = page_value_data;
+	*local_key_size = value_16bit;
 
-	return( -1 );
+	return( 1 );
 }
 
-/* Retrieves the number of page values
- * Returns 1 if successful or -1 on error
+/* Retrieves the data range of a specific page value that follows the key
+ * If key is not NULL the common and local key data are appended to the key
+ * The data offset is relative to the start of the page
+ * Returns 1 if successful, 0 if the page value is defunct or -1 on error
  */
-int libesedb_page_get_number_of_values(
+int libesedb_page_get_value_data_range(
      libesedb_page_t *page,
-     uint16_t *number_of_values,
+     uint16_t value_index,
+     libesedb_key_t *key,
+     uint16_t *data_offset,
+     uint16_t *data_size,
      libcerror_error_t **error )
 {
-	static char *function     = "libesedb_page_get_number_of_values";
-	int page_number_of_values = 0;
+	libesedb_page_value_t *page_value = NULL;
+	const uint8_t *common_key_data    = NULL;
+	const uint8_t *local_key_data     = NULL;
+	static char *function             = "libesedb_page_get_value_data_range";
+	size_t key_data_offset            = 0;
+	uint16_t common_key_size          = 0;
+	uint16_t local_key_size           = 0;
+	int result                        = 0;
 
 	if( page == NULL )
 	{
@@ -1334,57 +2074,125 @@ int libesedb_page_get_number_of_values(
 
 		return( -1 );
 	}
-	if( number_of_values == NULL )
+	if( data_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid number of values.",
+		 "%s: invalid data offset.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     page->values_array,
-	     &page_number_of_values,
-	     error ) != 1 )
+	if( data_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of values.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
 		 function );
 
 		return( -1 );
 	}
-	if( page_number_of_values > (int) UINT16_MAX )
+	result = libesedb_page_get_value_key(
+	          page,
+	          value_index,
+	          &common_key_data,
+	          &common_key_size,
+	          &local_key_data,
+	          &local_key_size,
+	          error );
+
+	if( result != 1 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid number of page values value exceeds maximum.",
-		 function );
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page value: %" PRIu16 " key.",
+			 function,
+			 value_index );
+		}
+		return( result );
+	}
+	if( key != NULL )
+	{
+		if( common_key_size > 0 )
+		{
+			if( libesedb_key_append_data(
+			     key,
+			     common_key_data,
+			     (size_t) common_key_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append common key data to key.",
+				 function );
 
-		return( -1 );
+				return( -1 );
+			}
+		}
+		if( libesedb_key_append_data(
+		     key,
+		     local_key_data,
+		     (size_t) local_key_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append local key data to key.",
+			 function );
+
+			return( -1 );
+		}
 	}
-	*number_of_values = (uint16_t) page_number_of_values;
+	page_value = &( page->values[ value_index ] );
+
+	/* The value data follows directly after the local key data
+	 */
+	key_data_offset = (size_t) ( &( local_key_data[ local_key_size ] ) - page_value->data );
+
+	*data_offset = (uint16_t) ( page_value->offset + key_data_offset );
+	*data_size   = (uint16_t) ( page_value->size - key_data_offset );
 
 	return( 1 );
 }
 
-/* Retrieves the page value at the index
- * Returns 1 if successful or -1 on error
+/* Retrieves the index of the first page value with a key that is greater than or equal to the key data
+ * The page values of the page are expected to be stored in key order
+ * The page value is determined using a binary search, where defunct page values
+ * are skipped by probing the next page values
+ * Returns 1 if successful, 0 if no such page value or -1 on error
  */
-int libesedb_page_get_value(
+int libesedb_page_get_value_index_by_key(
      libesedb_page_t *page,
-     uint16_t value_index,
-     libesedb_page_value_t **page_value,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     uint16_t *value_index,
+     uint8_t *is_exact_match,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_page_get_value";
+	const uint8_t *common_key_data = NULL;
+	const uint8_t *local_key_data  = NULL;
+	static char *function          = "libesedb_page_get_value_index_by_key";
+	uint16_t common_key_size       = 0;
+	uint16_t local_key_size        = 0;
+	uint16_t high_value_index      = 0;
+	uint16_t low_value_index       = 0;
+	uint16_t middle_value_index    = 0;
+	uint16_t page_value_index      = 0;
+	uint8_t value_found            = 0;
+	int compare_result             = 0;
+	int result                     = 0;
 
 	if( page == NULL )
 	{
@@ -1397,22 +2205,124 @@ int libesedb_page_get_value(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     page->values_array,
-	     (int) value_index,
-	     (intptr_t **) page_value,
-	     error ) != 1 )
+	if( value_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve page value: %" PRIu16 ".",
-		 function,
-		 value_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value index.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_exact_match == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid is exact match.",
+		 function );
 
 		return( -1 );
 	}
+	/* The first page value contains the page header and is not part of the key order
+	 */
+	low_value_index  = 1;
+	high_value_index = page->number_of_values;
+
+	while( low_value_index < high_value_index )
+	{
+		middle_value_index = low_value_index + ( ( high_value_index - low_value_index ) / 2 );
+
+		for( page_value_index = middle_value_index;
+		     page_value_index < high_value_index;
+		     page_value_index++ )
+		{
+			result = libesedb_page_get_value_key(
+			          page,
+			          page_value_index,
+			          &common_key_data,
+			          &common_key_size,
+			          &local_key_data,
+			          &local_key_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: %" PRIu16 " key.",
+				 function,
+				 page_value_index );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				break;
+			}
+		}
+		/* All the page values from the middle up to the high value index are defunct
+		 */
+		if( page_value_index >= high_value_index )
+		{
+			high_value_index = middle_value_index;
+
+			continue;
+		}
+		compare_result = libesedb_key_compare_data(
+		                  key_data,
+		                  key_data_size,
+		                  common_key_data,
+		                  (size_t) common_key_size,
+		                  local_key_data,
+		                  (size_t) local_key_size,
+		                  error );
+
+		if( compare_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare key data with page value: %" PRIu16 " key.",
+			 function,
+			 page_value_index );
+
+			return( -1 );
+		}
+		if( compare_result == LIBFDATA_COMPARE_GREATER )
+		{
+			low_value_index = page_value_index + 1;
+		}
+		else
+		{
+			/* The page value is the first page value found so far with a key
+			 * that is greater than or equal to the key data
+			 */
+			high_value_index = page_value_index;
+
+			*value_index = page_value_index;
+
+			if( compare_result == LIBFDATA_COMPARE_EQUAL )
+			{
+				*is_exact_match = 1;
+			}
+			else
+			{
+				*is_exact_match = 0;
+			}
+			value_found = 1;
+		}
+	}
+	if( value_found == 0 )
+	{
+		return( 0 );
+	}
 	return( 1 );
 }
 
@@ -26,8 +26,8 @@
 #include <types.h>
 
 #include "libesedb_io_handle.h"
+#include "libesedb_key.h"
 #include "libesedb_libbfio.h"
-#include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_page_value.h"
 
@@ -35,23 +35,6 @@
 extern "C" {
 #endif
 
-typedef struct libesedb_page_tags_value libesedb_page_tags_value_t;
-
-struct libesedb_page_tags_value
-{
-	/* The offset of the value
-	 */
-	uint16_t offset;
-
-	/* The size of the value
-	 */
-	uint16_t size;
-
-	/* The flags of the value
-	 */
-	uint8_t flags;
-};
-
 typedef struct libesedb_page libesedb_page_t;
 
 struct libesedb_page
@@ -84,22 +67,36 @@ struct libesedb_page
 	 */
 	size_t data_size;
 
+	/* Value to indicate the page data references a memory mapped file
+	 */
+	uint8_t data_is_mapped;
+
 	/* The file offset of the page
 	 */
 	off64_t offset;
 
-	/* The page values array
+	/* The page values
 	 */
-	libcdata_array_t *values_array;
-};
+	libesedb_page_value_t *values;
 
-int libesedb_page_tags_value_initialize(
-     libesedb_page_tags_value_t **page_tags_value,
-     libcerror_error_t **error );
+	/* The number of page values
+	 */
+	uint16_t number_of_values;
 
-int libesedb_page_tags_value_free(
-     libesedb_page_tags_value_t **page_tags_value,
-     libcerror_error_t **error );
+	/* The offset of the page values data relative to the start of the page
+	 */
+	size_t values_data_offset;
+
+	/* Value to indicate the page has an extended page header
+	 */
+	uint8_t has_extended_page_header;
+
+	/* The number of references to the page
+	 * The pages cache holds one reference and every reader that retrieved
+	 * the page from the pages cache holds one until it releases the page
+	 */
+	int number_of_references;
+};
 
 int libesedb_page_initialize(
      libesedb_page_t **page,
@@ -109,6 +106,10 @@ int libesedb_page_free(
      libesedb_page_t **page,
      libcerror_error_t **error );
 
+int libesedb_page_release_reference(
+     libesedb_page_t **page,
+     libcerror_error_t **error );
+
 int libesedb_page_read(
      libesedb_page_t *page,
      libesedb_io_handle_t *io_handle,
@@ -116,21 +117,46 @@ int libesedb_page_read(
      off64_t file_offset,
      libcerror_error_t **error );
 
-int libesedb_page_read_tags(
-     libcdata_array_t *page_tags_array,
+int libesedb_page_read_data(
+     libesedb_page_t *page,
      libesedb_io_handle_t *io_handle,
-     uint16_t number_of_page_tags,
-     uint8_t *page_data,
+     libcerror_error_t **error );
+
+int libesedb_page_get_from_cache(
+     libesedb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t page_number,
+     libesedb_page_t **page,
+     libcerror_error_t **error );
+
+int libesedb_page_release(
+     libesedb_io_handle_t *io_handle,
+     libesedb_page_t **page,
+     libcerror_error_t **error );
+
+int libesedb_page_verify_extended_checksums(
+     const uint8_t *page_data,
      size_t page_data_size,
+     uint32_t page_number,
      libcerror_error_t **error );
 
-int libesedb_page_read_values(
-     libesedb_page_t *page,
+int libesedb_page_verify_checksum(
      libesedb_io_handle_t *io_handle,
-     libcdata_array_t *page_tags_array,
-     uint8_t *page_values_data,
-     size_t page_values_data_size,
-     size_t page_values_data_offset,
+     const uint8_t *page_data,
+     size_t page_data_size,
+     uint32_t page_number,
+     libcerror_error_t **error );
+
+int libesedb_page_verify_page_number(
+     libesedb_io_handle_t *io_handle,
+     const uint8_t *page_data,
+     size_t page_data_size,
+     uint32_t page_number,
+     libcerror_error_t **error );
+
+int libesedb_page_read_value(
+     libesedb_page_t *page,
+     uint16_t value_index,
      libcerror_error_t **error );
 
 int libesedb_page_get_number_of_values(
@@ -144,6 +170,31 @@ int libesedb_page_get_value(
      libesedb_page_value_t **page_value,
      libcerror_error_t **error );
 
+int libesedb_page_get_value_key(
+     libesedb_page_t *page,
+     uint16_t value_index,
+     const uint8_t **common_key_data,
+     uint16_t *common_key_size,
+     const uint8_t **local_key_data,
+     uint16_t *local_key_size,
+     libcerror_error_t **error );
+
+int libesedb_page_get_value_data_range(
+     libesedb_page_t *page,
+     uint16_t value_index,
+     libesedb_key_t *key,
+     uint16_t *data_offset,
+     uint16_t *data_size,
+     libcerror_error_t **error );
+
+int libesedb_page_get_value_index_by_key(
+     libesedb_page_t *page,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     uint16_t *value_index,
+     uint8_t *is_exact_match,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
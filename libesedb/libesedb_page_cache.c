@@ -0,0 +1,735 @@
+/*
+ * Page cache functions
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_definitions.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_page_cache.h"
+
+/* Removes an entry from its queue
+ */
+void libesedb_page_cache_queue_remove_entry(
+      libesedb_page_cache_t *page_cache,
+      int entry_index )
+{
+	libesedb_page_cache_entry_t *entry = &( page_cache->entries[ entry_index ] );
+
+	if( entry->previous_entry_index == -1 )
+	{
+		page_cache->queue_first_entry_index[ entry->queue ] = entry->next_entry_index;
+	}
+	else
+	{
+		page_cache->entries[ entry->previous_entry_index ].next_entry_index = entry->next_entry_index;
+	}
+	if( entry->next_entry_index == -1 )
+	{
+		page_cache->queue_last_entry_index[ entry->queue ] = entry->previous_entry_index;
+	}
+	else
+	{
+		page_cache->entries[ entry->next_entry_index ].previous_entry_index = entry->previous_entry_index;
+	}
+	page_cache->queue_number_of_entries[ entry->queue ] -= 1;
+
+	entry->queue                = LIBESEDB_PAGE_CACHE_QUEUE_NONE;
+	entry->previous_entry_index = -1;
+	entry->next_entry_index     = -1;
+}
+
+/* Prepends an entry to a queue, as the most recently used entry
+ */
+void libesedb_page_cache_queue_prepend_entry(
+      libesedb_page_cache_t *page_cache,
+      int queue,
+      int entry_index )
+{
+	libesedb_page_cache_entry_t *entry = &( page_cache->entries[ entry_index ] );
+
+	entry->queue                = queue;
+	entry->previous_entry_index = -1;
+	entry->next_entry_index     = page_cache->queue_first_entry_index[ queue ];
+
+	if( entry->next_entry_index == -1 )
+	{
+		page_cache->queue_last_entry_index[ queue ] = entry_index;
+	}
+	else
+	{
+		page_cache->entries[ entry->next_entry_index ].previous_entry_index = entry_index;
+	}
+	page_cache->queue_first_entry_index[ queue ]  = entry_index;
+	page_cache->queue_number_of_entries[ queue ] += 1;
+}
+
+/* Removes an entry from the hash table and adds it to the free list
+ */
+void libesedb_page_cache_release_entry(
+      libesedb_page_cache_t *page_cache,
+      int entry_index )
+{
+	libesedb_page_cache_entry_t *entry = &( page_cache->entries[ entry_index ] );
+	int hash_entry_index               = 0;
+	int hash_index                     = 0;
+
+	hash_index       = (int) ( entry->page_number % (uint32_t) page_cache->hash_table_size );
+	hash_entry_index = page_cache->hash_table[ hash_index ];
+
+	if( hash_entry_index == entry_index )
+	{
+		page_cache->hash_table[ hash_index ] = entry->next_hash_entry_index;
+	}
+	else
+	{
+		while( hash_entry_index != -1 )
+		{
+			if( page_cache->entries[ hash_entry_index ].next_hash_entry_index == entry_index )
+			{
+				page_cache->entries[ hash_entry_index ].next_hash_entry_index = entry->next_hash_entry_index;
+
+				break;
+			}
+			hash_entry_index = page_cache->entries[ hash_entry_index ].next_hash_entry_index;
+		}
+	}
+	entry->page_number           = 0;
+	entry->next_hash_entry_index = -1;
+	entry->next_entry_index      = page_cache->free_entry_index;
+
+	page_cache->free_entry_index = entry_index;
+}
+
+/* Creates a page cache
+ * Make sure the value page_cache is referencing, is set to NULL
+ * The free page function is used to free the pages that are evicted
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_cache_initialize(
+     libesedb_page_cache_t **page_cache,
+     int maximum_number_of_pages,
+     int (*free_page)(
+            intptr_t **page,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	static char *function  = "libesedb_page_cache_initialize";
+	size_t entries_size    = 0;
+	size_t hash_table_size = 0;
+	int entry_index        = 0;
+	int hash_index         = 0;
+	int queue              = 0;
+
+	if( page_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_pages < 4 )
+	 || ( maximum_number_of_pages > ( INT_MAX / 4 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of pages value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( free_page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid free page function.",
+		 function );
+
+		return( -1 );
+	}
+	*page_cache = memory_allocate_structure(
+	               libesedb_page_cache_t );
+
+	if( *page_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create page cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *page_cache,
+	     0,
+	     sizeof( libesedb_page_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear page cache.",
+		 function );
+
+		memory_free(
+		 *page_cache );
+
+		*page_cache = NULL;
+
+		return( -1 );
+	}
+	/* The 2Q recent queue is sized at 25 percent of the pages
+	 * and the ghost queue remembers 50 percent of the pages
+	 */
+	( *page_cache )->free_page                      = free_page;
+	( *page_cache )->maximum_number_of_pages        = maximum_number_of_pages;
+	( *page_cache )->maximum_number_of_recent_pages = maximum_number_of_pages / 4;
+	( *page_cache )->maximum_number_of_ghost_pages  = maximum_number_of_pages / 2;
+	( *page_cache )->number_of_entries              = maximum_number_of_pages + ( maximum_number_of_pages / 2 );
+	( *page_cache )->hash_table_size                = ( *page_cache )->number_of_entries;
+
+	entries_size = sizeof( libesedb_page_cache_entry_t ) * ( *page_cache )->number_of_entries;
+
+	( *page_cache )->entries = (libesedb_page_cache_entry_t *) memory_allocate(
+	                                                             entries_size );
+
+	if( ( *page_cache )->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	hash_table_size = sizeof( int ) * ( *page_cache )->hash_table_size;
+
+	( *page_cache )->hash_table = (int *) memory_allocate(
+	                                       hash_table_size );
+
+	if( ( *page_cache )->hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < ( *page_cache )->number_of_entries;
+	     entry_index++ )
+	{
+		( *page_cache )->entries[ entry_index ].page_number           = 0;
+		( *page_cache )->entries[ entry_index ].page                  = NULL;
+		( *page_cache )->entries[ entry_index ].queue                 = LIBESEDB_PAGE_CACHE_QUEUE_NONE;
+		( *page_cache )->entries[ entry_index ].previous_entry_index  = -1;
+		( *page_cache )->entries[ entry_index ].next_entry_index      = entry_index + 1;
+		( *page_cache )->entries[ entry_index ].next_hash_entry_index = -1;
+	}
+	( *page_cache )->entries[ ( *page_cache )->number_of_entries - 1 ].next_entry_index = -1;
+
+	for( hash_index = 0;
+	     hash_index < ( *page_cache )->hash_table_size;
+	     hash_index++ )
+	{
+		( *page_cache )->hash_table[ hash_index ] = -1;
+	}
+	for( queue = 0;
+	     queue < 4;
+	     queue++ )
+	{
+		( *page_cache )->queue_first_entry_index[ queue ] = -1;
+		( *page_cache )->queue_last_entry_index[ queue ]  = -1;
+	}
+	return( 1 );
+
+on_error:
+	if( *page_cache != NULL )
+	{
+		if( ( *page_cache )->entries != NULL )
+		{
+			memory_free(
+			 ( *page_cache )->entries );
+		}
+		memory_free(
+		 *page_cache );
+
+		*page_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a page cache and the cached pages
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_cache_free(
+     libesedb_page_cache_t **page_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_cache_free";
+	int entry_index       = 0;
+	int result            = 1;
+
+	if( page_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_cache != NULL )
+	{
+		for( entry_index = 0;
+		     entry_index < ( *page_cache )->number_of_entries;
+		     entry_index++ )
+		{
+			if( ( *page_cache )->entries[ entry_index ].page != NULL )
+			{
+				if( ( *page_cache )->free_page(
+				     &( ( *page_cache )->entries[ entry_index ].page ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free page: %" PRIu32 ".",
+					 function,
+					 ( *page_cache )->entries[ entry_index ].page_number );
+
+					result = -1;
+				}
+			}
+		}
+		memory_free(
+		 ( *page_cache )->hash_table );
+
+		memory_free(
+		 ( *page_cache )->entries );
+
+		memory_free(
+		 *page_cache );
+
+		*page_cache = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the number of cached pages
+ * The pages remembered in the ghost queue are not cached
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_cache_get_number_of_pages(
+     libesedb_page_cache_t *page_cache,
+     int *number_of_pages,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_cache_get_number_of_pages";
+
+	if( page_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of pages.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_pages = page_cache->queue_number_of_entries[ LIBESEDB_PAGE_CACHE_QUEUE_RECENT ]
+	                 + page_cache->queue_number_of_entries[ LIBESEDB_PAGE_CACHE_QUEUE_FREQUENT ];
+
+	return( 1 );
+}
+
+/* Retrieves the index of the entry of a specific page
+ * Returns the entry index or -1 if not available
+ */
+int libesedb_page_cache_get_entry_index(
+     libesedb_page_cache_t *page_cache,
+     uint32_t page_number )
+{
+	int entry_index = 0;
+
+	entry_index = page_cache->hash_table[ page_number % (uint32_t) page_cache->hash_table_size ];
+
+	while( entry_index != -1 )
+	{
+		if( page_cache->entries[ entry_index ].page_number == page_number )
+		{
+			break;
+		}
+		entry_index = page_cache->entries[ entry_index ].next_hash_entry_index;
+	}
+	return( entry_index );
+}
+
+/* Retrieves a specific page
+ * The page is owned by the page cache and remains valid until it is evicted
+ * Returns 1 if successful, 0 if the page is not cached or -1 on error
+ */
+int libesedb_page_cache_get_page(
+     libesedb_page_cache_t *page_cache,
+     uint32_t page_number,
+     intptr_t **page,
+     libcerror_error_t **error )
+{
+	libesedb_page_cache_entry_t *entry = NULL;
+	static char *function              = "libesedb_page_cache_get_page";
+	int entry_index                    = 0;
+
+	if( page_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_number == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid page number value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = libesedb_page_cache_get_entry_index(
+	               page_cache,
+	               page_number );
+
+	if( entry_index == -1 )
+	{
+		page_cache->number_of_misses += 1;
+
+		return( 0 );
+	}
+	entry = &( page_cache->entries[ entry_index ] );
+
+	if( entry->queue == LIBESEDB_PAGE_CACHE_QUEUE_GHOST )
+	{
+		page_cache->number_of_misses += 1;
+
+		return( 0 );
+	}
+	/* The recent queue is a FIFO, only the frequent queue is refreshed
+	 */
+	if( entry->queue == LIBESEDB_PAGE_CACHE_QUEUE_FREQUENT )
+	{
+		libesedb_page_cache_queue_remove_entry(
+		 page_cache,
+		 entry_index );
+
+		libesedb_page_cache_queue_prepend_entry(
+		 page_cache,
+		 LIBESEDB_PAGE_CACHE_QUEUE_FREQUENT,
+		 entry_index );
+	}
+	page_cache->number_of_hits += 1;
+
+	*page = entry->page;
+
+	return( 1 );
+}
+
+/* Sets a specific page
+ * The page cache takes over ownership of the page when successful. If the page
+ * is already cached the page is freed and replaced by the cached page
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_cache_set_page(
+     libesedb_page_cache_t *page_cache,
+     uint32_t page_number,
+     intptr_t **page,
+     libcerror_error_t **error )
+{
+	libesedb_page_cache_entry_t *entry = NULL;
+	intptr_t *victim_page              = NULL;
+	static char *function              = "libesedb_page_cache_set_page";
+	int entry_index                    = 0;
+	int ghost_entry_index              = 0;
+	int hash_index                     = 0;
+	int queue                          = 0;
+	int victim_entry_index             = 0;
+
+	if( page_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_number == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid page number value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: missing page.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = libesedb_page_cache_get_entry_index(
+	               page_cache,
+	               page_number );
+
+	if( entry_index != -1 )
+	{
+		entry = &( page_cache->entries[ entry_index ] );
+
+		if( entry->queue != LIBESEDB_PAGE_CACHE_QUEUE_GHOST )
+		{
+			/* The page was cached by another reader in the meantime
+			 */
+			if( entry->page != *page )
+			{
+				if( page_cache->free_page(
+				     page,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free page: %" PRIu32 ".",
+					 function,
+					 page_number );
+
+					return( -1 );
+				}
+				*page = entry->page;
+			}
+			return( 1 );
+		}
+		/* A page that is read again while in the ghost queue is frequently used
+		 */
+		libesedb_page_cache_queue_remove_entry(
+		 page_cache,
+		 entry_index );
+
+		queue = LIBESEDB_PAGE_CACHE_QUEUE_FREQUENT;
+	}
+	else
+	{
+		queue = LIBESEDB_PAGE_CACHE_QUEUE_RECENT;
+	}
+	/* Evict a page when the cache is full
+	 */
+	if( ( page_cache->queue_number_of_entries[ LIBESEDB_PAGE_CACHE_QUEUE_RECENT ]
+	    + page_cache->queue_number_of_entries[ LIBESEDB_PAGE_CACHE_QUEUE_FREQUENT ] ) >= page_cache->maximum_number_of_pages )
+	{
+		if( ( page_cache->queue_number_of_entries[ LIBESEDB_PAGE_CACHE_QUEUE_RECENT ] > page_cache->maximum_number_of_recent_pages )
+		 || ( page_cache->queue_number_of_entries[ LIBESEDB_PAGE_CACHE_QUEUE_FREQUENT ] == 0 ) )
+		{
+			/* The oldest page of the recent queue is moved to the ghost queue
+			 */
+			victim_entry_index = page_cache->queue_last_entry_index[ LIBESEDB_PAGE_CACHE_QUEUE_RECENT ];
+
+			libesedb_page_cache_queue_remove_entry(
+			 page_cache,
+			 victim_entry_index );
+
+			victim_page = page_cache->entries[ victim_entry_index ].page;
+
+			page_cache->entries[ victim_entry_index ].page = NULL;
+
+			if( page_cache->queue_number_of_entries[ LIBESEDB_PAGE_CACHE_QUEUE_GHOST ] >= page_cache->maximum_number_of_ghost_pages )
+			{
+				ghost_entry_index = page_cache->queue_last_entry_index[ LIBESEDB_PAGE_CACHE_QUEUE_GHOST ];
+
+				libesedb_page_cache_queue_remove_entry(
+				 page_cache,
+				 ghost_entry_index );
+
+				libesedb_page_cache_release_entry(
+				 page_cache,
+				 ghost_entry_index );
+			}
+			libesedb_page_cache_queue_prepend_entry(
+			 page_cache,
+			 LIBESEDB_PAGE_CACHE_QUEUE_GHOST,
+			 victim_entry_index );
+		}
+		else
+		{
+			/* The least recently used page of the frequent queue is evicted
+			 */
+			victim_entry_index = page_cache->queue_last_entry_index[ LIBESEDB_PAGE_CACHE_QUEUE_FREQUENT ];
+
+			libesedb_page_cache_queue_remove_entry(
+			 page_cache,
+			 victim_entry_index );
+
+			victim_page = page_cache->entries[ victim_entry_index ].page;
+
+			page_cache->entries[ victim_entry_index ].page = NULL;
+
+			libesedb_page_cache_release_entry(
+			 page_cache,
+			 victim_entry_index );
+		}
+	}
+	if( queue == LIBESEDB_PAGE_CACHE_QUEUE_RECENT )
+	{
+		entry_index = page_cache->free_entry_index;
+
+		if( entry_index == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing free entry.",
+			 function );
+
+			goto on_error;
+		}
+		page_cache->free_entry_index = page_cache->entries[ entry_index ].next_entry_index;
+
+		hash_index = (int) ( page_number % (uint32_t) page_cache->hash_table_size );
+
+		page_cache->entries[ entry_index ].page_number           = page_number;
+		page_cache->entries[ entry_index ].next_hash_entry_index = page_cache->hash_table[ hash_index ];
+
+		page_cache->hash_table[ hash_index ] = entry_index;
+	}
+	page_cache->entries[ entry_index ].page = *page;
+
+	libesedb_page_cache_queue_prepend_entry(
+	 page_cache,
+	 queue,
+	 entry_index );
+
+	if( victim_page != NULL )
+	{
+		if( page_cache->free_page(
+		     &victim_page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free evicted page.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( victim_page != NULL )
+	{
+		page_cache->free_page(
+		 &victim_page,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,186 @@
+/*
+ * Page cache functions
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_PAGE_CACHE_H )
+#define _LIBESEDB_PAGE_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_page_cache_entry libesedb_page_cache_entry_t;
+
+struct libesedb_page_cache_entry
+{
+	/* The page number
+	 */
+	uint32_t page_number;
+
+	/* The page
+	 * The page is NULL for an entry in the ghost queue
+	 */
+	intptr_t *page;
+
+	/* The queue that contains the entry
+	 */
+	int queue;
+
+	/* The index of the previous (more recently used) entry in the queue
+	 */
+	int previous_entry_index;
+
+	/* The index of the next (less recently used) entry in the queue or in the free list
+	 */
+	int next_entry_index;
+
+	/* The index of the next entry in the same hash bucket
+	 */
+	int next_hash_entry_index;
+};
+
+typedef struct libesedb_page_cache libesedb_page_cache_t;
+
+/* The page cache uses the 2Q replacement policy
+ * Pages read for the first time enter the recent queue (A1in), a FIFO that is
+ * not refreshed on a hit. Pages evicted from the recent queue are remembered,
+ * without page, in the ghost queue (A1out). Pages that are read again while in
+ * the ghost queue enter the frequent queue (Am), a LRU list. Hence pages read
+ * once by a sequential scan pass through the recent queue without evicting
+ * the pages in the frequent queue
+ */
+struct libesedb_page_cache
+{
+	/* The free page function
+	 */
+	int (*free_page)(
+	       intptr_t **page,
+	       libcerror_error_t **error );
+
+	/* The maximum number of cached pages
+	 */
+	int maximum_number_of_pages;
+
+	/* The maximum number of pages in the recent queue
+	 */
+	int maximum_number_of_recent_pages;
+
+	/* The maximum number of pages in the ghost queue
+	 */
+	int maximum_number_of_ghost_pages;
+
+	/* The entries
+	 */
+	libesedb_page_cache_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The index of the first entry in the free list
+	 */
+	int free_entry_index;
+
+	/* The hash table, contains the index of the first entry of each hash bucket
+	 */
+	int *hash_table;
+
+	/* The number of hash table buckets
+	 */
+	int hash_table_size;
+
+	/* The index of the first (most recently used) entry per queue
+	 */
+	int queue_first_entry_index[ 4 ];
+
+	/* The index of the last (least recently used) entry per queue
+	 */
+	int queue_last_entry_index[ 4 ];
+
+	/* The number of entries per queue
+	 */
+	int queue_number_of_entries[ 4 ];
+
+	/* The number of cache hits
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of cache misses
+	 */
+	uint64_t number_of_misses;
+};
+
+void libesedb_page_cache_queue_remove_entry(
+      libesedb_page_cache_t *page_cache,
+      int entry_index );
+
+void libesedb_page_cache_queue_prepend_entry(
+      libesedb_page_cache_t *page_cache,
+      int queue,
+      int entry_index );
+
+void libesedb_page_cache_release_entry(
+      libesedb_page_cache_t *page_cache,
+      int entry_index );
+
+int libesedb_page_cache_initialize(
+     libesedb_page_cache_t **page_cache,
+     int maximum_number_of_pages,
+     int (*free_page)(
+            intptr_t **page,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int libesedb_page_cache_free(
+     libesedb_page_cache_t **page_cache,
+     libcerror_error_t **error );
+
+int libesedb_page_cache_get_number_of_pages(
+     libesedb_page_cache_t *page_cache,
+     int *number_of_pages,
+     libcerror_error_t **error );
+
+int libesedb_page_cache_get_entry_index(
+     libesedb_page_cache_t *page_cache,
+     uint32_t page_number );
+
+int libesedb_page_cache_get_page(
+     libesedb_page_cache_t *page_cache,
+     uint32_t page_number,
+     intptr_t **page,
+     libcerror_error_t **error );
+
+int libesedb_page_cache_set_page(
+     libesedb_page_cache_t *page_cache,
+     uint32_t page_number,
+     intptr_t **page,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_PAGE_CACHE_H ) */
+
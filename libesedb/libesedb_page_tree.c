@@ -29,6 +29,7 @@
 #include "libesedb_definitions.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_key.h"
+#include "libesedb_layout_index.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
@@ -48,8 +49,6 @@
 int libesedb_page_tree_initialize(
      libesedb_page_tree_t **page_tree,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
      uint32_t object_identifier,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
@@ -119,8 +118,6 @@ int libesedb_page_tree_initialize(
 		goto on_error;
 	}
 	( *page_tree )->io_handle                 = io_handle;
-	( *page_tree )->pages_vector              = pages_vector;
-	( *page_tree )->pages_cache               = pages_cache;
 	( *page_tree )->object_identifier         = object_identifier;
 	( *page_tree )->table_definition          = table_definition;
 	( *page_tree )->template_table_definition = template_table_definition;
@@ -161,7 +158,7 @@ int libesedb_page_tree_free(
 	}
 	if( *page_tree != NULL )
 	{
-		/* The io_handle, pages_vector, pages_cache, table_definition and template_table_definition references
+		/* The io_handle, table_definition and template_table_definition references
 		 * are freed elsewhere
 		 */
 		memory_free(
@@ -178,14 +175,12 @@ int libesedb_page_tree_free(
 int libesedb_page_tree_read_root_page(
      libesedb_page_tree_t *page_tree,
      libbfio_handle_t *file_io_handle,
-     off64_t page_offset,
      uint32_t page_number,
      libcerror_error_t **error )
 {
 	libesedb_page_t *page             = NULL;
 	libesedb_page_value_t *page_value = NULL;
 	static char *function             = "libesedb_page_tree_read_root_page";
-	off64_t element_data_offset       = 0;
 	uint32_t extent_space             = 0;
 	uint32_t required_flags           = 0;
 	uint32_t supported_flags          = 0;
@@ -208,24 +203,20 @@ int libesedb_page_tree_read_root_page(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_at_offset(
-	     page_tree->pages_vector,
-	     (intptr_t *) file_io_handle,
-	     page_tree->pages_cache,
-	     page_offset,
-	     &element_data_offset,
-	     (intptr_t **) &page,
-	     0,
+	if( libesedb_page_get_from_cache(
+	     page_tree->io_handle,
+	     file_io_handle,
+	     page_number,
+	     &page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve page: %" PRIu32 " at offset: 0x%08" PRIx64 ".",
+		 "%s: unable to retrieve page: %" PRIu32 ".",
 		 function,
-		 page_number,
-		 page_offset );
+		 page_number );
 
 		return( -1 );
 	}
@@ -238,7 +229,7 @@ int libesedb_page_tree_read_root_page(
 		 "%s: missing page.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	required_flags = LIBESEDB_PAGE_FLAG_IS_ROOT;
 
@@ -252,10 +243,24 @@ int libesedb_page_tree_read_root_page(
 		 function,
 		 page->flags );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
 	{
+		if( libesedb_page_release(
+		     page_tree->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
 		return( 1 );
 	}
 	supported_flags = required_flags
@@ -281,7 +286,7 @@ int libesedb_page_tree_read_root_page(
 		 function,
 		 page->flags );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( libesedb_page_get_number_of_values(
 	     page,
@@ -295,10 +300,24 @@ int libesedb_page_tree_read_root_page(
 		 "%s: unable to retrieve number of page values.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( number_of_page_values == 0 )
 	{
+		if( libesedb_page_release(
+		     page_tree->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
 		return( 1 );
 	}
 	if( libesedb_page_get_value(
@@ -314,7 +333,7 @@ int libesedb_page_tree_read_root_page(
 		 "%s: unable to retrieve page value: 0.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value == NULL )
 	{
@@ -325,7 +344,7 @@ int libesedb_page_tree_read_root_page(
 		 "%s: missing page value.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value->data == NULL )
 	{
@@ -336,7 +355,7 @@ int libesedb_page_tree_read_root_page(
 		 "%s: invalid page value - missing data.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value->size != 16 )
 	{
@@ -347,7 +366,7 @@ int libesedb_page_tree_read_root_page(
 		 "%s: unsupported size of page value.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	byte_stream_copy_to_uint32_little_endian(
 	 ( (esedb_root_page_header_t *) page_value->data )->space_tree_page_number,
@@ -412,7 +431,7 @@ int libesedb_page_tree_read_root_page(
 			 function,
 			 space_tree_page_number );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( space_tree_page_number > 0 )
 		{
@@ -432,7 +451,7 @@ int libesedb_page_tree_read_root_page(
 				 function,
 				 space_tree_page_number );
 
-				return( -1 );
+				goto on_error;
 			}
 			/* Read the available pages space tree page
 			 */
@@ -452,11 +471,35 @@ int libesedb_page_tree_read_root_page(
 				 function,
 				 space_tree_page_number );
 
-				return( -1 );
+				goto on_error;
 			}
 		}
 	}
+	if( libesedb_page_release(
+	     page_tree->io_handle,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 page_tree->io_handle,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Reads the space tree page
@@ -497,13 +540,11 @@ int libesedb_page_tree_read_space_tree_page(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_by_index(
-	     page_tree->pages_vector,
-	     (intptr_t *) file_io_handle,
-	     page_tree->pages_cache,
-	     (int) page_number - 1,
-	     (intptr_t **) &page,
-	     0,
+	if( libesedb_page_get_from_cache(
+	     page_tree->io_handle,
+	     file_io_handle,
+	     page_number,
+	     &page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -525,7 +566,7 @@ int libesedb_page_tree_read_space_tree_page(
 		 "%s: missing page.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -553,10 +594,24 @@ int libesedb_page_tree_read_space_tree_page(
 		 function,
 		 page->flags );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
 	{
+		if( libesedb_page_release(
+		     page_tree->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
 		return( 1 );
 	}
 	supported_flags = required_flags
@@ -581,7 +636,7 @@ int libesedb_page_tree_read_space_tree_page(
 		 function,
 		 page->flags );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page->previous_page_number != 0 )
 	{
@@ -593,7 +648,7 @@ int libesedb_page_tree_read_space_tree_page(
 		 function,
 		 page->previous_page_number );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page->next_page_number != 0 )
 	{
@@ -605,7 +660,7 @@ int libesedb_page_tree_read_space_tree_page(
 		 function,
 		 page->next_page_number );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( libesedb_page_get_number_of_values(
 	     page,
@@ -619,10 +674,24 @@ int libesedb_page_tree_read_space_tree_page(
 		 "%s: unable to retrieve number of page values.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( number_of_page_values == 0 )
 	{
+		if( libesedb_page_release(
+		     page_tree->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
 		return( 1 );
 	}
 	if( libesedb_page_get_value(
@@ -639,7 +708,7 @@ int libesedb_page_tree_read_space_tree_page(
 		 function,
 		 page_value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value == NULL )
 	{
@@ -650,7 +719,7 @@ int libesedb_page_tree_read_space_tree_page(
 		 "%s: invalid page value.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -690,7 +759,7 @@ int libesedb_page_tree_read_space_tree_page(
 			 "%s: unsupported header size.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 	}
 /* TODO handle the space tree page header */
@@ -712,7 +781,7 @@ int libesedb_page_tree_read_space_tree_page(
 			 function,
 			 page_value_index );
 
-			return( -1 );
+			goto on_error;
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -753,7 +822,7 @@ int libesedb_page_tree_read_space_tree_page(
 				 function,
 				 page_value->flags );
 
-				return( -1 );
+				goto on_error;
 			}
 			if( page_value_size < 2 )
 			{
@@ -764,7 +833,7 @@ int libesedb_page_tree_read_space_tree_page(
 				 "%s: unsupported key size value out of bounds.",
 				 function );
 
-				return( -1 );
+				goto on_error;
 			}
 			byte_stream_copy_to_uint16_little_endian(
 			 page_value_data,
@@ -792,7 +861,7 @@ int libesedb_page_tree_read_space_tree_page(
 				 "%s: unsupported key size value out of bounds.",
 				 function );
 
-				return( -1 );
+				goto on_error;
 			}
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
@@ -830,7 +899,7 @@ int libesedb_page_tree_read_space_tree_page(
 				 "%s: unsupported key size value out of bounds.",
 				 function );
 
-				return( -1 );
+				goto on_error;
 			}
 			byte_stream_copy_to_uint32_little_endian(
 			 page_value_data,
@@ -887,7 +956,7 @@ int libesedb_page_tree_read_space_tree_page(
 				 function,
 				 space_tree_page_number );
 
-				return( -1 );
+				goto on_error;
 			}
 #endif
 		}
@@ -904,7 +973,31 @@ int libesedb_page_tree_read_space_tree_page(
 		 "\n" );
 	}
 #endif
+	if( libesedb_page_release(
+	     page_tree->io_handle,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 page_tree->io_handle,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Reads a page
@@ -924,7 +1017,6 @@ int libesedb_page_tree_read_page(
 	libesedb_page_value_t *page_value        = NULL;
 	uint8_t *page_value_data                 = NULL;
 	static char *function                    = "libesedb_page_tree_read_page";
-	off64_t element_data_offset              = 0;
 	off64_t sub_node_data_offset             = 0;
 	uint32_t child_page_number               = 0;
 	uint32_t supported_flags                 = 0;
@@ -963,24 +1055,20 @@ int libesedb_page_tree_read_page(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_at_offset(
-	     page_tree->pages_vector,
-	     (intptr_t *) file_io_handle,
-	     page_tree->pages_cache,
-	     page_offset,
-	     &element_data_offset,
-	     (intptr_t **) &page,
-	     0,
+	if( libesedb_page_get_from_cache(
+	     page_tree->io_handle,
+	     file_io_handle,
+	     page_number,
+	     &page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve page: %" PRIu32 " at offset: 0x%08" PRIx64 ".",
+		 "%s: unable to retrieve page: %" PRIu32 ".",
 		 function,
-		 page_number,
-		 page_offset );
+		 page_number );
 
 		goto on_error;
 	}
@@ -997,6 +1085,20 @@ int libesedb_page_tree_read_page(
 	}
 	if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
 	{
+		if( libesedb_page_release(
+		     page_tree->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
 		return( 1 );
 	}
 	supported_flags = LIBESEDB_PAGE_FLAG_IS_ROOT
@@ -1031,7 +1133,6 @@ int libesedb_page_tree_read_page(
 		if( libesedb_page_tree_read_root_page(
 		     page_tree,
 		     file_io_handle,
-		     page_offset,
 		     page_number,
 		     error ) != 1 )
 		{
@@ -1045,41 +1146,6 @@ int libesedb_page_tree_read_page(
 
 			goto on_error;
 		}
-		/* Since the previous function reads the space tree
-		 * page can be cached out and we must be sure to re-read it.
-		 */
-		if( libfdata_vector_get_element_value_at_offset(
-		     page_tree->pages_vector,
-		     (intptr_t *) file_io_handle,
-		     page_tree->pages_cache,
-		     page_offset,
-		     &element_data_offset,
-		     (intptr_t **) &page,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve page: %" PRIu32 " at offset: 0x%08" PRIx64 ".",
-			 function,
-			 page_number,
-			 page_offset );
-
-			goto on_error;
-		}
-		if( page == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing page.",
-			 function );
-
-			goto on_error;
-		}
 	}
 #endif
 	if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
@@ -1179,6 +1245,20 @@ int libesedb_page_tree_read_page(
 	}
 	if( number_of_page_values == 0 )
 	{
+		if( libesedb_page_release(
+		     page_tree->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
 		return( 1 );
 	}
 	for( page_value_index = 1;
@@ -1615,9 +1695,30 @@ int libesedb_page_tree_read_page(
 			}
 		}
 	}
+	if( libesedb_page_release(
+	     page_tree->io_handle,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 page_tree->io_handle,
+		 &page,
+		 NULL );
+	}
 	if( key != NULL )
 	{
 		libesedb_key_free(
@@ -1911,3 +2012,3502 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves a specific page
+ * The page is referenced on behalf of the caller and must be released
+ * using libesedb_page_release
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_get_page(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint32_t page_number,
+     libesedb_page_t **page,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_tree_get_page";
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_number == 0 )
+	 || ( page_number > page_tree->io_handle->last_page_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page number: %" PRIu32 " value out of bounds.",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_from_cache(
+	     page_tree->io_handle,
+	     file_io_handle,
+	     page_number,
+	     page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	if( *page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the child page number stored in a specific page value of a parent page
+ * Returns 1 if successful, 0 if the page value is defunct or has no valid child page number or -1 on error
+ */
+int libesedb_page_tree_get_child_page_number(
+     libesedb_page_tree_t *page_tree,
+     libesedb_page_t *page,
+     uint16_t page_value_index,
+     libesedb_key_t *key,
+     uint32_t *child_page_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_tree_get_child_page_number";
+	uint16_t data_offset  = 0;
+	uint16_t data_size    = 0;
+	int result            = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( child_page_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid child page number.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_page_get_value_data_range(
+	          page,
+	          page_value_index,
+	          key,
+	          &data_offset,
+	          &data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page value: %" PRIu16 " data range.",
+		 function,
+		 page_value_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( data_size < 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: page value: %" PRIu16 " data size value out of bounds.",
+		 function,
+		 page_value_index );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( page->data[ data_offset ] ),
+	 *child_page_number );
+
+	if( ( *child_page_number == 0 )
+	 || ( *child_page_number > page_tree->io_handle->last_page_number ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the page number of the first (left-most) leaf page
+ * The page tree is descended from the root page following the first child page of every parent page
+ * Returns 1 if successful, 0 if the page tree has no leaf pages or -1 on error
+ */
+int libesedb_page_tree_get_first_leaf_page_number(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint32_t root_page_number,
+     uint32_t *leaf_page_number,
+     libcerror_error_t **error )
+{
+	libesedb_layout_index_tree_t *layout_index_tree = NULL;
+	libesedb_page_t *page                           = NULL;
+	static char *function                           = "libesedb_page_tree_get_first_leaf_page_number";
+	uint32_t child_page_number                      = 0;
+	uint32_t page_number                            = 0;
+	uint16_t number_of_values                       = 0;
+	uint16_t page_value_index                       = 0;
+	int depth                                       = 0;
+	int result                                      = 0;
+
+	if( leaf_page_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf page number.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_page_tree_get_layout_index_tree(
+	          page_tree,
+	          root_page_number,
+	          &layout_index_tree,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve layout index tree.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( layout_index_tree->number_of_leaf_pages == 0 )
+		{
+			return( 0 );
+		}
+		*leaf_page_number = layout_index_tree->leaf_page_numbers[ 0 ];
+
+		return( 1 );
+	}
+	page_number = root_page_number;
+
+	for( depth = 0;
+	     depth < LIBESEDB_MAXIMUM_PAGE_TREE_DEPTH;
+	     depth++ )
+	{
+		if( libesedb_page_tree_get_page(
+		     page_tree,
+		     file_io_handle,
+		     page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
+		{
+			if( libesedb_page_release(
+			     page_tree->io_handle,
+			     &page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release page.",
+				 function );
+
+				goto on_error;
+			}
+			return( 0 );
+		}
+		if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+		{
+			*leaf_page_number = page_number;
+
+			if( libesedb_page_release(
+			     page_tree->io_handle,
+			     &page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release page.",
+				 function );
+
+				goto on_error;
+			}
+			return( 1 );
+		}
+		if( libesedb_page_get_number_of_values(
+		     page,
+		     &number_of_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of page values.",
+			 function );
+
+			goto on_error;
+		}
+		result = 0;
+
+		for( page_value_index = 1;
+		     page_value_index < number_of_values;
+		     page_value_index++ )
+		{
+			result = libesedb_page_tree_get_child_page_number(
+			          page_tree,
+			          page,
+			          page_value_index,
+			          NULL,
+			          &child_page_number,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve child page number from page: %" PRIu32 " value: %" PRIu16 ".",
+				 function,
+				 page_number,
+				 page_value_index );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				break;
+			}
+		}
+		if( result == 0 )
+		{
+			if( libesedb_page_release(
+			     page_tree->io_handle,
+			     &page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release page.",
+				 function );
+
+				goto on_error;
+			}
+			return( 0 );
+		}
+		if( libesedb_page_release(
+		     page_tree->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+		page_number = child_page_number;
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+	 "%s: page tree depth exceeds maximum.",
+	 function );
+
+	return( -1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 page_tree->io_handle,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the child page number of the child page of a parent page that contains the key data
+ * The child page is that of the first parent page value with a key that is greater than
+ * or equal to the key data, where an empty key has no upper bound. An exact match selects
+ * the child page of the parent page value, like a branch key in the libfdata B-tree, since
+ * equal keys can be stored in both this child page and the next, the caller is expected
+ * to scan the next leaf pages if the child page contains no such key
+ * The parent page value is determined using a binary search, where parent page values
+ * without a valid child page are skipped by probing the next parent page values
+ * If the key data is greater than all the keys the last valid child page is used
+ * Returns 1 if successful, 0 if the parent page has no valid child page or -1 on error
+ */
+int libesedb_page_tree_get_child_page_number_by_key(
+     libesedb_page_tree_t *page_tree,
+     libesedb_page_t *page,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     uint32_t *child_page_number,
+     libcerror_error_t **error )
+{
+	const uint8_t *common_key_data   = NULL;
+	const uint8_t *local_key_data    = NULL;
+	static char *function            = "libesedb_page_tree_get_child_page_number_by_key";
+	uint32_t found_child_page_number = 0;
+	uint32_t safe_child_page_number  = 0;
+	uint16_t common_key_size         = 0;
+	uint16_t high_value_index        = 0;
+	uint16_t local_key_size          = 0;
+	uint16_t low_value_index         = 0;
+	uint16_t middle_value_index      = 0;
+	uint16_t number_of_values        = 0;
+	uint16_t page_value_index        = 0;
+	int compare_result               = 0;
+	int result                       = 0;
+
+	if( child_page_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid child page number.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_number_of_values(
+	     page,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of page values.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first page value contains the page header and is not part of the key order
+	 */
+	low_value_index  = 1;
+	high_value_index = number_of_values;
+
+	while( low_value_index < high_value_index )
+	{
+		middle_value_index = low_value_index + ( ( high_value_index - low_value_index ) / 2 );
+
+		for( page_value_index = middle_value_index;
+		     page_value_index < high_value_index;
+		     page_value_index++ )
+		{
+			result = libesedb_page_tree_get_child_page_number(
+			          page_tree,
+			          page,
+			          page_value_index,
+			          NULL,
+			          &safe_child_page_number,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve child page number from page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				break;
+			}
+		}
+		/* None of the parent page values from the middle up to the high value index
+		 * has a valid child page
+		 */
+		if( page_value_index >= high_value_index )
+		{
+			high_value_index = middle_value_index;
+
+			continue;
+		}
+		if( libesedb_page_get_value_key(
+		     page,
+		     page_value_index,
+		     &common_key_data,
+		     &common_key_size,
+		     &local_key_data,
+		     &local_key_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page value: %" PRIu16 " key.",
+			 function,
+			 page_value_index );
+
+			return( -1 );
+		}
+		/* Check if the key is empty, therefore has no upper bound
+		 */
+		if( ( common_key_size == 0 )
+		 && ( local_key_size == 0 ) )
+		{
+			compare_result = LIBFDATA_COMPARE_LESS;
+		}
+		else
+		{
+			compare_result = libesedb_key_compare_data(
+			                  key_data,
+			                  key_data_size,
+			                  common_key_data,
+			                  (size_t) common_key_size,
+			                  local_key_data,
+			                  (size_t) local_key_size,
+			                  error );
+
+			if( compare_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare key data with page value: %" PRIu16 " key.",
+				 function,
+				 page_value_index );
+
+				return( -1 );
+			}
+		}
+		if( compare_result == LIBFDATA_COMPARE_GREATER )
+		{
+			low_value_index = page_value_index + 1;
+		}
+		else
+		{
+			high_value_index = page_value_index;
+
+			found_child_page_number = safe_child_page_number;
+		}
+	}
+	if( found_child_page_number == 0 )
+	{
+		/* The key data is greater than all the keys, use the last valid child page
+		 */
+		page_value_index = number_of_values;
+
+		while( page_value_index > 1 )
+		{
+			page_value_index--;
+
+			result = libesedb_page_tree_get_child_page_number(
+			          page_tree,
+			          page,
+			          page_value_index,
+			          NULL,
+			          &safe_child_page_number,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve child page number from page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				found_child_page_number = safe_child_page_number;
+
+				break;
+			}
+		}
+	}
+	if( found_child_page_number == 0 )
+	{
+		return( 0 );
+	}
+	*child_page_number = found_child_page_number;
+
+	return( 1 );
+}
+
+/* Seeks the first leaf value with a key that is greater than or equal to the key data
+ * The page tree is descended from the root page, reading a single page per level.
+ * If the leaf page does not contain such a leaf value the next leaf pages are searched
+ * Returns 1 if successful, 0 if no such leaf value or -1 on error
+ */
+int libesedb_page_tree_seek_leaf_value(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint32_t root_page_number,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     uint32_t *leaf_page_number,
+     uint16_t *leaf_value_index,
+     uint8_t *is_exact_match,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page    = NULL;
+	static char *function    = "libesedb_page_tree_seek_leaf_value";
+	uint32_t number_of_pages = 0;
+	uint32_t page_number     = 0;
+	int depth                = 0;
+	int result               = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_data == NULL )
+	 && ( key_data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_page_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf page number.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf value index.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_exact_match == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid is exact match.",
+		 function );
+
+		return( -1 );
+	}
+	page_number = root_page_number;
+
+	for( depth = 0;
+	     depth < LIBESEDB_MAXIMUM_PAGE_TREE_DEPTH;
+	     depth++ )
+	{
+		if( libesedb_page_tree_get_page(
+		     page_tree,
+		     file_io_handle,
+		     page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
+		{
+			if( libesedb_page_release(
+			     page_tree->io_handle,
+			     &page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release page.",
+				 function );
+
+				goto on_error;
+			}
+			return( 0 );
+		}
+		if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+		{
+			break;
+		}
+		result = libesedb_page_tree_get_child_page_number_by_key(
+		          page_tree,
+		          page,
+		          key_data,
+		          key_data_size,
+		          &page_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve child page number from page: %" PRIu32 ".",
+			 function,
+			 page->page_number );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libesedb_page_release(
+			     page_tree->io_handle,
+			     &page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release page.",
+				 function );
+
+				goto on_error;
+			}
+			return( 0 );
+		}
+		if( libesedb_page_release(
+		     page_tree->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( depth >= LIBESEDB_MAXIMUM_PAGE_TREE_DEPTH )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: page tree depth exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	/* The leaf value can be stored in one of the next leaf pages
+	 * if it is greater than all the keys in the leaf page
+	 */
+	while( page_number != 0 )
+	{
+		if( number_of_pages >= page_tree->io_handle->last_page_number )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: number of leaf pages exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_pages++;
+
+		if( number_of_pages > 1 )
+		{
+			if( libesedb_page_tree_get_page(
+			     page_tree,
+			     file_io_handle,
+			     page_number,
+			     &page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page: %" PRIu32 ".",
+				 function,
+				 page_number );
+
+				goto on_error;
+			}
+			if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported page: %" PRIu32 " - not a leaf page.",
+				 function,
+				 page_number );
+
+				goto on_error;
+			}
+		}
+		if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) == 0 )
+		{
+			result = libesedb_page_get_value_index_by_key(
+			          page,
+			          key_data,
+			          key_data_size,
+			          leaf_value_index,
+			          is_exact_match,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value index from page: %" PRIu32 ".",
+				 function,
+				 page_number );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				*leaf_page_number = page_number;
+
+				if( libesedb_page_release(
+				     page_tree->io_handle,
+				     &page,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to release page.",
+					 function );
+
+					goto on_error;
+				}
+				return( 1 );
+			}
+		}
+		page_number = page->next_page_number;
+
+		if( libesedb_page_release(
+		     page_tree->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 0 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 page_tree->io_handle,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends the child page numbers of a parent page to a page numbers array
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_append_child_page_numbers(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint32_t page_number,
+     uint32_t **page_numbers,
+     int *number_of_page_numbers,
+     int *page_numbers_size,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page      = NULL;
+	uint32_t *reallocation     = NULL;
+	static char *function      = "libesedb_page_tree_append_child_page_numbers";
+	uint32_t child_page_number = 0;
+	uint16_t number_of_values  = 0;
+	uint16_t page_value_index  = 0;
+	int reallocation_size      = 0;
+	int result                 = 0;
+
+	if( page_numbers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page numbers.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_page_numbers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of page numbers.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_numbers_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page numbers size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_get_page(
+	     page_tree,
+	     file_io_handle,
+	     page_number,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
+	{
+		if( libesedb_page_release(
+		     page_tree->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported page: %" PRIu32 " - not a parent page.",
+		 function,
+		 page_number );
+
+		goto on_error;
+	}
+	if( libesedb_page_get_number_of_values(
+	     page,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of page values.",
+		 function );
+
+		goto on_error;
+	}
+	for( page_value_index = 1;
+	     page_value_index < number_of_values;
+	     page_value_index++ )
+	{
+		result = libesedb_page_tree_get_child_page_number(
+		          page_tree,
+		          page,
+		          page_value_index,
+		          NULL,
+		          &child_page_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve child page number from page: %" PRIu32 " value: %" PRIu16 ".",
+			 function,
+			 page_number,
+			 page_value_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( *number_of_page_numbers >= *page_numbers_size )
+		{
+			if( *page_numbers_size >= ( INT_MAX / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid page numbers size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			if( *page_numbers_size == 0 )
+			{
+				reallocation_size = 64;
+			}
+			else
+			{
+				reallocation_size = *page_numbers_size * 2;
+			}
+			reallocation = (uint32_t *) memory_reallocate(
+			                             *page_numbers,
+			                             sizeof( uint32_t ) * reallocation_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize page numbers.",
+				 function );
+
+				goto on_error;
+			}
+			*page_numbers      = reallocation;
+			*page_numbers_size = reallocation_size;
+		}
+		( *page_numbers )[ *number_of_page_numbers ] = child_page_number;
+
+		*number_of_page_numbers += 1;
+	}
+	if( libesedb_page_release(
+	     page_tree->io_handle,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 page_tree->io_handle,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the first leaf page numbers of up to maximum number of partitions
+ * The page tree is descended level by level from the root page until a level contains
+ * at least maximum number of partitions pages or the leaf level is reached. The pages of
+ * that level are divided into partitions with (about) the same number of pages.
+ * A partition contains the leaf pages from its first leaf page up to the first leaf page
+ * of the next partition, following the next page numbers stored in the page headers
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_get_partition_leaf_page_numbers(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint32_t root_page_number,
+     int maximum_number_of_partitions,
+     uint32_t *leaf_page_numbers,
+     int *number_of_partitions,
+     libcerror_error_t **error )
+{
+	libesedb_layout_index_tree_t *layout_index_tree = NULL;
+	libesedb_page_t *page                           = NULL;
+	uint32_t *level_page_numbers                    = NULL;
+	uint32_t *next_page_numbers                     = NULL;
+	static char *function                           = "libesedb_page_tree_get_partition_leaf_page_numbers";
+	uint32_t leaf_page_number                       = 0;
+	uint32_t page_flags                             = 0;
+	int depth                                       = 0;
+	int level_page_number_index                     = 0;
+	int next_page_numbers_size                      = 0;
+	int number_of_level_pages                       = 0;
+	int number_of_next_pages                        = 0;
+	int partition_index                             = 0;
+	int result                                      = 0;
+	int safe_number_of_partitions                   = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_partitions <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of partitions value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_page_numbers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf page numbers.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_partitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of partitions.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_page_tree_get_layout_index_tree(
+	          page_tree,
+	          root_page_number,
+	          &layout_index_tree,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve layout index tree.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		/* The leaf pages are known, hence the partitions can be divided at the leaf level
+		 */
+		if( layout_index_tree->number_of_leaf_pages < maximum_number_of_partitions )
+		{
+			maximum_number_of_partitions = layout_index_tree->number_of_leaf_pages;
+		}
+		for( partition_index = 0;
+		     partition_index < maximum_number_of_partitions;
+		     partition_index++ )
+		{
+			level_page_number_index = (int) ( ( (int64_t) partition_index * layout_index_tree->number_of_leaf_pages ) / maximum_number_of_partitions );
+
+			leaf_page_numbers[ partition_index ] = layout_index_tree->leaf_page_numbers[ level_page_number_index ];
+		}
+		*number_of_partitions = maximum_number_of_partitions;
+
+		return( 1 );
+	}
+	level_page_numbers = (uint32_t *) memory_allocate(
+	                                   sizeof( uint32_t ) );
+
+	if( level_page_numbers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create level page numbers.",
+		 function );
+
+		goto on_error;
+	}
+	level_page_numbers[ 0 ] = root_page_number;
+	number_of_level_pages   = 1;
+
+	for( depth = 0;
+	     depth < LIBESEDB_MAXIMUM_PAGE_TREE_DEPTH;
+	     depth++ )
+	{
+		if( ( number_of_level_pages == 0 )
+		 || ( number_of_level_pages >= maximum_number_of_partitions ) )
+		{
+			break;
+		}
+		if( libesedb_page_tree_get_page(
+		     page_tree,
+		     file_io_handle,
+		     level_page_numbers[ 0 ],
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 level_page_numbers[ 0 ] );
+
+			goto on_error;
+		}
+		page_flags = page->flags;
+
+		if( libesedb_page_release(
+		     page_tree->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+		/* The pages of the leaf level cannot be divided any further
+		 */
+		if( ( page_flags & ( LIBESEDB_PAGE_FLAG_IS_EMPTY | LIBESEDB_PAGE_FLAG_IS_LEAF ) ) != 0 )
+		{
+			break;
+		}
+		number_of_next_pages = 0;
+
+		for( level_page_number_index = 0;
+		     level_page_number_index < number_of_level_pages;
+		     level_page_number_index++ )
+		{
+			if( libesedb_page_tree_append_child_page_numbers(
+			     page_tree,
+			     file_io_handle,
+			     level_page_numbers[ level_page_number_index ],
+			     &next_page_numbers,
+			     &number_of_next_pages,
+			     &next_page_numbers_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve child page numbers of page: %" PRIu32 ".",
+				 function,
+				 level_page_numbers[ level_page_number_index ] );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 level_page_numbers );
+
+		level_page_numbers    = next_page_numbers;
+		number_of_level_pages = number_of_next_pages;
+
+		next_page_numbers      = NULL;
+		next_page_numbers_size = 0;
+	}
+	if( number_of_level_pages < maximum_number_of_partitions )
+	{
+		maximum_number_of_partitions = number_of_level_pages;
+	}
+	for( partition_index = 0;
+	     partition_index < maximum_number_of_partitions;
+	     partition_index++ )
+	{
+		level_page_number_index = (int) ( ( (int64_t) partition_index * number_of_level_pages ) / maximum_number_of_partitions );
+
+		result = libesedb_page_tree_get_first_leaf_page_number(
+		          page_tree,
+		          file_io_handle,
+		          level_page_numbers[ level_page_number_index ],
+		          &leaf_page_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first leaf page number of page: %" PRIu32 ".",
+			 function,
+			 level_page_numbers[ level_page_number_index ] );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			leaf_page_numbers[ safe_number_of_partitions++ ] = leaf_page_number;
+		}
+	}
+	if( level_page_numbers != NULL )
+	{
+		memory_free(
+		 level_page_numbers );
+	}
+	*number_of_partitions = safe_number_of_partitions;
+
+	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 page_tree->io_handle,
+		 &page,
+		 NULL );
+	}
+	if( next_page_numbers != NULL )
+	{
+		memory_free(
+		 next_page_numbers );
+	}
+	if( level_page_numbers != NULL )
+	{
+		memory_free(
+		 level_page_numbers );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of leaf values stored in a leaf page
+ * Only the page tags are read, defunct page values are not counted
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_get_number_of_leaf_page_values(
+     libesedb_page_tree_t *page_tree,
+     libesedb_page_t *page,
+     uint64_t *number_of_leaf_values,
+     libcerror_error_t **error )
+{
+	libesedb_page_value_t *page_value = NULL;
+	static char *function             = "libesedb_page_tree_get_number_of_leaf_page_values";
+	uint16_t number_of_values         = 0;
+	uint16_t page_value_index         = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_leaf_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of leaf values.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_leaf_values = 0;
+
+	if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
+	{
+		return( 1 );
+	}
+	if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported page: %" PRIu32 " - not a leaf page.",
+		 function,
+		 page->page_number );
+
+		return( -1 );
+	}
+	if( libesedb_page_get_number_of_values(
+	     page,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of page values.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first page value is the page header value
+	 */
+	for( page_value_index = 1;
+	     page_value_index < number_of_values;
+	     page_value_index++ )
+	{
+		if( libesedb_page_get_value(
+		     page,
+		     page_value_index,
+		     &page_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page value: %" PRIu16 ".",
+			 function,
+			 page_value_index );
+
+			return( -1 );
+		}
+		if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) == 0 )
+		{
+			*number_of_leaf_values += 1;
+		}
+	}
+	return( 1 );
+}
+
+/* Counts the number of leaf values
+ * The leaf values are counted from the page tags of the leaf pages, following the next page numbers
+ * stored in the page headers, without reading the leaf values themselves
+ * If LIBESEDB_COUNT_FLAG_ESTIMATE is set only the parent pages and a sample of the leaf pages are read,
+ * and the number of leaf values is estimated from the number of leaf pages
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_count_leaf_values(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint32_t root_page_number,
+     uint8_t flags,
+     uint64_t *number_of_leaf_values,
+     libcerror_error_t **error )
+{
+	libesedb_layout_index_tree_t *layout_index_tree = NULL;
+	libesedb_page_t *page                           = NULL;
+	uint32_t *level_page_numbers                    = NULL;
+	uint32_t *next_page_numbers                     = NULL;
+	static char *function                           = "libesedb_page_tree_count_leaf_values";
+	uint64_t number_of_page_leaf_values             = 0;
+	uint64_t safe_number_of_leaf_values             = 0;
+	uint32_t number_of_pages                        = 0;
+	uint32_t page_flags                             = 0;
+	uint32_t page_number                            = 0;
+	int depth                                       = 0;
+	int level_page_number_index                     = 0;
+	int next_page_numbers_size                      = 0;
+	int number_of_level_pages                       = 0;
+	int number_of_next_pages                        = 0;
+	int number_of_samples                           = 0;
+	int result                                      = 0;
+	int sample_index                                = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( LIBESEDB_COUNT_FLAG_ESTIMATE ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	if( number_of_leaf_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of leaf values.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_page_tree_get_layout_index_tree(
+	          page_tree,
+	          root_page_number,
+	          &layout_index_tree,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve layout index tree.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		/* The number of leaf values stored in the layout index is exact
+		 */
+		*number_of_leaf_values = layout_index_tree->number_of_leaf_values;
+
+		return( 1 );
+	}
+	if( ( flags & LIBESEDB_COUNT_FLAG_ESTIMATE ) == 0 )
+	{
+		result = libesedb_page_tree_get_first_leaf_page_number(
+		          page_tree,
+		          file_io_handle,
+		          root_page_number,
+		          &page_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first leaf page number.",
+			 function );
+
+			goto on_error;
+		}
+		while( page_number != 0 )
+		{
+			if( number_of_pages >= page_tree->io_handle->last_page_number )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: number of leaf pages exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			number_of_pages++;
+
+			if( libesedb_page_tree_get_page(
+			     page_tree,
+			     file_io_handle,
+			     page_number,
+			     &page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page: %" PRIu32 ".",
+				 function,
+				 page_number );
+
+				goto on_error;
+			}
+			if( libesedb_page_tree_get_number_of_leaf_page_values(
+			     page_tree,
+			     page,
+			     &number_of_page_leaf_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of leaf values of page: %" PRIu32 ".",
+				 function,
+				 page_number );
+
+				goto on_error;
+			}
+			safe_number_of_leaf_values += number_of_page_leaf_values;
+
+			page_number = page->next_page_number;
+
+			if( libesedb_page_release(
+			     page_tree->io_handle,
+			     &page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release page.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		*number_of_leaf_values = safe_number_of_leaf_values;
+
+		return( 1 );
+	}
+	/* Determine the leaf page numbers from the parent pages
+	 */
+	level_page_numbers = (uint32_t *) memory_allocate(
+	                                   sizeof( uint32_t ) );
+
+	if( level_page_numbers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create level page numbers.",
+		 function );
+
+		goto on_error;
+	}
+	level_page_numbers[ 0 ] = root_page_number;
+	number_of_level_pages   = 1;
+
+	for( depth = 0;
+	     depth < LIBESEDB_MAXIMUM_PAGE_TREE_DEPTH;
+	     depth++ )
+	{
+		if( libesedb_page_tree_get_page(
+		     page_tree,
+		     file_io_handle,
+		     level_page_numbers[ 0 ],
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 level_page_numbers[ 0 ] );
+
+			goto on_error;
+		}
+		page_flags = page->flags;
+
+		if( libesedb_page_release(
+		     page_tree->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( page_flags & ( LIBESEDB_PAGE_FLAG_IS_EMPTY | LIBESEDB_PAGE_FLAG_IS_LEAF ) ) != 0 )
+		{
+			break;
+		}
+		number_of_next_pages = 0;
+
+		for( level_page_number_index = 0;
+		     level_page_number_index < number_of_level_pages;
+		     level_page_number_index++ )
+		{
+			if( libesedb_page_tree_append_child_page_numbers(
+			     page_tree,
+			     file_io_handle,
+			     level_page_numbers[ level_page_number_index ],
+			     &next_page_numbers,
+			     &number_of_next_pages,
+			     &next_page_numbers_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve child page numbers of page: %" PRIu32 ".",
+				 function,
+				 level_page_numbers[ level_page_number_index ] );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 level_page_numbers );
+
+		level_page_numbers    = next_page_numbers;
+		number_of_level_pages = number_of_next_pages;
+
+		next_page_numbers      = NULL;
+		next_page_numbers_size = 0;
+
+		if( number_of_level_pages == 0 )
+		{
+			break;
+		}
+	}
+	if( depth >= LIBESEDB_MAXIMUM_PAGE_TREE_DEPTH )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: page tree depth exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	/* Sample leaf pages evenly spread over the leaf level
+	 */
+	number_of_samples = number_of_level_pages;
+
+	if( number_of_samples > LIBESEDB_MAXIMUM_NUMBER_OF_SAMPLED_LEAF_PAGES )
+	{
+		number_of_samples = LIBESEDB_MAXIMUM_NUMBER_OF_SAMPLED_LEAF_PAGES;
+	}
+	for( sample_index = 0;
+	     sample_index < number_of_samples;
+	     sample_index++ )
+	{
+		level_page_number_index = (int) ( ( (int64_t) sample_index * number_of_level_pages ) / number_of_samples );
+
+		if( libesedb_page_tree_get_page(
+		     page_tree,
+		     file_io_handle,
+		     level_page_numbers[ level_page_number_index ],
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 level_page_numbers[ level_page_number_index ] );
+
+			goto on_error;
+		}
+		if( libesedb_page_tree_get_number_of_leaf_page_values(
+		     page_tree,
+		     page,
+		     &number_of_page_leaf_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of leaf values of page: %" PRIu32 ".",
+			 function,
+			 level_page_numbers[ level_page_number_index ] );
+
+			goto on_error;
+		}
+		safe_number_of_leaf_values += number_of_page_leaf_values;
+
+		if( libesedb_page_release(
+		     page_tree->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( number_of_samples > 0 )
+	{
+		safe_number_of_leaf_values *= (uint64_t) number_of_level_pages;
+		safe_number_of_leaf_values /= (uint64_t) number_of_samples;
+	}
+	if( level_page_numbers != NULL )
+	{
+		memory_free(
+		 level_page_numbers );
+	}
+	*number_of_leaf_values = safe_number_of_leaf_values;
+
+	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 page_tree->io_handle,
+		 &page,
+		 NULL );
+	}
+	if( next_page_numbers != NULL )
+	{
+		memory_free(
+		 next_page_numbers );
+	}
+	if( level_page_numbers != NULL )
+	{
+		memory_free(
+		 level_page_numbers );
+	}
+	return( -1 );
+}
+
+
+/* Retrieves the layout index tree of the page tree with a specific root page number
+ * Returns 1 if successful, 0 if no layout index or no such tree or -1 on error
+ */
+int libesedb_page_tree_get_layout_index_tree(
+     libesedb_page_tree_t *page_tree,
+     uint32_t root_page_number,
+     libesedb_layout_index_tree_t **layout_index_tree,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_page_tree_get_layout_index_tree";
+	int result            = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle->layout_index == NULL )
+	{
+		return( 0 );
+	}
+	result = libesedb_layout_index_get_tree_by_root_page_number(
+	          page_tree->io_handle->layout_index,
+	          root_page_number,
+	          layout_index_tree,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve tree with root page number: %" PRIu32 " from layout index.",
+		 function,
+		 root_page_number );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Appends the leaf pages of the page tree with a specific root page number to a layout index
+ * The leaf pages are read following the next page numbers stored in the page headers
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_append_layout_index_tree(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint32_t root_page_number,
+     libesedb_layout_index_t *layout_index,
+     libcerror_error_t **error )
+{
+	libesedb_layout_index_tree_t *layout_index_tree = NULL;
+	libesedb_page_t *page                           = NULL;
+	static char *function                           = "libesedb_page_tree_append_layout_index_tree";
+	uint64_t number_of_page_leaf_values             = 0;
+	uint32_t page_number                            = 0;
+	int result                                      = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_layout_index_get_tree_by_root_page_number(
+	          layout_index,
+	          root_page_number,
+	          &layout_index_tree,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve tree with root page number: %" PRIu32 " from layout index.",
+		 function,
+		 root_page_number );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		/* Page trees can be shared, e.g. by a table and its primary index
+		 */
+		return( 1 );
+	}
+	layout_index_tree = NULL;
+
+	if( libesedb_layout_index_tree_initialize(
+	     &layout_index_tree,
+	     root_page_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create layout index tree.",
+		 function );
+
+		goto on_error;
+	}
+	result = libesedb_page_tree_get_first_leaf_page_number(
+	          page_tree,
+	          file_io_handle,
+	          root_page_number,
+	          &page_number,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first leaf page number.",
+		 function );
+
+		goto on_error;
+	}
+	while( page_number != 0 )
+	{
+		if( (uint32_t) layout_index_tree->number_of_leaf_pages >= page_tree->io_handle->last_page_number )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: number of leaf pages exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_page_tree_get_page(
+		     page_tree,
+		     file_io_handle,
+		     page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		if( libesedb_page_tree_get_number_of_leaf_page_values(
+		     page_tree,
+		     page,
+		     &number_of_page_leaf_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of leaf values of page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		if( libesedb_layout_index_tree_append_leaf_page(
+		     layout_index_tree,
+		     page_number,
+		     (uint32_t) number_of_page_leaf_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append leaf page: %" PRIu32 " to layout index tree.",
+			 function,
+			 page_number );
+
+			goto on_error;
+		}
+		page_number = page->next_page_number;
+
+		if( libesedb_page_release(
+		     page_tree->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_layout_index_append_tree(
+	     layout_index,
+	     layout_index_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append tree to layout index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 page_tree->io_handle,
+		 &page,
+		 NULL );
+	}
+	if( layout_index_tree != NULL )
+	{
+		libesedb_layout_index_tree_free(
+		 &layout_index_tree,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends the leaf value data of the page tree with a specific root page number
+ * to a layout index as (catalog) definitions
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_append_layout_index_definitions(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint32_t root_page_number,
+     uint32_t definition_type,
+     libesedb_layout_index_t *layout_index,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page     = NULL;
+	static char *function     = "libesedb_page_tree_append_layout_index_definitions";
+	uint32_t number_of_pages  = 0;
+	uint32_t page_number      = 0;
+	uint16_t data_offset      = 0;
+	uint16_t data_size        = 0;
+	uint16_t number_of_values = 0;
+	uint16_t page_value_index = 0;
+	int result                = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_page_tree_get_first_leaf_page_number(
+	          page_tree,
+	          file_io_handle,
+	          root_page_number,
+	          &page_number,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first leaf page number.",
+		 function );
+
+		return( -1 );
+	}
+	while( page_number != 0 )
+	{
+		if( number_of_pages >= page_tree->io_handle->last_page_number )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: number of leaf pages exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_pages++;
+
+		if( libesedb_page_tree_get_page(
+		     page_tree,
+		     file_io_handle,
+		     page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) == 0 )
+		{
+			if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported page: %" PRIu32 " - not a leaf page.",
+				 function,
+				 page_number );
+
+				goto on_error;
+			}
+			if( libesedb_page_get_number_of_values(
+			     page,
+			     &number_of_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of page values.",
+				 function );
+
+				goto on_error;
+			}
+			/* The first page value is the page header value
+			 */
+			for( page_value_index = 1;
+			     page_value_index < number_of_values;
+			     page_value_index++ )
+			{
+				result = libesedb_page_get_value_data_range(
+				          page,
+				          page_value_index,
+				          NULL,
+				          &data_offset,
+				          &data_size,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve page: %" PRIu32 " value: %" PRIu16 " data range.",
+					 function,
+					 page_number,
+					 page_value_index );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					continue;
+				}
+				if( libesedb_layout_index_append_definition(
+				     layout_index,
+				     definition_type,
+				     &( page->data[ data_offset ] ),
+				     (size_t) data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append page: %" PRIu32 " value: %" PRIu16 " data to layout index.",
+					 function,
+					 page_number,
+					 page_value_index );
+
+					goto on_error;
+				}
+			}
+		}
+		page_number = page->next_page_number;
+
+		if( libesedb_page_release(
+		     page_tree->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 page_tree->io_handle,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Inserts an extent into an array of extents sorted by first page number
+ * The extents are stored as pairs of the first page number and the number of pages
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_insert_extent(
+     uint32_t **extents,
+     int *number_of_extents,
+     int *extents_size,
+     uint32_t first_page_number,
+     uint32_t number_of_pages,
+     libcerror_error_t **error )
+{
+	uint32_t *reallocation = NULL;
+	static char *function  = "libesedb_page_tree_insert_extent";
+	int extent_index       = 0;
+	int safe_extents_size  = 0;
+
+	if( extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( extents_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extents size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *number_of_extents >= *extents_size )
+	{
+		if( *extents_size == 0 )
+		{
+			safe_extents_size = 16;
+		}
+		else
+		{
+			if( *extents_size > ( INT_MAX / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of extents value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			safe_extents_size = *extents_size * 2;
+		}
+		if( (size_t) safe_extents_size > ( (size_t) SSIZE_MAX / ( 2 * sizeof( uint32_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid extents size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = (uint32_t *) memory_reallocate(
+		                             *extents,
+		                             sizeof( uint32_t ) * 2 * safe_extents_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize extents.",
+			 function );
+
+			return( -1 );
+		}
+		*extents      = reallocation;
+		*extents_size = safe_extents_size;
+	}
+	/* The extents are mostly read in ascending order
+	 */
+	extent_index = *number_of_extents;
+
+	while( extent_index > 0 )
+	{
+		if( ( *extents )[ ( extent_index - 1 ) * 2 ] <= first_page_number )
+		{
+			break;
+		}
+		( *extents )[ extent_index * 2 ]         = ( *extents )[ ( extent_index - 1 ) * 2 ];
+		( *extents )[ ( extent_index * 2 ) + 1 ] = ( *extents )[ ( ( extent_index - 1 ) * 2 ) + 1 ];
+
+		extent_index--;
+	}
+	( *extents )[ extent_index * 2 ]         = first_page_number;
+	( *extents )[ ( extent_index * 2 ) + 1 ] = number_of_pages;
+
+	*number_of_extents += 1;
+
+	return( 1 );
+}
+
+/* Reads the extents stored in a space tree page and its child pages
+ * The key of a space tree leaf page entry contains the last page number of the extent
+ * stored in big-endian
+ * Returns 1 if successful, 0 if the space tree is not supported or -1 on error
+ */
+int libesedb_page_tree_read_space_tree_extents(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint32_t page_number,
+     int recursion_depth,
+     uint32_t **extents,
+     int *number_of_extents,
+     int *extents_size,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page             = NULL;
+	libesedb_page_value_t *page_value = NULL;
+	uint8_t *key_data                 = NULL;
+	uint8_t *page_value_data          = NULL;
+	static char *function             = "libesedb_page_tree_read_space_tree_extents";
+	uint32_t last_page_number         = 0;
+	uint32_t value_32bit              = 0;
+	uint16_t key_size                 = 0;
+	uint16_t number_of_page_values    = 0;
+	uint16_t page_value_index         = 0;
+	uint16_t page_value_size          = 0;
+	int result                        = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBESEDB_MAXIMUM_PAGE_TREE_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_get_page(
+	     page_tree,
+	     file_io_handle,
+	     page_number,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_SPACE_TREE ) == 0 )
+	{
+		if( libesedb_page_release(
+		     page_tree->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
+	{
+		if( libesedb_page_release(
+		     page_tree->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	if( libesedb_page_get_number_of_values(
+	     page,
+	     &number_of_page_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of page values.",
+		 function );
+
+		goto on_error;
+	}
+	/* The first page value is the space tree page header
+	 */
+	for( page_value_index = 1;
+	     page_value_index < number_of_page_values;
+	     page_value_index++ )
+	{
+		if( libesedb_page_get_value(
+		     page,
+		     page_value_index,
+		     &page_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page value: %" PRIu16 ".",
+			 function,
+			 page_value_index );
+
+			goto on_error;
+		}
+		if( page_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing page value: %" PRIu16 ".",
+			 function,
+			 page_value_index );
+
+			goto on_error;
+		}
+		if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+		{
+			continue;
+		}
+		page_value_data = page_value->data;
+		page_value_size = page_value->size;
+
+		if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE ) != 0 )
+		{
+			if( page_value_size < 2 )
+			{
+				if( libesedb_page_release(
+				     page_tree->io_handle,
+				     &page,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to release page.",
+					 function );
+
+					goto on_error;
+				}
+				return( 0 );
+			}
+			page_value_data += 2;
+			page_value_size -= 2;
+		}
+		if( page_value_size < 2 )
+		{
+			if( libesedb_page_release(
+			     page_tree->io_handle,
+			     &page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release page.",
+				 function );
+
+				goto on_error;
+			}
+			return( 0 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 page_value_data,
+		 key_size );
+
+		page_value_data += 2;
+		page_value_size -= 2;
+
+		if( key_size > page_value_size )
+		{
+			if( libesedb_page_release(
+			     page_tree->io_handle,
+			     &page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release page.",
+				 function );
+
+				goto on_error;
+			}
+			return( 0 );
+		}
+		key_data = page_value_data;
+
+		page_value_data += key_size;
+		page_value_size -= key_size;
+
+		if( page_value_size < 4 )
+		{
+			if( libesedb_page_release(
+			     page_tree->io_handle,
+			     &page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release page.",
+				 function );
+
+				goto on_error;
+			}
+			return( 0 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 page_value_data,
+		 value_32bit );
+
+		if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+		{
+			/* The local page key must contain the last page number
+			 */
+			if( key_size < 4 )
+			{
+				if( libesedb_page_release(
+				     page_tree->io_handle,
+				     &page,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to release page.",
+					 function );
+
+					goto on_error;
+				}
+				return( 0 );
+			}
+			byte_stream_copy_to_uint32_big_endian(
+			 &( key_data[ key_size - 4 ] ),
+			 last_page_number );
+
+			if( value_32bit == 0 )
+			{
+				continue;
+			}
+			if( ( last_page_number > page_tree->io_handle->last_page_number )
+			 || ( value_32bit > last_page_number ) )
+			{
+				if( libesedb_page_release(
+				     page_tree->io_handle,
+				     &page,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to release page.",
+					 function );
+
+					goto on_error;
+				}
+				return( 0 );
+			}
+			if( libesedb_page_tree_insert_extent(
+			     extents,
+			     number_of_extents,
+			     extents_size,
+			     last_page_number - value_32bit + 1,
+			     value_32bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert extent.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( ( value_32bit == 0 )
+			 || ( value_32bit > page_tree->io_handle->last_page_number ) )
+			{
+				if( libesedb_page_release(
+				     page_tree->io_handle,
+				     &page,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to release page.",
+					 function );
+
+					goto on_error;
+				}
+				return( 0 );
+			}
+			result = libesedb_page_tree_read_space_tree_extents(
+			          page_tree,
+			          file_io_handle,
+			          value_32bit,
+			          recursion_depth + 1,
+			          extents,
+			          number_of_extents,
+			          extents_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read space tree page: %" PRIu32 " extents.",
+				 function,
+				 value_32bit );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				if( libesedb_page_release(
+				     page_tree->io_handle,
+				     &page,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to release page.",
+					 function );
+
+					goto on_error;
+				}
+				return( 0 );
+			}
+		}
+	}
+	if( libesedb_page_release(
+	     page_tree->io_handle,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 page_tree->io_handle,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Subtracts extents from an array of extents
+ * Both arrays of extents are stored as pairs of the first page number and the number
+ * of pages, sorted by first page number and should not contain overlapping extents
+ * The resulting extents contain the pages of the extents that are not in the subtracted extents
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_subtract_extents(
+     const uint32_t *extents,
+     int number_of_extents,
+     const uint32_t *subtracted_extents,
+     int number_of_subtracted_extents,
+     uint32_t **result_extents,
+     int *number_of_result_extents,
+     libcerror_error_t **error )
+{
+	uint32_t *safe_extents         = NULL;
+	static char *function          = "libesedb_page_tree_subtract_extents";
+	uint32_t first_page_number     = 0;
+	uint32_t last_page_number      = 0;
+	uint32_t subtracted_first_page = 0;
+	uint32_t subtracted_last_page  = 0;
+	int extent_index               = 0;
+	int safe_extents_size          = 0;
+	int safe_number_of_extents     = 0;
+	int subtracted_extent_index    = 0;
+
+	if( ( extents == NULL )
+	 && ( number_of_extents != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extents < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of extents value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( subtracted_extents == NULL )
+	 && ( number_of_subtracted_extents != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid subtracted extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_subtracted_extents < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of subtracted extents value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( result_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid result extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( *result_extents != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid result extents value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_result_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of result extents.",
+		 function );
+
+		return( -1 );
+	}
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		if( extents[ ( extent_index * 2 ) + 1 ] == 0 )
+		{
+			continue;
+		}
+		first_page_number = extents[ extent_index * 2 ];
+		last_page_number  = first_page_number + extents[ ( extent_index * 2 ) + 1 ] - 1;
+
+		while( first_page_number <= last_page_number )
+		{
+			while( subtracted_extent_index < number_of_subtracted_extents )
+			{
+				subtracted_first_page = subtracted_extents[ subtracted_extent_index * 2 ];
+				subtracted_last_page  = subtracted_first_page + subtracted_extents[ ( subtracted_extent_index * 2 ) + 1 ] - 1;
+
+				if( ( subtracted_extents[ ( subtracted_extent_index * 2 ) + 1 ] != 0 )
+				 && ( subtracted_last_page >= first_page_number ) )
+				{
+					break;
+				}
+				subtracted_extent_index++;
+			}
+			if( ( subtracted_extent_index >= number_of_subtracted_extents )
+			 || ( subtracted_first_page > last_page_number ) )
+			{
+				subtracted_first_page = last_page_number + 1;
+				subtracted_last_page  = last_page_number;
+			}
+			if( subtracted_first_page > first_page_number )
+			{
+				if( libesedb_page_tree_insert_extent(
+				     &safe_extents,
+				     &safe_number_of_extents,
+				     &safe_extents_size,
+				     first_page_number,
+				     subtracted_first_page - first_page_number,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to insert extent.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( subtracted_last_page >= last_page_number )
+			{
+				break;
+			}
+			first_page_number = subtracted_last_page + 1;
+		}
+	}
+	*result_extents           = safe_extents;
+	*number_of_result_extents = safe_number_of_extents;
+
+	return( 1 );
+
+on_error:
+	if( safe_extents != NULL )
+	{
+		memory_free(
+		 safe_extents );
+	}
+	return( -1 );
+}
+
+/* Retrieves the extents of the pages owned by the page tree that are in use
+ * These are the extents in the owned pages space tree without the extents in
+ * the available pages space tree. The extents are stored as pairs of the first
+ * page number and the number of pages, sorted by first page number
+ * Besides the leaf and branch pages of the page tree the extents contain the pages
+ * of the space trees and of child page trees, such as those of indexes and long values
+ * Returns 1 if successful, 0 if the page tree has no (supported) space tree or -1 on error
+ */
+int libesedb_page_tree_get_owned_page_extents(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint32_t root_page_number,
+     uint32_t **extents,
+     int *number_of_extents,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page             = NULL;
+	libesedb_page_value_t *page_value = NULL;
+	uint32_t *available_extents       = NULL;
+	uint32_t *owned_extents           = NULL;
+	uint32_t *safe_extents            = NULL;
+	static char *function             = "libesedb_page_tree_get_owned_page_extents";
+	uint32_t extent_space             = 0;
+	uint32_t space_tree_page_number   = 0;
+	uint16_t number_of_page_values    = 0;
+	int available_extents_size        = 0;
+	int number_of_available_extents   = 0;
+	int number_of_owned_extents       = 0;
+	int owned_extents_size            = 0;
+	int result                        = 0;
+	int safe_number_of_extents        = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extents != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid extents value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_get_page(
+	     page_tree,
+	     file_io_handle,
+	     root_page_number,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root page: %" PRIu32 ".",
+		 function,
+		 root_page_number );
+
+		goto on_error;
+	}
+	if( ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_ROOT ) == 0 )
+	 || ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 ) )
+	{
+		if( libesedb_page_release(
+		     page_tree->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	if( libesedb_page_get_number_of_values(
+	     page,
+	     &number_of_page_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of page values.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_page_values == 0 )
+	{
+		if( libesedb_page_release(
+		     page_tree->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	if( libesedb_page_get_value(
+	     page,
+	     0,
+	     &page_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page value: 0.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( page_value == NULL )
+	 || ( page_value->data == NULL )
+	 || ( page_value->size != sizeof( esedb_root_page_header_t ) ) )
+	{
+		if( libesedb_page_release(
+		     page_tree->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_root_page_header_t *) page_value->data )->extent_space,
+	 extent_space );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_root_page_header_t *) page_value->data )->space_tree_page_number,
+	 space_tree_page_number );
+
+	if( libesedb_page_release(
+	     page_tree->io_handle,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page.",
+		 function );
+
+		goto on_error;
+	}
+
+	/* A page tree with a single extent has no space tree
+	 */
+	if( ( extent_space == 0 )
+	 || ( space_tree_page_number == 0 )
+	 || ( space_tree_page_number >= page_tree->io_handle->last_page_number ) )
+	{
+		return( 0 );
+	}
+	result = libesedb_page_tree_read_space_tree_extents(
+	          page_tree,
+	          file_io_handle,
+	          space_tree_page_number,
+	          0,
+	          &owned_extents,
+	          &number_of_owned_extents,
+	          &owned_extents_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read owned pages space tree page: %" PRIu32 ".",
+		 function,
+		 space_tree_page_number );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		result = libesedb_page_tree_read_space_tree_extents(
+		          page_tree,
+		          file_io_handle,
+		          space_tree_page_number + 1,
+		          0,
+		          &available_extents,
+		          &number_of_available_extents,
+		          &available_extents_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read available pages space tree page: %" PRIu32 ".",
+			 function,
+			 space_tree_page_number + 1 );
+
+			goto on_error;
+		}
+	}
+	if( result == 0 )
+	{
+		if( owned_extents != NULL )
+		{
+			memory_free(
+			 owned_extents );
+		}
+		if( available_extents != NULL )
+		{
+			memory_free(
+			 available_extents );
+		}
+		return( 0 );
+	}
+	/* Remove the available extents from the owned extents
+	 */
+	if( libesedb_page_tree_subtract_extents(
+	     owned_extents,
+	     number_of_owned_extents,
+	     available_extents,
+	     number_of_available_extents,
+	     &safe_extents,
+	     &safe_number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to remove available extents from owned extents.",
+		 function );
+
+		goto on_error;
+	}
+	if( owned_extents != NULL )
+	{
+		memory_free(
+		 owned_extents );
+	}
+	if( available_extents != NULL )
+	{
+		memory_free(
+		 available_extents );
+	}
+	*extents           = safe_extents;
+	*number_of_extents = safe_number_of_extents;
+
+	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 page_tree->io_handle,
+		 &page,
+		 NULL );
+	}
+	if( safe_extents != NULL )
+	{
+		memory_free(
+		 safe_extents );
+	}
+	if( available_extents != NULL )
+	{
+		memory_free(
+		 available_extents );
+	}
+	if( owned_extents != NULL )
+	{
+		memory_free(
+		 owned_extents );
+	}
+	return( -1 );
+}
+
@@ -26,10 +26,13 @@
 #include <types.h>
 
 #include "libesedb_io_handle.h"
+#include "libesedb_key.h"
+#include "libesedb_layout_index.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_page.h"
 #include "libesedb_table_definition.h"
 
 #if defined( __cplusplus )
@@ -55,21 +58,11 @@ struct libesedb_page_tree
 	/* The template table definition
 	 */
 	libesedb_table_definition_t *template_table_definition;
-
-	/* The pages vector
-	 */
-	libfdata_vector_t *pages_vector;
-
-	/* The pages cache
-	 */
-	libfcache_cache_t *pages_cache;
 };
 
 int libesedb_page_tree_initialize(
      libesedb_page_tree_t **page_tree,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
      uint32_t object_identifier,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
@@ -82,7 +75,6 @@ int libesedb_page_tree_free(
 int libesedb_page_tree_read_root_page(
      libesedb_page_tree_t *page_tree,
      libbfio_handle_t *file_io_handle,
-     off64_t page_offset,
      uint32_t page_number,
      libcerror_error_t **error );
 
@@ -126,6 +118,135 @@ int libesedb_page_tree_read_leaf_value(
      uint8_t read_flags,
      libcerror_error_t **error );
 
+int libesedb_page_tree_get_page(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint32_t page_number,
+     libesedb_page_t **page,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_get_child_page_number(
+     libesedb_page_tree_t *page_tree,
+     libesedb_page_t *page,
+     uint16_t page_value_index,
+     libesedb_key_t *key,
+     uint32_t *child_page_number,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_get_first_leaf_page_number(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint32_t root_page_number,
+     uint32_t *leaf_page_number,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_get_child_page_number_by_key(
+     libesedb_page_tree_t *page_tree,
+     libesedb_page_t *page,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     uint32_t *child_page_number,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_seek_leaf_value(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint32_t root_page_number,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     uint32_t *leaf_page_number,
+     uint16_t *leaf_value_index,
+     uint8_t *is_exact_match,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_append_child_page_numbers(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint32_t page_number,
+     uint32_t **page_numbers,
+     int *number_of_page_numbers,
+     int *page_numbers_size,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_get_partition_leaf_page_numbers(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint32_t root_page_number,
+     int maximum_number_of_partitions,
+     uint32_t *leaf_page_numbers,
+     int *number_of_partitions,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_get_number_of_leaf_page_values(
+     libesedb_page_tree_t *page_tree,
+     libesedb_page_t *page,
+     uint64_t *number_of_leaf_values,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_count_leaf_values(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint32_t root_page_number,
+     uint8_t flags,
+     uint64_t *number_of_leaf_values,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_get_layout_index_tree(
+     libesedb_page_tree_t *page_tree,
+     uint32_t root_page_number,
+     libesedb_layout_index_tree_t **layout_index_tree,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_append_layout_index_tree(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint32_t root_page_number,
+     libesedb_layout_index_t *layout_index,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_append_layout_index_definitions(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint32_t root_page_number,
+     uint32_t definition_type,
+     libesedb_layout_index_t *layout_index,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_insert_extent(
+     uint32_t **extents,
+     int *number_of_extents,
+     int *extents_size,
+     uint32_t first_page_number,
+     uint32_t number_of_pages,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_read_space_tree_extents(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint32_t page_number,
+     int recursion_depth,
+     uint32_t **extents,
+     int *number_of_extents,
+     int *extents_size,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_subtract_extents(
+     const uint32_t *extents,
+     int number_of_extents,
+     const uint32_t *subtracted_extents,
+     int number_of_subtracted_extents,
+     uint32_t **result_extents,
+     int *number_of_result_extents,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_get_owned_page_extents(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     uint32_t root_page_number,
+     uint32_t **extents,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
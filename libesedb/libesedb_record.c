@@ -39,6 +39,7 @@
 #include "libesedb_long_value.h"
 #include "libesedb_multi_value.h"
 #include "libesedb_record.h"
+#include "libesedb_record_layout.h"
 #include "libesedb_record_value.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
@@ -53,10 +54,8 @@ int libesedb_record_initialize(
      libesedb_io_handle_t *io_handle,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
-     libfdata_vector_t *long_values_pages_vector,
-     libfcache_cache_t *long_values_pages_cache,
+     const uint8_t *column_mask,
+     int column_mask_size,
      libesedb_data_definition_t *data_definition,
      libfdata_btree_t *long_values_tree,
      libfcache_cache_t *long_values_cache,
@@ -158,11 +157,13 @@ int libesedb_record_initialize(
 	     data_definition,
 	     file_io_handle,
 	     io_handle,
-	     pages_vector,
-	     pages_cache,
 	     table_definition,
 	     template_table_definition,
+	     column_mask,
+	     column_mask_size,
 	     internal_record->values_array,
+	     &( internal_record->values_data ),
+	     &( internal_record->values_data_size ),
 	     &( internal_record->flags ),
 	     error ) != 1 )
 	{
@@ -179,10 +180,6 @@ int libesedb_record_initialize(
 	internal_record->io_handle                 = io_handle;
 	internal_record->table_definition          = table_definition;
 	internal_record->template_table_definition = template_table_definition;
-	internal_record->pages_vector              = pages_vector;
-	internal_record->pages_cache               = pages_cache;
-	internal_record->long_values_pages_vector  = long_values_pages_vector;
-	internal_record->long_values_pages_cache   = long_values_pages_cache;
 	internal_record->long_values_tree          = long_values_tree;
 	internal_record->long_values_cache         = long_values_cache;
 
@@ -200,6 +197,11 @@ on_error:
 			 NULL,
 			 NULL );
 		}
+		if( internal_record->values_data != NULL )
+		{
+			memory_free(
+			 internal_record->values_data );
+		}
 		memory_free(
 		 internal_record );
 	}
@@ -233,9 +235,8 @@ int libesedb_record_free(
 		internal_record = (libesedb_internal_record_t *) *record;
 		*record         = NULL;
 
-		/* The io_handle, file_io_handle, table_definition, template_table_definition, pages_vector,
-		 * pages_cache, * long_values_pages_vector, long_values_pages_cache, long_values_tree
-		 * and long_values_cache references are freed elsewhere
+		/* The io_handle, file_io_handle, table_definition, template_table_definition,
+		 * long_values_tree and long_values_cache references are freed elsewhere
 		 */
 		if( libcdata_array_free(
 		     &( internal_record->values_array ),
@@ -251,6 +252,13 @@ int libesedb_record_free(
 
 			result = -1;
 		}
+		/* The values data is freed after the values that reference it
+		 */
+		if( internal_record->values_data != NULL )
+		{
+			memory_free(
+			 internal_record->values_data );
+		}
 		memory_free(
 		 internal_record );
 	}
@@ -307,8 +315,7 @@ int libesedb_record_get_column_catalog_definition(
      libesedb_catalog_definition_t **column_catalog_definition,
      libcerror_error_t **error )
 {
-	static char *function                = "libesedb_record_get_column_identifier";
-	int template_table_number_of_columns = 0;
+	static char *function = "libesedb_record_get_column_catalog_definition";
 
 	if( internal_record == NULL )
 	{
@@ -332,59 +339,44 @@ int libesedb_record_get_column_catalog_definition(
 
 		return( -1 );
 	}
-	if( internal_record->template_table_definition != NULL )
+	if( internal_record->table_definition->record_layout == NULL )
 	{
-		if( libcdata_list_get_number_of_elements(
-		     internal_record->template_table_definition->column_catalog_definition_list,
-		     &template_table_number_of_columns,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of columns from template table.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - invalid table definition - missing record layout.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	if( value_entry < template_table_number_of_columns )
+	if( ( value_entry < 0 )
+	 || ( value_entry >= internal_record->table_definition->record_layout->number_of_columns ) )
 	{
-		if( libcdata_list_get_value_by_index(
-		     internal_record->template_table_definition->column_catalog_definition_list,
-		     value_entry,
-		     (intptr_t **) column_catalog_definition,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column catalog definition from template table.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value entry value out of bounds.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	else
+	if( column_catalog_definition == NULL )
 	{
-		if( libcdata_list_get_value_by_index(
-		     internal_record->table_definition->column_catalog_definition_list,
-		     value_entry - template_table_number_of_columns,
-		     (intptr_t **) column_catalog_definition,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve column catalog definition from table.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
+	/* The columns of the template table precede those of the table in the record layout
+	 */
+	*column_catalog_definition = internal_record->table_definition->record_layout->column_catalog_definitions[ value_entry ];
+
 	return( 1 );
 }
 
@@ -446,6 +438,65 @@ int libesedb_record_get_column_identifier(
 	return( 1 );
 }
 
+/* Retrieves the value entry of a specific column identifier
+ * The column entries are looked up in the record layout of the table
+ * Returns 1 if successful, 0 if no such column or -1 on error
+ */
+int libesedb_record_get_value_entry_by_column_identifier(
+     libesedb_record_t *record,
+     uint32_t column_identifier,
+     int *value_entry,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_t *internal_record = NULL;
+	static char *function                       = "libesedb_record_get_value_entry_by_column_identifier";
+	int result                                  = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libesedb_internal_record_t *) record;
+
+	if( internal_record->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_record_layout_get_column_entry_by_identifier(
+	          internal_record->table_definition->record_layout,
+	          column_identifier,
+	          value_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column entry of column identifier: %" PRIu32 ".",
+		 function,
+		 column_identifier );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the column type of the specific entry
  * Returns 1 if successful or -1 on error
  */
@@ -886,6 +937,132 @@ int libesedb_record_get_value(
 	return( 1 );
 }
 
+/* Retrieves a pointer to the value data of the specific entry
+ * The pointer references the copy of the record data that is made when the record
+ * is read, hence the value data is not copied again and the pointer is valid as long
+ * as the record is. Long values and multi values are not supported, since the value
+ * data of these only contains the long value key or the unparsed multi value data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_get_value_data_pointer(
+     libesedb_record_t *record,
+     int value_entry,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_t *internal_record = NULL;
+	libfvalue_value_t *record_value             = NULL;
+	uint8_t *data                               = NULL;
+	static char *function                       = "libesedb_record_get_value_data_pointer";
+	size_t data_size                            = 0;
+	uint32_t data_flags                         = 0;
+	int encoding                                = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libesedb_internal_record_t *) record;
+
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_record->values_array,
+	     value_entry,
+	     (intptr_t **) &record_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d from values array.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	if( libfvalue_value_get_data_flags(
+	     record_value,
+	     &data_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d data flags.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	if( ( ( data_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) != 0 )
+	 || ( ( data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported data flags: 0x%02" PRIx32 ".",
+		 function,
+		 data_flags );
+
+		return( -1 );
+	}
+	/* The data of the record value references the values data of the record
+	 */
+	if( libfvalue_value_get_data(
+	     record_value,
+	     &data,
+	     &data_size,
+	     &encoding,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d data.",
+		 function,
+		 value_entry );
+
+		return( -1 );
+	}
+	*value_data      = (const uint8_t *) data;
+	*value_data_size = data_size;
+
+	return( 1 );
+}
+
 /* Retrieves the value data flags of the specific entry
  * Returns 1 if successful or -1 on error
  */
@@ -3133,8 +3310,7 @@ int libesedb_record_get_long_value_data_segments_list(
 	if( libesedb_data_definition_read_long_value(
 	     data_definition,
 	     internal_record->file_io_handle,
-	     internal_record->long_values_pages_vector,
-	     internal_record->long_values_pages_cache,
+	     internal_record->io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3230,8 +3406,6 @@ int libesedb_record_get_long_value_data_segments_list(
 			     data_definition,
 			     internal_record->file_io_handle,
 			     internal_record->io_handle,
-			     internal_record->long_values_pages_vector,
-			     internal_record->long_values_pages_cache,
 			     long_value_segment_offset,
 			     *data_segments_list,
 			     error ) != 1 )
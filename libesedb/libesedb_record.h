@@ -60,22 +60,6 @@ struct libesedb_internal_record
 	 */
 	libesedb_table_definition_t *template_table_definition;
 
-	/* The pages vector
-	 */
-	libfdata_vector_t *pages_vector;
-
-	/* The pages cache
-	 */
-	libfcache_cache_t *pages_cache;
-
-	/* The long values pages vector
-	 */
-	libfdata_vector_t *long_values_pages_vector;
-
-	/* The long values pages cache
-	 */
-	libfcache_cache_t *long_values_pages_cache;
-
 	/* The long values tree
 	 */
 	libfdata_btree_t *long_values_tree;
@@ -88,6 +72,14 @@ struct libesedb_internal_record
 	 */
 	libcdata_array_t *values_array;
 
+	/* The values data, a copy of the record data that is referenced by the values
+	 */
+	uint8_t *values_data;
+
+	/* The values data size
+	 */
+	size_t values_data_size;
+
 	/* The (record) flags 
 	 */
 	uint8_t flags;
@@ -99,10 +91,8 @@ int libesedb_record_initialize(
      libesedb_io_handle_t *io_handle,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
-     libfdata_vector_t *long_values_pages_vector,
-     libfcache_cache_t *long_values_pages_cache,
+     const uint8_t *column_mask,
+     int column_mask_size,
      libesedb_data_definition_t *data_definition,
      libfdata_btree_t *long_values_tree,
      libfcache_cache_t *long_values_cache,
@@ -132,6 +122,13 @@ int libesedb_record_get_column_identifier(
      uint32_t *column_identifier,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_record_get_value_entry_by_column_identifier(
+     libesedb_record_t *record,
+     uint32_t column_identifier,
+     int *value_entry,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_record_get_column_type(
      libesedb_record_t *record,
@@ -194,6 +191,14 @@ int libesedb_record_get_value_data(
      size_t value_data_size,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_record_get_value_data_pointer(
+     libesedb_record_t *record,
+     int value_entry,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_record_get_value_data_flags(
      libesedb_record_t *record,
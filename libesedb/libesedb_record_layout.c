@@ -0,0 +1,700 @@
+/*
+ * Record layout functions
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_catalog_definition.h"
+#include "libesedb_definitions.h"
+#include "libesedb_libcdata.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libfvalue.h"
+#include "libesedb_record_layout.h"
+
+#include "esedb_page_values.h"
+
+/* Creates a record layout
+ * Make sure the value record_layout is referencing, is set to NULL
+ * The column catalog definitions are referenced by the record layout
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_layout_initialize(
+     libesedb_record_layout_t **record_layout,
+     libcdata_list_t *template_table_column_catalog_definition_list,
+     libcdata_list_t *table_column_catalog_definition_list,
+     libcerror_error_t **error )
+{
+	libcdata_list_element_t *column_catalog_definition_list_element = NULL;
+	libesedb_catalog_definition_t *column_catalog_definition        = NULL;
+	static char *function                                           = "libesedb_record_layout_initialize";
+	uint32_t column_identifier                                      = 0;
+	uint32_t fixed_size_offset                                      = 0;
+	int column_entry                                                = 0;
+	int number_of_table_columns                                     = 0;
+	int result                                                      = 0;
+
+	if( record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_layout != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record layout value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_column_catalog_definition_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table column catalog definition list.",
+		 function );
+
+		return( -1 );
+	}
+	*record_layout = memory_allocate_structure(
+	                  libesedb_record_layout_t );
+
+	if( *record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record layout.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *record_layout,
+	     0,
+	     sizeof( libesedb_record_layout_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record layout.",
+		 function );
+
+		memory_free(
+		 *record_layout );
+
+		*record_layout = NULL;
+
+		return( -1 );
+	}
+	if( template_table_column_catalog_definition_list != NULL )
+	{
+		if( libcdata_list_get_number_of_elements(
+		     template_table_column_catalog_definition_list,
+		     &( ( *record_layout )->number_of_template_table_columns ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of template table columns.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcdata_list_get_number_of_elements(
+	     table_column_catalog_definition_list,
+	     &number_of_table_columns,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of table columns.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( ( *record_layout )->number_of_template_table_columns < 0 )
+	 || ( number_of_table_columns < 0 )
+	 || ( number_of_table_columns > ( ( INT_MAX / 2 ) - ( *record_layout )->number_of_template_table_columns ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of columns value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	( *record_layout )->number_of_columns = ( *record_layout )->number_of_template_table_columns + number_of_table_columns;
+
+	if( ( *record_layout )->number_of_columns == 0 )
+	{
+		return( 1 );
+	}
+	if( (size_t) ( *record_layout )->number_of_columns > ( (size_t) SSIZE_MAX / sizeof( libesedb_catalog_definition_t * ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of columns value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	( *record_layout )->column_catalog_definitions = (libesedb_catalog_definition_t **) memory_allocate(
+	                                                  sizeof( libesedb_catalog_definition_t * ) * ( *record_layout )->number_of_columns );
+
+	( *record_layout )->column_identifiers = (uint32_t *) memory_allocate(
+	                                          sizeof( uint32_t ) * ( *record_layout )->number_of_columns );
+
+	( *record_layout )->value_types = (int *) memory_allocate(
+	                                   sizeof( int ) * ( *record_layout )->number_of_columns );
+
+	( *record_layout )->encodings = (int *) memory_allocate(
+	                                 sizeof( int ) * ( *record_layout )->number_of_columns );
+
+	( *record_layout )->fixed_size_offsets = (uint32_t *) memory_allocate(
+	                                          sizeof( uint32_t ) * ( *record_layout )->number_of_columns );
+
+	( *record_layout )->fixed_size_sizes = (uint32_t *) memory_allocate(
+	                                        sizeof( uint32_t ) * ( *record_layout )->number_of_columns );
+
+	if( ( ( *record_layout )->column_catalog_definitions == NULL )
+	 || ( ( *record_layout )->column_identifiers == NULL )
+	 || ( ( *record_layout )->value_types == NULL )
+	 || ( ( *record_layout )->encodings == NULL )
+	 || ( ( *record_layout )->fixed_size_offsets == NULL )
+	 || ( ( *record_layout )->fixed_size_sizes == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record layout arrays.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( *record_layout )->number_of_template_table_columns > 0 )
+	{
+		result = libcdata_list_get_first_element(
+		          template_table_column_catalog_definition_list,
+		          &column_catalog_definition_list_element,
+		          error );
+	}
+	else
+	{
+		result = libcdata_list_get_first_element(
+		          table_column_catalog_definition_list,
+		          &column_catalog_definition_list_element,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first column catalog definition list element.",
+		 function );
+
+		goto on_error;
+	}
+	fixed_size_offset = (uint32_t) sizeof( esedb_data_definition_header_t );
+
+	for( column_entry = 0;
+	     column_entry < ( *record_layout )->number_of_columns;
+	     column_entry++ )
+	{
+		if( libcdata_list_element_get_value(
+		     column_catalog_definition_list_element,
+		     (intptr_t **) &column_catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column catalog definition from list element: %d.",
+			 function,
+			 column_entry );
+
+			goto on_error;
+		}
+		if( libesedb_record_layout_set_column(
+		     *record_layout,
+		     column_entry,
+		     column_catalog_definition,
+		     &fixed_size_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set column: %d.",
+			 function,
+			 column_entry );
+
+			goto on_error;
+		}
+		if( libcdata_list_element_get_next_element(
+		     column_catalog_definition_list_element,
+		     &column_catalog_definition_list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next column catalog definition list element.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( column_catalog_definition_list_element == NULL )
+		 && ( ( column_entry + 1 ) == ( *record_layout )->number_of_template_table_columns ) )
+		{
+			if( libcdata_list_get_first_element(
+			     table_column_catalog_definition_list,
+			     &column_catalog_definition_list_element,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve first column catalog definition list element.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	/* Build a dense lookup table of the column entries indexed by column identifier,
+	 * the column identifiers are 16-bit values in the record data
+	 */
+	for( column_entry = 0;
+	     column_entry < ( *record_layout )->number_of_columns;
+	     column_entry++ )
+	{
+		column_identifier = ( *record_layout )->column_identifiers[ column_entry ];
+
+		if( ( column_identifier <= (uint32_t) UINT16_MAX )
+		 && ( column_identifier >= ( *record_layout )->number_of_column_entries_by_identifier ) )
+		{
+			( *record_layout )->number_of_column_entries_by_identifier = column_identifier + 1;
+		}
+	}
+	if( ( *record_layout )->number_of_column_entries_by_identifier > 0 )
+	{
+		( *record_layout )->column_entries_by_identifier = (int *) memory_allocate(
+		                                                    sizeof( int ) * ( *record_layout )->number_of_column_entries_by_identifier );
+
+		if( ( *record_layout )->column_entries_by_identifier == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create column entries by identifier.",
+			 function );
+
+			goto on_error;
+		}
+		for( column_identifier = 0;
+		     column_identifier < ( *record_layout )->number_of_column_entries_by_identifier;
+		     column_identifier++ )
+		{
+			( *record_layout )->column_entries_by_identifier[ column_identifier ] = -1;
+		}
+		/* The column identifiers are unique within a table, if not the first column is used
+		 */
+		for( column_entry = 0;
+		     column_entry < ( *record_layout )->number_of_columns;
+		     column_entry++ )
+		{
+			column_identifier = ( *record_layout )->column_identifiers[ column_entry ];
+
+			if( ( column_identifier < ( *record_layout )->number_of_column_entries_by_identifier )
+			 && ( ( *record_layout )->column_entries_by_identifier[ column_identifier ] == -1 ) )
+			{
+				( *record_layout )->column_entries_by_identifier[ column_identifier ] = column_entry;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *record_layout != NULL )
+	{
+		libesedb_record_layout_free(
+		 record_layout,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a record layout
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_layout_free(
+     libesedb_record_layout_t **record_layout,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_record_layout_free";
+
+	if( record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_layout != NULL )
+	{
+		/* The column catalog definitions are referenced and freed elsewhere
+		 */
+		if( ( *record_layout )->column_catalog_definitions != NULL )
+		{
+			memory_free(
+			 ( *record_layout )->column_catalog_definitions );
+		}
+		if( ( *record_layout )->column_identifiers != NULL )
+		{
+			memory_free(
+			 ( *record_layout )->column_identifiers );
+		}
+		if( ( *record_layout )->value_types != NULL )
+		{
+			memory_free(
+			 ( *record_layout )->value_types );
+		}
+		if( ( *record_layout )->encodings != NULL )
+		{
+			memory_free(
+			 ( *record_layout )->encodings );
+		}
+		if( ( *record_layout )->fixed_size_offsets != NULL )
+		{
+			memory_free(
+			 ( *record_layout )->fixed_size_offsets );
+		}
+		if( ( *record_layout )->fixed_size_sizes != NULL )
+		{
+			memory_free(
+			 ( *record_layout )->fixed_size_sizes );
+		}
+		if( ( *record_layout )->column_entries_by_identifier != NULL )
+		{
+			memory_free(
+			 ( *record_layout )->column_entries_by_identifier );
+		}
+		memory_free(
+		 *record_layout );
+
+		*record_layout = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets a specific column of the record layout
+ * The fixed size offset is the offset of the next fixed size column and is
+ * updated when the column is a fixed size column
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_layout_set_column(
+     libesedb_record_layout_t *record_layout,
+     int column_entry,
+     libesedb_catalog_definition_t *column_catalog_definition,
+     uint32_t *fixed_size_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_record_layout_set_column";
+	int encoding          = 0;
+	int value_type        = 0;
+
+	if( record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_entry < 0 )
+	 || ( column_entry >= record_layout->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition->type != LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column catalog definition type: %" PRIu16 ".",
+		 function,
+		 column_catalog_definition->type );
+
+		return( -1 );
+	}
+	if( fixed_size_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fixed size offset.",
+		 function );
+
+		return( -1 );
+	}
+	switch( column_catalog_definition->column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_NULL:
+			/* JET_coltypNil seems to be able to contain data */
+			value_type = LIBFVALUE_VALUE_TYPE_BINARY_DATA;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			value_type = LIBFVALUE_VALUE_TYPE_BOOLEAN;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_8BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			value_type = LIBFVALUE_VALUE_TYPE_INTEGER_16BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_16BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			value_type = LIBFVALUE_VALUE_TYPE_INTEGER_32BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			value_type = LIBFVALUE_VALUE_TYPE_INTEGER_64BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			value_type = LIBFVALUE_VALUE_TYPE_FLOATING_POINT_32BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			value_type = LIBFVALUE_VALUE_TYPE_FLOATING_POINT_64BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			value_type = LIBFVALUE_VALUE_TYPE_FILETIME;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_GUID:
+			value_type = LIBFVALUE_VALUE_TYPE_GUID;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_BINARY_DATA:
+		case LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA:
+			value_type = LIBFVALUE_VALUE_TYPE_BINARY_DATA;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_TEXT:
+		case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+			value_type = LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_SUPER_LARGE_VALUE:
+/* TODO handle this value type */
+			value_type = LIBFVALUE_VALUE_TYPE_UNDEFINED;
+			break;
+
+		/* Records of a table with a column of an unsupported type cannot be read
+		 * but the table itself can
+		 */
+		default:
+			value_type = -1;
+			break;
+	}
+	if( ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
+	 || ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+	{
+		/* If the codepage is not set the ASCII codepage of the file is used
+		 * which is determined when the record is read
+		 */
+		encoding = (int) column_catalog_definition->codepage;
+
+		/* Codepage 1200 in the ESE database format is not strict UTF-16 little endian
+		 * it can be used for ASCII strings as well. This could be SCSU.
+		 */
+		if( encoding == 1200 )
+		{
+			encoding = LIBFVALUE_CODEPAGE_1200_MIXED;
+		}
+	}
+	else
+	{
+		encoding = LIBFVALUE_ENDIAN_LITTLE;
+	}
+	record_layout->column_catalog_definitions[ column_entry ] = column_catalog_definition;
+	record_layout->column_identifiers[ column_entry ]         = column_catalog_definition->identifier;
+	record_layout->value_types[ column_entry ]                = value_type;
+	record_layout->encodings[ column_entry ]                  = encoding;
+	record_layout->fixed_size_offsets[ column_entry ]         = 0;
+	record_layout->fixed_size_sizes[ column_entry ]           = 0;
+
+	if( column_catalog_definition->identifier <= 127 )
+	{
+		if( column_catalog_definition->size > (uint32_t) UINT16_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid column catalog definition size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		/* The fixed size columns are stored in order of their identifier
+		 * hence the offset is the sum of the sizes of the preceding fixed size columns
+		 */
+		record_layout->fixed_size_offsets[ column_entry ] = *fixed_size_offset;
+		record_layout->fixed_size_sizes[ column_entry ]   = column_catalog_definition->size;
+
+		*fixed_size_offset += column_catalog_definition->size;
+	}
+	return( 1 );
+}
+
+/* Retrieves the column entry of a specific column identifier
+ * Returns 1 if successful, 0 if no such column or -1 on error
+ */
+int libesedb_record_layout_get_column_entry_by_identifier(
+     libesedb_record_layout_t *record_layout,
+     uint32_t column_identifier,
+     int *column_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_record_layout_get_column_entry_by_identifier";
+	int entry_index       = 0;
+
+	if( record_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_identifier < record_layout->number_of_column_entries_by_identifier )
+	{
+		if( record_layout->column_entries_by_identifier[ column_identifier ] == -1 )
+		{
+			return( 0 );
+		}
+		*column_entry = record_layout->column_entries_by_identifier[ column_identifier ];
+
+		return( 1 );
+	}
+	/* Column identifiers that do not fit in the lookup table are searched for
+	 */
+	for( entry_index = 0;
+	     entry_index < record_layout->number_of_columns;
+	     entry_index++ )
+	{
+		if( record_layout->column_identifiers[ entry_index ] == column_identifier )
+		{
+			*column_entry = entry_index;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
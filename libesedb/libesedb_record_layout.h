@@ -0,0 +1,110 @@
+/*
+ * Record layout functions
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_RECORD_LAYOUT_H )
+#define _LIBESEDB_RECORD_LAYOUT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_catalog_definition.h"
+#include "libesedb_libcdata.h"
+#include "libesedb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_record_layout libesedb_record_layout_t;
+
+struct libesedb_record_layout
+{
+	/* The number of columns
+	 */
+	int number_of_columns;
+
+	/* The number of template table columns
+	 */
+	int number_of_template_table_columns;
+
+	/* The column catalog definitions, in the order of the values of a record
+	 * the columns of the template table precede those of the table
+	 */
+	libesedb_catalog_definition_t **column_catalog_definitions;
+
+	/* The column identifiers
+	 */
+	uint32_t *column_identifiers;
+
+	/* The value types or -1 if the column type is not supported
+	 */
+	int *value_types;
+
+	/* The value encodings or 0 if the ASCII codepage of the file is used
+	 */
+	int *encodings;
+
+	/* The offsets of the fixed size columns relative to the start of the record data
+	 */
+	uint32_t *fixed_size_offsets;
+
+	/* The sizes of the fixed size columns
+	 */
+	uint32_t *fixed_size_sizes;
+
+	/* The column entries indexed by column identifier or -1 if there is no such column
+	 */
+	int *column_entries_by_identifier;
+
+	/* The number of column entries indexed by column identifier
+	 */
+	uint32_t number_of_column_entries_by_identifier;
+};
+
+int libesedb_record_layout_initialize(
+     libesedb_record_layout_t **record_layout,
+     libcdata_list_t *template_table_column_catalog_definition_list,
+     libcdata_list_t *table_column_catalog_definition_list,
+     libcerror_error_t **error );
+
+int libesedb_record_layout_free(
+     libesedb_record_layout_t **record_layout,
+     libcerror_error_t **error );
+
+int libesedb_record_layout_set_column(
+     libesedb_record_layout_t *record_layout,
+     int column_entry,
+     libesedb_catalog_definition_t *column_catalog_definition,
+     uint32_t *fixed_size_offset,
+     libcerror_error_t **error );
+
+int libesedb_record_layout_get_column_entry_by_identifier(
+     libesedb_record_layout_t *record_layout,
+     uint32_t column_identifier,
+     int *column_entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_RECORD_LAYOUT_H ) */
+
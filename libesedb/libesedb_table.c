@@ -33,8 +33,10 @@
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_page.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_record.h"
+#include "libesedb_record_layout.h"
 #include "libesedb_table.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
@@ -56,7 +58,7 @@ int libesedb_table_initialize(
 	libesedb_page_tree_t *table_page_tree       = NULL;
 	static char *function                       = "libesedb_table_initialize";
 	off64_t node_data_offset                    = 0;
-	int segment_index                           = 0;
+	int maximum_number_of_cache_entries         = 0;
 
 	if( table == NULL )
 	{
@@ -144,56 +146,16 @@ int libesedb_table_initialize(
 
 		return( -1 );
 	}
-	/* TODO add clone function ?
-	 */
-	if( libfdata_vector_initialize(
-	     &( internal_table->pages_vector ),
-	     (size64_t) io_handle->page_size,
-	     (intptr_t *) io_handle,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfcache_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create pages vector.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfdata_vector_append_segment(
-	     internal_table->pages_vector,
-	     &segment_index,
-	     0,
-	     io_handle->pages_data_offset,
-	     io_handle->pages_data_size,
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append segment to pages vector.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfcache_cache_initialize(
-	     &( internal_table->pages_cache ),
-	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
+	if( libesedb_table_definition_build_record_layout(
+	     table_definition,
+	     template_table_definition,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create pages cache.",
+		 "%s: unable to build record layout.",
 		 function );
 
 		goto on_error;
@@ -201,8 +163,6 @@ int libesedb_table_initialize(
 	if( libesedb_page_tree_initialize(
 	     &table_page_tree,
 	     io_handle,
-	     internal_table->pages_vector,
-	     internal_table->pages_cache,
 	     table_definition->table_catalog_definition->identifier,
 	     table_definition,
 	     template_table_definition,
@@ -242,9 +202,27 @@ int libesedb_table_initialize(
 
 		goto on_error;
 	}
+	internal_table->table_page_tree = table_page_tree;
+
+	if( libesedb_io_handle_get_maximum_number_of_cache_entries(
+	     io_handle,
+	     LIBESEDB_CACHE_TYPE_VALUES,
+	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_TABLE_VALUES,
+	     &maximum_number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum number of table values cache entries.",
+		 function );
+
+		goto on_error;
+	}
 	if( libfcache_cache_initialize(
 	     &( internal_table->table_values_cache ),
-	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_TABLE_VALUES,
+	     maximum_number_of_cache_entries,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -278,65 +256,9 @@ int libesedb_table_initialize(
 	}
 	if( table_definition->long_value_catalog_definition != NULL )
 	{
-		/* TODO add clone function ?
-		 */
-		if( libfdata_vector_initialize(
-		     &( internal_table->long_values_pages_vector ),
-		     (size64_t) io_handle->page_size,
-		     (intptr_t *) io_handle,
-		     NULL,
-		     NULL,
-		     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfcache_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
-		     NULL,
-		     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create long values pages vector.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfdata_vector_append_segment(
-		     internal_table->long_values_pages_vector,
-		     &segment_index,
-		     0,
-		     io_handle->pages_data_offset,
-		     io_handle->pages_data_size,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append segment to long values pages vector.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfcache_cache_initialize(
-		     &( internal_table->long_values_pages_cache ),
-		     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create long values pages cache.",
-			 function );
-
-			goto on_error;
-		}
 		if( libesedb_page_tree_initialize(
 		     &long_values_page_tree,
 		     io_handle,
-		     internal_table->long_values_pages_vector,
-		     internal_table->long_values_pages_cache,
 		     table_definition->long_value_catalog_definition->identifier,
 		     table_definition,
 		     template_table_definition,
@@ -376,9 +298,25 @@ int libesedb_table_initialize(
 
 			goto on_error;
 		}
+		if( libesedb_io_handle_get_maximum_number_of_cache_entries(
+		     io_handle,
+		     LIBESEDB_CACHE_TYPE_LONG_VALUES,
+		     LIBESEDB_MAXIMUM_CACHE_ENTRIES_LONG_VALUES,
+		     &maximum_number_of_cache_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve maximum number of long values cache entries.",
+			 function );
+
+			goto on_error;
+		}
 		if( libfcache_cache_initialize(
 		     &( internal_table->long_values_cache ),
-		     LIBESEDB_MAXIMUM_CACHE_ENTRIES_LONG_VALUES,
+		     maximum_number_of_cache_entries,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -435,18 +373,6 @@ on_error:
 			 &( internal_table->long_values_tree ),
 			 NULL );
 		}
-		if( internal_table->long_values_pages_cache != NULL )
-		{
-			libfcache_cache_free(
-			 &( internal_table->long_values_pages_cache ),
-			 NULL );
-		}
-		if( internal_table->long_values_pages_vector != NULL )
-		{
-			libfdata_vector_free(
-			 &( internal_table->long_values_pages_vector ),
-			 NULL );
-		}
 		if( internal_table->table_values_cache != NULL )
 		{
 			libfcache_cache_free(
@@ -459,18 +385,6 @@ on_error:
 			 &( internal_table->table_values_tree ),
 			 NULL );
 		}
-		if( internal_table->pages_cache != NULL )
-		{
-			libfcache_cache_free(
-			 &( internal_table->pages_cache ),
-			 NULL );
-		}
-		if( internal_table->pages_vector != NULL )
-		{
-			libfdata_vector_free(
-			 &( internal_table->pages_vector ),
-			 NULL );
-		}
 		memory_free(
 		 internal_table );
 	}
@@ -507,64 +421,6 @@ int libesedb_table_free(
 		/* The io_handle, file_io_handle and table_definition references
 		 * are freed elsewhere
 		 */
-		if( libfdata_vector_free(
-		     &( internal_table->pages_vector ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free pages vector.",
-			 function );
-
-			result = -1;
-		}
-		if( libfcache_cache_free(
-		     &( internal_table->pages_cache ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free pages cache.",
-			 function );
-
-			result = -1;
-		}
-		if( internal_table->long_values_pages_vector != NULL )
-		{
-			if( libfdata_vector_free(
-			     &( internal_table->long_values_pages_vector ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free long values pages vector.",
-				 function );
-
-				result = -1;
-			}
-		}
-		if( internal_table->long_values_pages_cache != NULL )
-		{
-			if( libfcache_cache_free(
-			     &( internal_table->long_values_pages_cache ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free long values pages cache.",
-				 function );
-
-				result = -1;
-			}
-		}
 		if( libfdata_btree_free(
 		     &( internal_table->table_values_tree ),
 		     error ) != 1 )
@@ -623,6 +479,11 @@ int libesedb_table_free(
 				result = -1;
 			}
 		}
+		if( internal_table->column_mask != NULL )
+		{
+			memory_free(
+			 internal_table->column_mask );
+		}
 		memory_free(
 		 internal_table );
 	}
@@ -1492,16 +1353,24 @@ int libesedb_table_get_column(
 	return( 1 );
 }
 
-/* Retrieves the number of indexes
+/* Sets the column projection
+ * Records retrieved from the table only read the values of the columns with the column identifiers
+ * A NULL column identifiers or 0 number of column identifiers clears the column projection
  * Returns 1 if successful or -1 on error
  */
-int libesedb_table_get_number_of_indexes(
+int libesedb_table_set_column_projection(
      libesedb_table_t *table,
-     int *number_of_indexes,
+     const uint32_t *column_identifiers,
+     int number_of_column_identifiers,
      libcerror_error_t **error )
 {
 	libesedb_internal_table_t *internal_table = NULL;
-	static char *function                     = "libesedb_table_get_number_of_indexes";
+	uint8_t *column_mask                      = NULL;
+	static char *function                     = "libesedb_table_set_column_projection";
+	int column_entry                          = 0;
+	int column_identifier_index               = 0;
+	int number_of_columns                     = 0;
+	int result                                = 0;
 
 	if( table == NULL )
 	{
@@ -1527,136 +1396,313 @@ int libesedb_table_get_number_of_indexes(
 
 		return( -1 );
 	}
-	if( libcdata_list_get_number_of_elements(
-	     internal_table->table_definition->index_catalog_definition_list,
-	     number_of_indexes,
-	     error ) != 1 )
+	if( internal_table->table_definition->record_layout == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of indexes.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - invalid table definition - missing record layout.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves a specific index
- * Returns 1 if successful or -1 on error
- */
-int libesedb_table_get_index(
-     libesedb_table_t *table,
-     int index_entry,
-     libesedb_index_t **index,
-     libcerror_error_t **error )
-{
-	libesedb_internal_table_t *internal_table               = NULL;
-	libesedb_catalog_definition_t *index_catalog_definition = NULL;
-	static char *function                                   = "libesedb_table_get_index";
-
-	if( table == NULL )
+	if( number_of_column_identifiers < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid table.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of column identifiers value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	internal_table = (libesedb_internal_table_t *) table;
-
-	if( internal_table->table_definition == NULL )
+	if( ( column_identifiers == NULL )
+	 || ( number_of_column_identifiers == 0 ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid table - missing table definition.",
-		 function );
+		if( internal_table->column_mask != NULL )
+		{
+			memory_free(
+			 internal_table->column_mask );
 
-		return( -1 );
+			internal_table->column_mask = NULL;
+		}
+		internal_table->column_mask_size = 0;
+
+		return( 1 );
 	}
-	if( internal_table->table_definition->index_catalog_definition_list == NULL )
+	number_of_columns = internal_table->table_definition->record_layout->number_of_columns;
+
+	if( ( number_of_columns <= 0 )
+	 || ( (size_t) number_of_columns > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid table - invalid table definition - missing index catalog definition list.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of columns value out of bounds.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( index == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid index.",
-		 function );
+	column_mask = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * number_of_columns );
 
-		return( -1 );
-	}
-	if( *index != NULL )
+	if( column_mask == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid index value already set.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create column mask.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libcdata_list_get_value_by_index(
-	     internal_table->table_definition->index_catalog_definition_list,
-	     index_entry,
-	     (intptr_t **) &index_catalog_definition,
-	     error ) != 1 )
+	if( memory_set(
+	     column_mask,
+	     0,
+	     sizeof( uint8_t ) * number_of_columns ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve index catalog definition.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear column mask.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libesedb_index_initialize(
-	     index,
-	     internal_table->file_io_handle,
-	     internal_table->io_handle,
-	     internal_table->table_definition,
-	     internal_table->template_table_definition,
-	     index_catalog_definition,
-	     internal_table->pages_vector,
-	     internal_table->pages_cache,
-	     internal_table->long_values_pages_vector,
-	     internal_table->long_values_pages_cache,
-	     internal_table->table_values_tree,
-	     internal_table->table_values_cache,
-	     internal_table->long_values_tree,
-	     internal_table->long_values_cache,
-	     error ) != 1 )
+	for( column_identifier_index = 0;
+	     column_identifier_index < number_of_column_identifiers;
+	     column_identifier_index++ )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create index.",
-		 function );
+		result = libesedb_record_layout_get_column_entry_by_identifier(
+		          internal_table->table_definition->record_layout,
+		          column_identifiers[ column_identifier_index ],
+		          &column_entry,
+		          error );
 
-		return( -1 );
-	}
-	return( 1 );
-}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve column entry of column identifier: %" PRIu32 ".",
+			 function,
+			 column_identifiers[ column_identifier_index ] );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported column identifier: %" PRIu32 " - no such column.",
+			 function,
+			 column_identifiers[ column_identifier_index ] );
+
+			goto on_error;
+		}
+		if( ( column_entry < 0 )
+		 || ( column_entry >= number_of_columns ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid column entry value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		column_mask[ column_entry ] = 1;
+	}
+	if( internal_table->column_mask != NULL )
+	{
+		memory_free(
+		 internal_table->column_mask );
+	}
+	internal_table->column_mask      = column_mask;
+	internal_table->column_mask_size = number_of_columns;
+
+	return( 1 );
+
+on_error:
+	if( column_mask != NULL )
+	{
+		memory_free(
+		 column_mask );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of indexes
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_number_of_indexes(
+     libesedb_table_t *table,
+     int *number_of_indexes,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_get_number_of_indexes";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( internal_table->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_list_get_number_of_elements(
+	     internal_table->table_definition->index_catalog_definition_list,
+	     number_of_indexes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of indexes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific index
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_index(
+     libesedb_table_t *table,
+     int index_entry,
+     libesedb_index_t **index,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table               = NULL;
+	libesedb_catalog_definition_t *index_catalog_definition = NULL;
+	static char *function                                   = "libesedb_table_get_index";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( internal_table->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->table_definition->index_catalog_definition_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - invalid table definition - missing index catalog definition list.",
+		 function );
+
+		return( -1 );
+	}
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_list_get_value_by_index(
+	     internal_table->table_definition->index_catalog_definition_list,
+	     index_entry,
+	     (intptr_t **) &index_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_index_initialize(
+	     index,
+	     internal_table->file_io_handle,
+	     internal_table->io_handle,
+	     internal_table->table_definition,
+	     internal_table->template_table_definition,
+	     index_catalog_definition,
+	     internal_table->table_page_tree,
+	     internal_table->table_values_tree,
+	     internal_table->table_values_cache,
+	     internal_table->long_values_tree,
+	     internal_table->long_values_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
 
 /* Retrieves the number of records in the table
  * Returns 1 if successful or -1 on error
@@ -1702,7 +1748,79 @@ int libesedb_table_get_number_of_records(
 	return( 1 );
 }
 
+/* Counts the number of records in the table
+ * The records are counted from the page tags of the leaf pages, without creating
+ * a data definition for every record. If LIBESEDB_COUNT_FLAG_ESTIMATE is set the number
+ * of records is estimated from the number of leaf pages and a sample of the leaf pages
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_count_records(
+     libesedb_table_t *table,
+     uint8_t flags,
+     uint64_t *number_of_records,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_count_records";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( internal_table->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->table_definition->table_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - invalid table definition - missing table catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_count_leaf_values(
+	     internal_table->table_page_tree,
+	     internal_table->file_io_handle,
+	     internal_table->table_definition->table_catalog_definition->father_data_page_number,
+	     flags,
+	     number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to count leaf values in table page tree.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves a specific record
+ * When the records are retrieved in sequence the leaf pages that follow are read-ahead
+ * into the pages cache, the read-ahead is synchronous and done by the calling thread
  * Returns 1 if successful or -1 on error
  */
 int libesedb_table_get_record(
@@ -1775,10 +1893,8 @@ int libesedb_table_get_record(
 	     internal_table->io_handle,
 	     internal_table->table_definition,
 	     internal_table->template_table_definition,
-	     internal_table->pages_vector,
-	     internal_table->pages_cache,
-	     internal_table->long_values_pages_vector,
-	     internal_table->long_values_pages_cache,
+	     internal_table->column_mask,
+	     internal_table->column_mask_size,
 	     record_data_definition,
 	     internal_table->long_values_tree,
 	     internal_table->long_values_cache,
@@ -1796,3 +1912,425 @@ int libesedb_table_get_record(
 	return( 1 );
 }
 
+/* Retrieves the record for a specific key
+ * The key data contains the primary key of the record in the (normalized) form
+ * it is stored in the table page tree
+ * The record is looked up by descending the table page tree from the root page
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libesedb_table_get_record_by_key(
+     libesedb_table_t *table,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *record_data_definition = NULL;
+	libesedb_internal_table_t *internal_table          = NULL;
+	libesedb_page_t *page                              = NULL;
+	static char *function                              = "libesedb_table_get_record_by_key";
+	off64_t page_offset                                = 0;
+	uint32_t leaf_page_number                          = 0;
+	uint16_t data_offset                               = 0;
+	uint16_t data_size                                 = 0;
+	uint16_t leaf_value_index                          = 0;
+	uint8_t is_exact_match                             = 0;
+	int result                                         = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( internal_table->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->table_definition->table_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - invalid table definition - missing table catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_page_tree_seek_leaf_value(
+	          internal_table->table_page_tree,
+	          internal_table->file_io_handle,
+	          internal_table->table_definition->table_catalog_definition->father_data_page_number,
+	          key_data,
+	          key_data_size,
+	          &leaf_page_number,
+	          &leaf_value_index,
+	          &is_exact_match,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to seek leaf value in table page tree.",
+		 function );
+
+		goto on_error;
+	}
+	else if( ( result == 0 )
+	      || ( is_exact_match == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libesedb_page_tree_get_page(
+	     internal_table->table_page_tree,
+	     internal_table->file_io_handle,
+	     leaf_page_number,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 ".",
+		 function,
+		 leaf_page_number );
+
+		goto on_error;
+	}
+	if( libesedb_page_get_value_data_range(
+	     page,
+	     leaf_value_index,
+	     NULL,
+	     &data_offset,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 " value: %" PRIu16 " data range.",
+		 function,
+		 leaf_page_number,
+		 leaf_value_index );
+
+		goto on_error;
+	}
+	if( libesedb_page_release(
+	     internal_table->io_handle,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_data_definition_initialize(
+	     &record_data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record data definition.",
+		 function );
+
+		goto on_error;
+	}
+	page_offset  = leaf_page_number - 1;
+	page_offset *= internal_table->io_handle->page_size;
+
+	record_data_definition->page_offset      = page_offset;
+	record_data_definition->page_number      = leaf_page_number;
+	record_data_definition->page_value_index = leaf_value_index;
+	record_data_definition->data_offset      = data_offset;
+	record_data_definition->data_size        = data_size;
+
+	if( libesedb_record_initialize(
+	     record,
+	     internal_table->file_io_handle,
+	     internal_table->io_handle,
+	     internal_table->table_definition,
+	     internal_table->template_table_definition,
+	     internal_table->column_mask,
+	     internal_table->column_mask_size,
+	     record_data_definition,
+	     internal_table->long_values_tree,
+	     internal_table->long_values_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_data_definition_free(
+	     &record_data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record data definition.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 internal_table->io_handle,
+		 &page,
+		 NULL );
+	}
+	if( *record != NULL )
+	{
+		libesedb_record_free(
+		 record,
+		 NULL );
+	}
+	if( record_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &record_data_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the partitions of the table
+ * The first leaf page number of every partition is stored in partition page numbers,
+ * which should contain maximum number of partitions entries
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_partitions(
+     libesedb_table_t *table,
+     int maximum_number_of_partitions,
+     uint32_t *partition_page_numbers,
+     int *number_of_partitions,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_get_partitions";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( internal_table->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->table_definition->table_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - invalid table definition - missing table catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_get_partition_leaf_page_numbers(
+	     internal_table->table_page_tree,
+	     internal_table->file_io_handle,
+	     internal_table->table_definition->table_catalog_definition->father_data_page_number,
+	     maximum_number_of_partitions,
+	     partition_page_numbers,
+	     number_of_partitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition leaf page numbers.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the cache usage
+ * The usage is the (estimated) size in bytes of the values in the table values
+ * and long values caches, the pages cache is shared with the file
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_cache_usage(
+     libesedb_table_t *table,
+     size64_t *values_cache_size,
+     size64_t *long_values_cache_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_get_cache_usage";
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( long_values_cache_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long values cache size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_io_handle_get_cache_size(
+	     internal_table->io_handle,
+	     LIBESEDB_CACHE_TYPE_VALUES,
+	     internal_table->table_values_cache,
+	     values_cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve table values cache size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->long_values_cache == NULL )
+	{
+		*long_values_cache_size = 0;
+	}
+	else if( libesedb_io_handle_get_cache_size(
+	          internal_table->io_handle,
+	          LIBESEDB_CACHE_TYPE_LONG_VALUES,
+	          internal_table->long_values_cache,
+	          long_values_cache_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve long values cache size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
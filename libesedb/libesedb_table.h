@@ -31,6 +31,7 @@
 #include "libesedb_libcerror.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_page_tree.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
 
@@ -58,21 +59,9 @@ struct libesedb_internal_table
 	 */
 	libesedb_table_definition_t *template_table_definition;
 
-	/* The pages vector
+	/* The table page tree, owned by the table values tree
 	 */
-	libfdata_vector_t *pages_vector;
-
-	/* The pages cache
-	 */
-	libfcache_cache_t *pages_cache;
-
-	/* The long values pages vector
-	 */
-	libfdata_vector_t *long_values_pages_vector;
-
-	/* The long values pages cache
-	 */
-	libfcache_cache_t *long_values_pages_cache;
+	libesedb_page_tree_t *table_page_tree;
 
 	/* The table values tree
 	 */
@@ -89,6 +78,15 @@ struct libesedb_internal_table
 	/* The long values cache
 	 */
 	libfcache_cache_t *long_values_cache;
+
+	/* The column mask of the column projection, contains an entry per column
+	 * that is non-zero if the column is projected, or NULL if all the columns are read
+	 */
+	uint8_t *column_mask;
+
+	/* The column mask size
+	 */
+	int column_mask_size;
 };
 
 int libesedb_table_initialize(
@@ -177,6 +175,13 @@ int libesedb_table_get_column(
      uint8_t flags,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_table_set_column_projection(
+     libesedb_table_t *table,
+     const uint32_t *column_identifiers,
+     int number_of_column_identifiers,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_table_get_number_of_indexes(
      libesedb_table_t *table,
@@ -196,6 +201,13 @@ int libesedb_table_get_number_of_records(
      int *number_of_records,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_table_count_records(
+     libesedb_table_t *table,
+     uint8_t flags,
+     uint64_t *number_of_records,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_table_get_record(
      libesedb_table_t *table,
@@ -203,6 +215,29 @@ int libesedb_table_get_record(
      libesedb_record_t **record,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_table_get_record_by_key(
+     libesedb_table_t *table,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_partitions(
+     libesedb_table_t *table,
+     int maximum_number_of_partitions,
+     uint32_t *partition_page_numbers,
+     int *number_of_partitions,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_cache_usage(
+     libesedb_table_t *table,
+     size64_t *values_cache_size,
+     size64_t *long_values_cache_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,1234 @@
+/*
+ * Table cursor functions
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_data_definition.h"
+#include "libesedb_definitions.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_page.h"
+#include "libesedb_page_tree.h"
+#include "libesedb_record.h"
+#include "libesedb_table.h"
+#include "libesedb_table_cursor.h"
+#include "libesedb_types.h"
+
+/* Opens a table cursor
+ * The cursor is positioned before the first record of the table
+ * The cursor references the table and should be closed before the table is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_cursor_open(
+     libesedb_table_t *table,
+     libesedb_table_cursor_t **cursor,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table         = NULL;
+	libesedb_internal_table_cursor_t *internal_cursor = NULL;
+	static char *function                             = "libesedb_table_cursor_open";
+	uint32_t leaf_page_number                         = 0;
+	int result                                        = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( internal_table->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->table_definition->table_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table - invalid table definition - missing table catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = memory_allocate_structure(
+	                   libesedb_internal_table_cursor_t );
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_cursor,
+	     0,
+	     sizeof( libesedb_internal_table_cursor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cursor.",
+		 function );
+
+		memory_free(
+		 internal_cursor );
+
+		return( -1 );
+	}
+	internal_cursor->internal_table = internal_table;
+
+	if( libesedb_data_definition_initialize(
+	     &( internal_cursor->data_definition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data definition.",
+		 function );
+
+		goto on_error;
+	}
+	result = libesedb_page_tree_get_first_leaf_page_number(
+	          internal_table->table_page_tree,
+	          internal_table->file_io_handle,
+	          internal_table->table_definition->table_catalog_definition->father_data_page_number,
+	          &leaf_page_number,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first leaf page number.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libesedb_table_cursor_set_page(
+		     internal_cursor,
+		     leaf_page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set leaf page: %" PRIu32 ".",
+			 function,
+			 leaf_page_number );
+
+			goto on_error;
+		}
+	}
+	*cursor = (libesedb_table_cursor_t *) internal_cursor;
+
+	return( 1 );
+
+on_error:
+	if( internal_cursor != NULL )
+	{
+		if( internal_cursor->data_definition != NULL )
+		{
+			libesedb_data_definition_free(
+			 &( internal_cursor->data_definition ),
+			 NULL );
+		}
+		memory_free(
+		 internal_cursor );
+	}
+	return( -1 );
+}
+
+/* Opens a table cursor for a specific partition
+ * The cursor is positioned before the first record of the partition and stops
+ * at the first leaf page of the next partition
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_partition_cursor_open(
+     libesedb_table_t *table,
+     const uint32_t *partition_page_numbers,
+     int number_of_partitions,
+     int partition_index,
+     libesedb_table_cursor_t **cursor,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_cursor_t *internal_cursor = NULL;
+	static char *function                             = "libesedb_table_partition_cursor_open";
+	uint32_t end_page_number                          = 0;
+	uint32_t first_page_number                        = 0;
+
+	if( partition_page_numbers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition page numbers.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( partition_index < 0 )
+	 || ( partition_index >= number_of_partitions ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid partition index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	first_page_number = partition_page_numbers[ partition_index ];
+
+	if( first_page_number == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid partition: %d page number value out of bounds.",
+		 function,
+		 partition_index );
+
+		return( -1 );
+	}
+	if( ( partition_index + 1 ) < number_of_partitions )
+	{
+		end_page_number = partition_page_numbers[ partition_index + 1 ];
+	}
+	if( libesedb_table_cursor_open(
+	     table,
+	     cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to open cursor.",
+		 function );
+
+		goto on_error;
+	}
+	internal_cursor = (libesedb_internal_table_cursor_t *) *cursor;
+
+	internal_cursor->page_number           = 0;
+	internal_cursor->next_page_number      = 0;
+	internal_cursor->number_of_page_values = 0;
+	internal_cursor->page_value_index      = 0;
+	internal_cursor->number_of_pages       = 0;
+
+	if( libesedb_table_cursor_set_page(
+	     internal_cursor,
+	     first_page_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set leaf page: %" PRIu32 ".",
+		 function,
+		 first_page_number );
+
+		goto on_error;
+	}
+	internal_cursor->end_page_number = end_page_number;
+
+	return( 1 );
+
+on_error:
+	if( ( cursor != NULL )
+	 && ( *cursor != NULL ) )
+	{
+		libesedb_table_cursor_close(
+		 cursor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens a table cursor that visits the leaf pages of the table in physical order
+ * The leaf pages are determined from the owned extents in the space tree of the table,
+ * without the available extents, and are visited in ascending page number hence the
+ * records are not returned in key order. If the table has no (supported) space tree
+ * the cursor falls back to visiting the leaf pages in key order
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_physical_cursor_open(
+     libesedb_table_t *table,
+     libesedb_table_cursor_t **cursor,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_cursor_t *internal_cursor = NULL;
+	libesedb_internal_table_t *internal_table         = NULL;
+	uint32_t *extents                                 = NULL;
+	static char *function                             = "libesedb_table_physical_cursor_open";
+	int number_of_extents                             = 0;
+	int result                                        = 0;
+
+	if( libesedb_table_cursor_open(
+	     table,
+	     cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to open cursor.",
+		 function );
+
+		goto on_error;
+	}
+	internal_cursor = (libesedb_internal_table_cursor_t *) *cursor;
+	internal_table  = internal_cursor->internal_table;
+
+	result = libesedb_page_tree_get_owned_page_extents(
+	          internal_table->table_page_tree,
+	          internal_table->file_io_handle,
+	          internal_table->table_definition->table_catalog_definition->father_data_page_number,
+	          &extents,
+	          &number_of_extents,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve owned page extents.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	internal_cursor->page_number            = 0;
+	internal_cursor->next_page_number       = 0;
+	internal_cursor->number_of_page_values  = 0;
+	internal_cursor->page_value_index       = 0;
+	internal_cursor->number_of_pages        = 0;
+	internal_cursor->extents                = extents;
+	internal_cursor->number_of_extents      = number_of_extents;
+	internal_cursor->extent_index           = 0;
+	internal_cursor->extent_page_number     = 0;
+	internal_cursor->read_ahead_page_number = 0;
+
+	extents = NULL;
+
+	if( libesedb_table_cursor_set_next_physical_page(
+	     internal_cursor,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set first physical leaf page.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( extents != NULL )
+	{
+		memory_free(
+		 extents );
+	}
+	if( ( cursor != NULL )
+	 && ( *cursor != NULL ) )
+	{
+		libesedb_table_cursor_close(
+		 cursor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes a table cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_cursor_close(
+     libesedb_table_cursor_t **cursor,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_cursor_t *internal_cursor = NULL;
+	static char *function                             = "libesedb_table_cursor_close";
+	int result                                        = 1;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cursor != NULL )
+	{
+		internal_cursor = (libesedb_internal_table_cursor_t *) *cursor;
+		*cursor         = NULL;
+
+		/* The internal_table reference is freed elsewhere
+		 */
+		if( libesedb_data_definition_free(
+		     &( internal_cursor->data_definition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data definition.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_cursor->extents != NULL )
+		{
+			memory_free(
+			 internal_cursor->extents );
+		}
+		memory_free(
+		 internal_cursor );
+	}
+	return( result );
+}
+
+/* Positions the cursor at the start of a specific leaf page
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_cursor_set_page(
+     libesedb_internal_table_cursor_t *internal_cursor,
+     uint32_t page_number,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page = NULL;
+	static char *function = "libesedb_table_cursor_set_page";
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->internal_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - missing table.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->internal_table->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - invalid table - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->number_of_pages >= internal_cursor->internal_table->io_handle->last_page_number )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: number of leaf pages exceeds number of pages in file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_get_page(
+	     internal_cursor->internal_table->table_page_tree,
+	     internal_cursor->internal_table->file_io_handle,
+	     page_number,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		return( -1 );
+	}
+	internal_cursor->page_number           = page_number;
+	internal_cursor->next_page_number      = 0;
+	internal_cursor->number_of_page_values = 0;
+	internal_cursor->page_value_index      = 1;
+
+	internal_cursor->number_of_pages += 1;
+
+	if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
+	{
+		if( libesedb_page_release(
+		     internal_cursor->internal_table->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	if( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported page: %" PRIu32 " - not a leaf page.",
+		 function,
+		 page_number );
+
+		goto on_error;
+	}
+	if( libesedb_page_get_number_of_values(
+	     page,
+	     &( internal_cursor->number_of_page_values ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of page values.",
+		 function );
+
+		goto on_error;
+	}
+	internal_cursor->next_page_number = page->next_page_number;
+
+	if( libesedb_page_release(
+	     internal_cursor->internal_table->io_handle,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 internal_cursor->internal_table->io_handle,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Positions the cursor at the start of the next leaf page of the table in physical order
+ * Pages in the extents that are not leaf pages of the table, such as the parent pages
+ * and the space tree pages, are skipped. Pages that are not memory mapped are read
+ * ahead per extent, up to LIBESEDB_READ_AHEAD_MAXIMUM_NUMBER_OF_PAGES at a time
+ * Returns 1 if successful, 0 if no more leaf pages are available or -1 on error
+ */
+int libesedb_table_cursor_set_next_physical_page(
+     libesedb_internal_table_cursor_t *internal_cursor,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	libesedb_page_t *page                     = NULL;
+	static char *function                     = "libesedb_table_cursor_set_next_physical_page";
+	uint32_t extent_first_page_number         = 0;
+	uint32_t extent_last_page_number          = 0;
+	uint32_t number_of_pages                  = 0;
+	uint32_t page_number                      = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->internal_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - missing table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = internal_cursor->internal_table;
+
+	if( internal_table->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - invalid table - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->table_page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - invalid table - missing table page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - missing extents.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor->page_number           = 0;
+	internal_cursor->next_page_number      = 0;
+	internal_cursor->number_of_page_values = 0;
+	internal_cursor->page_value_index      = 0;
+
+	while( internal_cursor->extent_index < internal_cursor->number_of_extents )
+	{
+		extent_first_page_number = internal_cursor->extents[ internal_cursor->extent_index * 2 ];
+		number_of_pages          = internal_cursor->extents[ ( internal_cursor->extent_index * 2 ) + 1 ];
+		extent_last_page_number  = extent_first_page_number + number_of_pages - 1;
+
+		if( extent_last_page_number > internal_table->io_handle->last_page_number )
+		{
+			extent_last_page_number = internal_table->io_handle->last_page_number;
+		}
+		if( internal_cursor->extent_page_number < extent_first_page_number )
+		{
+			internal_cursor->extent_page_number = extent_first_page_number;
+		}
+		if( ( number_of_pages == 0 )
+		 || ( internal_cursor->extent_page_number > extent_last_page_number ) )
+		{
+			internal_cursor->extent_index      += 1;
+			internal_cursor->extent_page_number = 0;
+
+			continue;
+		}
+		page_number = internal_cursor->extent_page_number;
+
+		internal_cursor->extent_page_number += 1;
+
+		if( ( internal_table->io_handle->mapped_data == NULL )
+		 && ( page_number > internal_cursor->read_ahead_page_number ) )
+		{
+			number_of_pages = extent_last_page_number - page_number + 1;
+
+			if( number_of_pages > LIBESEDB_READ_AHEAD_MAXIMUM_NUMBER_OF_PAGES )
+			{
+				number_of_pages = LIBESEDB_READ_AHEAD_MAXIMUM_NUMBER_OF_PAGES;
+			}
+			if( number_of_pages > 1 )
+			{
+				if( libesedb_io_handle_read_pages(
+				     internal_table->io_handle,
+				     internal_table->file_io_handle,
+				     page_number,
+				     number_of_pages,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read %" PRIu32 " pages from page: %" PRIu32 ".",
+					 function,
+					 number_of_pages,
+					 page_number );
+
+					return( -1 );
+				}
+			}
+			internal_cursor->read_ahead_page_number = page_number + number_of_pages - 1;
+		}
+		if( libesedb_page_tree_get_page(
+		     internal_table->table_page_tree,
+		     internal_table->file_io_handle,
+		     page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		if( ( page->father_data_page_object_identifier != internal_table->table_page_tree->object_identifier )
+		 || ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) == 0 )
+		 || ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_EMPTY ) != 0 )
+		 || ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_SPACE_TREE ) != 0 )
+		 || ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_INDEX ) != 0 )
+		 || ( ( page->flags & LIBESEDB_PAGE_FLAG_IS_LONG_VALUE ) != 0 ) )
+		{
+			if( libesedb_page_release(
+			     internal_table->io_handle,
+			     &page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release page.",
+				 function );
+
+				goto on_error;
+			}
+			continue;
+		}
+		if( libesedb_page_release(
+		     internal_table->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_table_cursor_set_page(
+		     internal_cursor,
+		     page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set leaf page: %" PRIu32 ".",
+			 function,
+			 page_number );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	return( 0 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 internal_table->io_handle,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the next record
+ * The leaf pages are visited in key order, or in physical order for a physical cursor,
+ * each leaf page is retrieved from the pages cache without descending the page tree
+ * The leaf pages that follow are read-ahead into the pages cache, the read-ahead
+ * is synchronous and done by the calling thread
+ * Returns 1 if successful, 0 if no more records are available or -1 on error
+ */
+int libesedb_table_cursor_next(
+     libesedb_table_cursor_t *cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_cursor_t *internal_cursor = NULL;
+	libesedb_internal_table_t *internal_table         = NULL;
+	libesedb_page_t *page                             = NULL;
+	static char *function                             = "libesedb_table_cursor_next";
+	off64_t page_offset                               = 0;
+	uint16_t data_offset                              = 0;
+	uint16_t data_size                                = 0;
+	uint16_t page_value_index                         = 0;
+	int result                                        = 0;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libesedb_internal_table_cursor_t *) cursor;
+
+	if( internal_cursor->internal_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - missing table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = internal_cursor->internal_table;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	while( internal_cursor->page_number != 0 )
+	{
+		if( internal_cursor->page_value_index >= internal_cursor->number_of_page_values )
+		{
+			if( internal_cursor->extents != NULL )
+			{
+				result = libesedb_table_cursor_set_next_physical_page(
+				          internal_cursor,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set next physical leaf page.",
+					 function );
+
+					return( -1 );
+				}
+				else if( result == 0 )
+				{
+					break;
+				}
+				continue;
+			}
+			if( ( internal_cursor->next_page_number == 0 )
+			 || ( internal_cursor->next_page_number == internal_cursor->end_page_number ) )
+			{
+				internal_cursor->page_number = 0;
+
+				break;
+			}
+			if( libesedb_table_cursor_set_page(
+			     internal_cursor,
+			     internal_cursor->next_page_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set leaf page: %" PRIu32 ".",
+				 function,
+				 internal_cursor->next_page_number );
+
+				return( -1 );
+			}
+			continue;
+		}
+		page_value_index = internal_cursor->page_value_index;
+
+		internal_cursor->page_value_index += 1;
+
+		/* The cursor does not keep the page referenced between records
+		 * hence the page is retrieved for every record
+		 */
+		if( libesedb_page_tree_get_page(
+		     internal_table->table_page_tree,
+		     internal_table->file_io_handle,
+		     internal_cursor->page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 internal_cursor->page_number );
+
+			return( -1 );
+		}
+		result = libesedb_page_get_value_data_range(
+		          page,
+		          page_value_index,
+		          NULL,
+		          &data_offset,
+		          &data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 " value: %" PRIu16 " data range.",
+			 function,
+			 internal_cursor->page_number,
+			 page_value_index );
+
+			goto on_error;
+		}
+		if( libesedb_page_release(
+		     internal_table->io_handle,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+		if( result == 0 )
+		{
+			continue;
+		}
+		page_offset  = internal_cursor->page_number - 1;
+		page_offset *= internal_table->io_handle->page_size;
+
+		internal_cursor->data_definition->page_offset      = page_offset;
+		internal_cursor->data_definition->page_number      = internal_cursor->page_number;
+		internal_cursor->data_definition->page_value_index = page_value_index;
+		internal_cursor->data_definition->data_offset      = data_offset;
+		internal_cursor->data_definition->data_size        = data_size;
+
+		if( libesedb_record_initialize(
+		     record,
+		     internal_table->file_io_handle,
+		     internal_table->io_handle,
+		     internal_table->table_definition,
+		     internal_table->template_table_definition,
+		     internal_table->column_mask,
+		     internal_table->column_mask_size,
+		     internal_cursor->data_definition,
+		     internal_table->long_values_tree,
+		     internal_table->long_values_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	return( 0 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 internal_table->io_handle,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Positions the cursor before the first record with a key that is greater than or equal to the key data
+ * The key data contains the primary key in the (normalized) form it is stored in the table page tree
+ * If no such record exists the cursor is positioned after the last record
+ * Returns 1 if successful, 0 if no such record or -1 on error
+ */
+int libesedb_table_cursor_seek(
+     libesedb_table_cursor_t *cursor,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_cursor_t *internal_cursor = NULL;
+	libesedb_internal_table_t *internal_table         = NULL;
+	static char *function                             = "libesedb_table_cursor_seek";
+	uint32_t leaf_page_number                         = 0;
+	uint16_t leaf_value_index                         = 0;
+	uint8_t is_exact_match                            = 0;
+	int result                                        = 0;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libesedb_internal_table_cursor_t *) cursor;
+
+	if( internal_cursor->internal_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - missing table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = internal_cursor->internal_table;
+
+	if( internal_table->table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - invalid table - missing table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_table->table_definition->table_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - invalid table - invalid table definition - missing table catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->extents != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cursor - seek not supported in physical order.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_page_tree_seek_leaf_value(
+	          internal_table->table_page_tree,
+	          internal_table->file_io_handle,
+	          internal_table->table_definition->table_catalog_definition->father_data_page_number,
+	          key_data,
+	          key_data_size,
+	          &leaf_page_number,
+	          &leaf_value_index,
+	          &is_exact_match,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to seek leaf value in table page tree.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor->page_number           = 0;
+	internal_cursor->next_page_number      = 0;
+	internal_cursor->number_of_page_values = 0;
+	internal_cursor->page_value_index      = 0;
+	internal_cursor->number_of_pages       = 0;
+	internal_cursor->end_page_number       = 0;
+
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libesedb_table_cursor_set_page(
+	     internal_cursor,
+	     leaf_page_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set leaf page: %" PRIu32 ".",
+		 function,
+		 leaf_page_number );
+
+		return( -1 );
+	}
+	internal_cursor->page_value_index = leaf_value_index;
+
+	return( 1 );
+}
+
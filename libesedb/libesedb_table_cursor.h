@@ -0,0 +1,153 @@
+/*
+ * Table cursor functions
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_INTERNAL_TABLE_CURSOR_H )
+#define _LIBESEDB_INTERNAL_TABLE_CURSOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_data_definition.h"
+#include "libesedb_extern.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_table.h"
+#include "libesedb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_internal_table_cursor libesedb_internal_table_cursor_t;
+
+/* The table cursor walks the leaf pages of the table page tree
+ * using the next page number stored in the page header
+ */
+struct libesedb_internal_table_cursor
+{
+	/* The table
+	 */
+	libesedb_internal_table_t *internal_table;
+
+	/* The record data definition, reused for every record
+	 */
+	libesedb_data_definition_t *data_definition;
+
+	/* The current leaf page number or 0 if the cursor is at the end
+	 */
+	uint32_t page_number;
+
+	/* The next leaf page number
+	 */
+	uint32_t next_page_number;
+
+	/* The number of values in the current leaf page
+	 */
+	uint16_t number_of_page_values;
+
+	/* The index of the next value in the current leaf page
+	 */
+	uint16_t page_value_index;
+
+	/* The number of leaf pages visited, used to detect loops in the leaf page chain
+	 */
+	uint32_t number_of_pages;
+
+	/* The first leaf page number of the next partition or 0 if the cursor is not bounded
+	 */
+	uint32_t end_page_number;
+
+	/* The extents of the pages that are visited in physical order, stored as pairs
+	 * of the first page number and the number of pages, or NULL if the cursor
+	 * follows the leaf page chain
+	 */
+	uint32_t *extents;
+
+	/* The number of extents
+	 */
+	int number_of_extents;
+
+	/* The index of the current extent
+	 */
+	int extent_index;
+
+	/* The next page number to visit in the current extent
+	 */
+	uint32_t extent_page_number;
+
+	/* The last page number that was read ahead
+	 */
+	uint32_t read_ahead_page_number;
+};
+
+LIBESEDB_EXTERN \
+int libesedb_table_cursor_open(
+     libesedb_table_t *table,
+     libesedb_table_cursor_t **cursor,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_partition_cursor_open(
+     libesedb_table_t *table,
+     const uint32_t *partition_page_numbers,
+     int number_of_partitions,
+     int partition_index,
+     libesedb_table_cursor_t **cursor,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_physical_cursor_open(
+     libesedb_table_t *table,
+     libesedb_table_cursor_t **cursor,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_cursor_close(
+     libesedb_table_cursor_t **cursor,
+     libcerror_error_t **error );
+
+int libesedb_table_cursor_set_page(
+     libesedb_internal_table_cursor_t *internal_cursor,
+     uint32_t page_number,
+     libcerror_error_t **error );
+
+int libesedb_table_cursor_set_next_physical_page(
+     libesedb_internal_table_cursor_t *internal_cursor,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_cursor_next(
+     libesedb_table_cursor_t *cursor,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_cursor_seek(
+     libesedb_table_cursor_t *cursor,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_INTERNAL_TABLE_CURSOR_H ) */
+
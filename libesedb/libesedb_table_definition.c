@@ -28,6 +28,7 @@
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
+#include "libesedb_record_layout.h"
 #include "libesedb_table_definition.h"
 
 /* Creates a table definition
@@ -190,6 +191,22 @@ int libesedb_table_definition_free(
 	}
 	if( *table_definition != NULL )
 	{
+		if( ( *table_definition )->record_layout != NULL )
+		{
+			if( libesedb_record_layout_free(
+			     &( ( *table_definition )->record_layout ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record layout.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( ( *table_definition )->table_catalog_definition != NULL )
 		{
 			if( libesedb_catalog_definition_free(
@@ -516,3 +533,52 @@ int libesedb_table_definition_append_index_catalog_definition(
 	return( 1 );
 }
 
+/* Builds the record layout of the table definition
+ * The record layout is only built once and is shared by all the records of the table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_definition_build_record_layout(
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libcerror_error_t **error )
+{
+	libcdata_list_t *template_table_column_catalog_definition_list = NULL;
+	static char *function                                          = "libesedb_table_definition_build_record_layout";
+
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->record_layout != NULL )
+	{
+		return( 1 );
+	}
+	if( template_table_definition != NULL )
+	{
+		template_table_column_catalog_definition_list = template_table_definition->column_catalog_definition_list;
+	}
+	if( libesedb_record_layout_initialize(
+	     &( table_definition->record_layout ),
+	     template_table_column_catalog_definition_list,
+	     table_definition->column_catalog_definition_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record layout.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
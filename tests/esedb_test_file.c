@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -46,6 +47,10 @@
 #define ESEDB_TEST_FILE_VERBOSE
  */
 
+/* The maximum number of tables of which the scanned records are counted
+ */
+#define ESEDB_TEST_FILE_MAXIMUM_NUMBER_OF_SCANNED_TABLES	256
+
 /* Retrieves source as a narrow string
  * Returns 1 if successful or -1 on error
  */
@@ -1441,40 +1446,60 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_file_get_number_of_tables function
+/* Tests the libesedb_file_set_cache_limits function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_file_get_number_of_tables(
-     libesedb_file_t *file )
+int esedb_test_file_set_cache_limits(
+     void )
 {
-	libcerror_error_t *error    = NULL;
-	int number_of_tables        = 0;
-	int number_of_tables_is_set = 0;
-	int result                  = 0;
+	libcerror_error_t *error = NULL;
+	libesedb_file_t *file    = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_file_initialize(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        ESEDB_TEST_ASSERT_IS_NOT_NULL(
+         "file",
+         file );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
 
 	/* Test regular cases
 	 */
-	result = libesedb_file_get_number_of_tables(
+	result = libesedb_file_set_cache_limits(
 	          file,
-	          &number_of_tables,
+	          1024 * 1024,
+	          256 * 1024,
+	          0,
 	          &error );
 
-	ESEDB_TEST_ASSERT_NOT_EQUAL_INT(
+	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	ESEDB_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	 1 );
 
-	number_of_tables_is_set = result;
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
 
 	/* Test error cases
 	 */
-	result = libesedb_file_get_number_of_tables(
+	result = libesedb_file_set_cache_limits(
 	          NULL,
-	          &number_of_tables,
+	          1024 * 1024,
+	          256 * 1024,
+	          0,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1482,32 +1507,32 @@ int esedb_test_file_get_number_of_tables(
 	 result,
 	 -1 );
 
-	ESEDB_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+        ESEDB_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
 
 	libcerror_error_free(
 	 &error );
 
-	if( number_of_tables_is_set != 0 )
-	{
-		result = libesedb_file_get_number_of_tables(
-		          file,
-		          NULL,
-		          &error );
+	/* Clean up
+	 */
+	result = libesedb_file_free(
+	          &file,
+	          &error );
 
-		ESEDB_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		ESEDB_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "file",
+         file );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	return( 1 );
 
 on_error:
@@ -1516,130 +1541,768 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( file != NULL )
+	{
+		libesedb_file_free(
+		 &file,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* The main program
+/* Tests the libesedb_file_get_cache_usage function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc,
-     wchar_t * const argv[] )
-#else
-int main(
-     int argc,
-     char * const argv[] )
-#endif
+int esedb_test_file_get_cache_usage(
+     libesedb_file_t *file )
 {
-	libcerror_error_t *error   = NULL;
-	libesedb_file_t *file      = NULL;
-	system_character_t *source = NULL;
-	system_integer_t option    = 0;
-	int result                 = 0;
+	libcerror_error_t *error  = NULL;
+	size64_t pages_cache_size = 0;
+	int result                = 0;
 
-	while( ( option = libcsystem_getopt(
-	                   argc,
-	                   argv,
-	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
-	{
-		switch( option )
-		{
-			case (system_integer_t) '?':
-			default:
-				fprintf(
-				 stderr,
-				 "Invalid argument: %" PRIs_SYSTEM ".\n",
-				 argv[ optind - 1 ] );
+	/* Test regular cases
+	 */
+	result = libesedb_file_get_cache_usage(
+	          file,
+	          &pages_cache_size,
+	          &error );
 
-				return( EXIT_FAILURE );
-		}
-	}
-	if( optind < argc )
-	{
-		source = argv[ optind ];
-	}
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( ESEDB_TEST_FILE_VERBOSE )
-	libesedb_notify_set_verbose(
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
 	 1 );
-	libesedb_notify_set_stream(
-	 stderr,
-	 NULL );
-#endif
-
-	ESEDB_TEST_RUN(
-	 "libesedb_file_initialize",
-	 esedb_test_file_initialize );
 
-	ESEDB_TEST_RUN(
-	 "libesedb_file_free",
-	 esedb_test_file_free );
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
-	if( source != NULL )
+	/* The pages read when opening the file are held by the pages cache
+	 */
+	if( pages_cache_size == 0 )
 	{
-		ESEDB_TEST_RUN_WITH_ARGS(
-		 "libesedb_file_open",
-		 esedb_test_file_open,
-		 source );
+		fprintf(
+		 stdout,
+		 "%s:%d pages_cache_size == 0\n",
+		 __FILE__,
+		 __LINE__ );
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
+		goto on_error;
+	}
 
-		ESEDB_TEST_RUN_WITH_ARGS(
-		 "libesedb_file_open_wide",
-		 esedb_test_file_open_wide,
-		 source );
+	/* Test error cases
+	 */
+	result = libesedb_file_get_cache_usage(
+	          NULL,
+	          &pages_cache_size,
+	          &error );
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-#if defined( LIBESEDB_HAVE_BFIO )
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		/* TODO add test for libesedb_file_open_file_io_handle */
+	libcerror_error_free(
+	 &error );
 
-#endif /* defined( LIBESEDB_HAVE_BFIO ) */
+	result = libesedb_file_get_cache_usage(
+	          file,
+	          NULL,
+	          &error );
 
-		ESEDB_TEST_RUN(
-		 "libesedb_file_close",
-		 esedb_test_file_close );
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		ESEDB_TEST_RUN_WITH_ARGS(
-		 "libesedb_file_open_close",
-		 esedb_test_file_open_close,
-		 source );
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		/* Initialize test
-		 */
-		result = esedb_test_file_open_source(
-		          &file,
-		          source,
-		          &error );
+	libcerror_error_free(
+	 &error );
 
-		ESEDB_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	/* The cache limits cannot be changed while the file is open
+	 */
+	result = libesedb_file_set_cache_limits(
+	          file,
+	          1024 * 1024,
+	          0,
+	          0,
+	          &error );
 
-	        ESEDB_TEST_ASSERT_IS_NOT_NULL(
-	         "file",
-	         file );
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	        ESEDB_TEST_ASSERT_IS_NULL(
-	         "error",
-	         error );
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		ESEDB_TEST_RUN_WITH_ARGS(
-		 "libesedb_file_signal_abort",
-		 esedb_test_file_signal_abort,
-		 file );
+	libcerror_error_free(
+	 &error );
 
-#if defined( __GNUC__ )
+	return( 1 );
 
-		/* TODO: add tests for libesedb_file_open_read */
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
 
-#endif /* defined( __GNUC__ ) */
+/* Tests the libesedb_file_get_cache_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_get_cache_statistics(
+     libesedb_file_t *file )
+{
+	libcerror_error_t *error        = NULL;
+	uint64_t number_of_cache_hits   = 0;
+	uint64_t number_of_cache_misses = 0;
+	int result                      = 0;
 
-		ESEDB_TEST_RUN_WITH_ARGS(
-		 "libesedb_file_get_type",
-		 esedb_test_file_get_type,
+	/* Test regular cases
+	 */
+	result = libesedb_file_get_cache_statistics(
+	          file,
+	          &number_of_cache_hits,
+	          &number_of_cache_misses,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_file_get_cache_statistics(
+	          NULL,
+	          &number_of_cache_hits,
+	          &number_of_cache_misses,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_get_cache_statistics(
+	          file,
+	          NULL,
+	          &number_of_cache_misses,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_get_cache_statistics(
+	          file,
+	          &number_of_cache_hits,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_file_set_checksum_verification_mode function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_set_checksum_verification_mode(
+     libesedb_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_file_set_checksum_verification_mode(
+	          file,
+	          LIBESEDB_CHECKSUM_VERIFICATION_MODE_FLAG,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_set_checksum_verification_mode(
+	          file,
+	          LIBESEDB_CHECKSUM_VERIFICATION_MODE_NONE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_file_set_checksum_verification_mode(
+	          NULL,
+	          LIBESEDB_CHECKSUM_VERIFICATION_MODE_NONE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_set_checksum_verification_mode(
+	          file,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_file_get_number_of_checksum_mismatches function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_get_number_of_checksum_mismatches(
+     libesedb_file_t *file )
+{
+	libcerror_error_t *error               = NULL;
+	uint64_t number_of_checksum_mismatches = 0;
+	int result                             = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_file_get_number_of_checksum_mismatches(
+	          file,
+	          &number_of_checksum_mismatches,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_file_get_number_of_checksum_mismatches(
+	          NULL,
+	          &number_of_checksum_mismatches,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_get_number_of_checksum_mismatches(
+	          file,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_file_get_number_of_tables function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_get_number_of_tables(
+     libesedb_file_t *file )
+{
+	libcerror_error_t *error    = NULL;
+	int number_of_tables        = 0;
+	int number_of_tables_is_set = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_file_get_number_of_tables(
+	          file,
+	          &number_of_tables,
+	          &error );
+
+	ESEDB_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_tables_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libesedb_file_get_number_of_tables(
+	          NULL,
+	          &number_of_tables,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_tables_is_set != 0 )
+	{
+		result = libesedb_file_get_number_of_tables(
+		          file,
+		          NULL,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Counts the records of a table scan per table
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_file_scan_tables_record_callback(
+     libesedb_table_t *table,
+     int table_entry,
+     libesedb_record_t *record,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	if( ( table == NULL )
+	 || ( table_entry < 0 )
+	 || ( record == NULL )
+	 || ( callback_data == NULL ) )
+	{
+		return( -1 );
+	}
+	if( table_entry < ESEDB_TEST_FILE_MAXIMUM_NUMBER_OF_SCANNED_TABLES )
+	{
+		( (int *) callback_data )[ table_entry ] += 1;
+	}
+	return( 1 );
+}
+
+/* Tests the libesedb_file_scan_tables function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_scan_tables(
+     libesedb_file_t *file )
+{
+	int number_of_scanned_records[ ESEDB_TEST_FILE_MAXIMUM_NUMBER_OF_SCANNED_TABLES ];
+
+	libcerror_error_t *error = NULL;
+	libesedb_table_t *table  = NULL;
+	int number_of_records    = 0;
+	int number_of_tables     = 0;
+	int result               = 0;
+	int table_entry          = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_file_get_number_of_tables(
+	          file,
+	          &number_of_tables,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_tables > ESEDB_TEST_FILE_MAXIMUM_NUMBER_OF_SCANNED_TABLES )
+	{
+		number_of_tables = ESEDB_TEST_FILE_MAXIMUM_NUMBER_OF_SCANNED_TABLES;
+	}
+	memory_set(
+	 number_of_scanned_records,
+	 0,
+	 sizeof( int ) * ESEDB_TEST_FILE_MAXIMUM_NUMBER_OF_SCANNED_TABLES );
+
+	/* Test regular cases
+	 */
+	result = libesedb_file_scan_tables(
+	          file,
+	          &esedb_test_file_scan_tables_record_callback,
+	          (void *) number_of_scanned_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the scan returns the same number of records per table as the tables
+	 */
+	for( table_entry = 0;
+	     table_entry < number_of_tables;
+	     table_entry++ )
+	{
+		result = libesedb_file_get_table(
+		          file,
+		          table_entry,
+		          &table,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_table_get_number_of_records(
+		          table,
+		          &number_of_records,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "number_of_scanned_records",
+		 number_of_scanned_records[ table_entry ],
+		 number_of_records );
+
+		result = libesedb_table_free(
+		          &table,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libesedb_file_scan_tables(
+	          NULL,
+	          &esedb_test_file_scan_tables_record_callback,
+	          (void *) number_of_scanned_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_scan_tables(
+	          file,
+	          NULL,
+	          (void *) number_of_scanned_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( table != NULL )
+	{
+		libesedb_table_free(
+		 &table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	libcerror_error_t *error   = NULL;
+	libesedb_file_t *file      = NULL;
+	system_character_t *source = NULL;
+	system_integer_t option    = 0;
+	int result                 = 0;
+
+	while( ( option = libcsystem_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ESEDB_TEST_FILE_VERBOSE )
+	libesedb_notify_set_verbose(
+	 1 );
+	libesedb_notify_set_stream(
+	 stderr,
+	 NULL );
+#endif
+
+	ESEDB_TEST_RUN(
+	 "libesedb_file_initialize",
+	 esedb_test_file_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_file_free",
+	 esedb_test_file_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_file_set_cache_limits",
+	 esedb_test_file_set_cache_limits );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_file_open",
+		 esedb_test_file_open,
+		 source );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_file_open_wide",
+		 esedb_test_file_open_wide,
+		 source );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+#if defined( LIBESEDB_HAVE_BFIO )
+
+		/* TODO add test for libesedb_file_open_file_io_handle */
+
+#endif /* defined( LIBESEDB_HAVE_BFIO ) */
+
+		ESEDB_TEST_RUN(
+		 "libesedb_file_close",
+		 esedb_test_file_close );
+
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_file_open_close",
+		 esedb_test_file_open_close,
+		 source );
+
+		/* Initialize test
+		 */
+		result = esedb_test_file_open_source(
+		          &file,
+		          source,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+	        ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	         "file",
+	         file );
+
+	        ESEDB_TEST_ASSERT_IS_NULL(
+	         "error",
+	         error );
+
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_file_signal_abort",
+		 esedb_test_file_signal_abort,
+		 file );
+
+#if defined( __GNUC__ )
+
+		/* TODO: add tests for libesedb_file_open_read */
+
+#endif /* defined( __GNUC__ ) */
+
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_file_get_type",
+		 esedb_test_file_get_type,
 		 file );
 
 		/* TODO: add tests for libesedb_file_get_format_version */
@@ -1651,6 +2314,26 @@ int main(
 		 esedb_test_file_get_page_size,
 		 file );
 
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_file_get_cache_usage",
+		 esedb_test_file_get_cache_usage,
+		 file );
+
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_file_get_cache_statistics",
+		 esedb_test_file_get_cache_statistics,
+		 file );
+
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_file_set_checksum_verification_mode",
+		 esedb_test_file_set_checksum_verification_mode,
+		 file );
+
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_file_get_number_of_checksum_mismatches",
+		 esedb_test_file_get_number_of_checksum_mismatches,
+		 file );
+
 		ESEDB_TEST_RUN_WITH_ARGS(
 		 "libesedb_file_get_number_of_tables",
 		 esedb_test_file_get_number_of_tables,
@@ -1662,6 +2345,11 @@ int main(
 
 		/* TODO: add tests for libesedb_file_get_table_by_utf16_name */
 
+		ESEDB_TEST_RUN_WITH_ARGS(
+		 "libesedb_file_scan_tables",
+		 esedb_test_file_scan_tables,
+		 file );
+
 		/* Clean up
 		 */
 		result = esedb_test_file_close_source(
@@ -0,0 +1,620 @@
+/*
+ * Library index_cursor type testing program
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_index_cursor.h"
+
+/* Tests the libesedb_index_seek function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_seek(
+     void )
+{
+	uint8_t key_data[ 4 ]           = { 0x7f, 0x80, 0x00, 0x01 };
+	libcerror_error_t *error        = NULL;
+	libesedb_index_cursor_t *cursor = NULL;
+	int result                      = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_index_seek(
+	          NULL,
+	          key_data,
+	          4,
+	          0,
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "cursor",
+	 cursor );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_cursor_close function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_cursor_close(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libesedb_index_cursor_t *cursor = NULL;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_index_cursor_close(
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_index_cursor_close(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_cursor_set_end_key function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_cursor_set_end_key(
+     void )
+{
+	uint8_t key_data[ 4 ]                             = { 0x7f, 0x80, 0x00, 0x01 };
+	libcerror_error_t *error                          = NULL;
+	libesedb_internal_index_cursor_t *internal_cursor = NULL;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	internal_cursor = (libesedb_internal_index_cursor_t *) memory_allocate(
+	                                                        sizeof( libesedb_internal_index_cursor_t ) );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_cursor",
+	 internal_cursor );
+
+	memory_set(
+	 internal_cursor,
+	 0,
+	 sizeof( libesedb_internal_index_cursor_t ) );
+
+	/* Test regular cases
+	 */
+	result = libesedb_index_cursor_set_end_key(
+	          (libesedb_index_cursor_t *) internal_cursor,
+	          key_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "internal_cursor->end_key_data_size",
+	 internal_cursor->end_key_data_size,
+	 (size_t) 4 );
+
+	/* Test error cases
+	 */
+	result = libesedb_index_cursor_set_end_key(
+	          NULL,
+	          key_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the end key data is already set
+	 */
+	result = libesedb_index_cursor_set_end_key(
+	          (libesedb_index_cursor_t *) internal_cursor,
+	          key_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_index_cursor_close(
+	          (libesedb_index_cursor_t **) &internal_cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "internal_cursor",
+	 internal_cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( internal_cursor != NULL )
+	{
+		libesedb_index_cursor_close(
+		 (libesedb_index_cursor_t **) &internal_cursor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_cursor_next function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_cursor_next(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libesedb_record_t *record = NULL;
+	int result                = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_index_cursor_next(
+	          NULL,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_cursor_next_records function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_cursor_next_records(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libesedb_internal_index_cursor_t *internal_cursor = NULL;
+	libesedb_record_t *records[ 4 ]                   = { NULL, NULL, NULL, NULL };
+	int number_of_records                             = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	internal_cursor = (libesedb_internal_index_cursor_t *) memory_allocate(
+	                                                        sizeof( libesedb_internal_index_cursor_t ) );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_cursor",
+	 internal_cursor );
+
+	memory_set(
+	 internal_cursor,
+	 0,
+	 sizeof( libesedb_internal_index_cursor_t ) );
+
+	/* Test error cases
+	 */
+	result = libesedb_index_cursor_next_records(
+	          NULL,
+	          records,
+	          4,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_cursor_next_records(
+	          (libesedb_index_cursor_t *) internal_cursor,
+	          NULL,
+	          4,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_cursor_next_records(
+	          (libesedb_index_cursor_t *) internal_cursor,
+	          records,
+	          0,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_cursor_next_records(
+	          (libesedb_index_cursor_t *) internal_cursor,
+	          records,
+	          4,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 internal_cursor );
+
+	internal_cursor = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( internal_cursor != NULL )
+	{
+		memory_free(
+		 internal_cursor );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ )
+
+/* Tests the libesedb_index_cursor_bookmark_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_cursor_bookmark_compare(
+     void )
+{
+	libesedb_index_cursor_bookmark_t bookmarks[ 4 ];
+
+	uint8_t first_key_data[ 4 ]  = { 0x7f, 0x80, 0x00, 0x01 };
+	uint8_t second_key_data[ 4 ] = { 0x7f, 0x80, 0x00, 0x02 };
+	int result                   = 0;
+
+	bookmarks[ 0 ].key_data      = second_key_data;
+	bookmarks[ 0 ].key_data_size = 4;
+	bookmarks[ 0 ].record_index  = 0;
+
+	bookmarks[ 1 ].key_data      = first_key_data;
+	bookmarks[ 1 ].key_data_size = 4;
+	bookmarks[ 1 ].record_index  = 1;
+
+	bookmarks[ 2 ].key_data      = first_key_data;
+	bookmarks[ 2 ].key_data_size = 3;
+	bookmarks[ 2 ].record_index  = 2;
+
+	bookmarks[ 3 ].key_data      = first_key_data;
+	bookmarks[ 3 ].key_data_size = 4;
+	bookmarks[ 3 ].record_index  = 3;
+
+	/* Test regular cases
+	 */
+	result = libesedb_index_cursor_bookmark_compare(
+	          &( bookmarks[ 1 ] ),
+	          &( bookmarks[ 0 ] ) );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libesedb_index_cursor_bookmark_compare(
+	          &( bookmarks[ 0 ] ),
+	          &( bookmarks[ 1 ] ) );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* A key that is a prefix of another key sorts before it
+	 */
+	result = libesedb_index_cursor_bookmark_compare(
+	          &( bookmarks[ 2 ] ),
+	          &( bookmarks[ 1 ] ) );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	/* Equal keys are ordered by record index
+	 */
+	result = libesedb_index_cursor_bookmark_compare(
+	          &( bookmarks[ 3 ] ),
+	          &( bookmarks[ 1 ] ) );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libesedb_index_cursor_bookmark_compare(
+	          &( bookmarks[ 1 ] ),
+	          &( bookmarks[ 1 ] ) );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* Tests the libesedb_index_cursor_previous function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_cursor_previous(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libesedb_record_t *record = NULL;
+	int result                = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_index_cursor_previous(
+	          NULL,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_seek",
+	 esedb_test_index_seek );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_cursor_close",
+	 esedb_test_index_cursor_close );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_cursor_set_end_key",
+	 esedb_test_index_cursor_set_end_key );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_cursor_next",
+	 esedb_test_index_cursor_next );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_cursor_next_records",
+	 esedb_test_index_cursor_next_records );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_cursor_previous",
+	 esedb_test_index_cursor_previous );
+
+#if defined( __GNUC__ )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_cursor_bookmark_compare",
+	 esedb_test_index_cursor_bookmark_compare );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,22 +21,31 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "esedb_test_libbfio.h"
 #include "esedb_test_libcerror.h"
 #include "esedb_test_libesedb.h"
 #include "esedb_test_macros.h"
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_definitions.h"
 #include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_page.h"
+#include "../libesedb/libesedb_page_cache.h"
 
 #if defined( __GNUC__ )
 
+/* The file header pages followed by 4 empty pages
+ */
+uint8_t esedb_test_io_handle_pages_data[ 6 * 4096 ];
+
 /* Tests the libesedb_io_handle_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -270,6 +279,690 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_io_handle_open_file, libesedb_io_handle_map_file and libesedb_io_handle_close_file functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_io_handle_open_file(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libesedb_io_handle_t *io_handle = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        ESEDB_TEST_ASSERT_IS_NOT_NULL(
+         "io_handle",
+         io_handle );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test error cases
+	 */
+	result = libesedb_io_handle_open_file(
+	          NULL,
+	          "test",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        ESEDB_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_io_handle_open_file(
+	          io_handle,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        ESEDB_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test mapping and closing a handle without an open file
+	 */
+	result = libesedb_io_handle_map_file(
+	          io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libesedb_io_handle_close_file(
+	          io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libesedb_io_handle_map_file(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        ESEDB_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_io_handle_close_file(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        ESEDB_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "io_handle",
+         io_handle );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_io_handle_read_pages and libesedb_io_handle_read_ahead functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_io_handle_read_ahead(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libesedb_io_handle_t *io_handle = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        ESEDB_TEST_ASSERT_IS_NOT_NULL(
+         "io_handle",
+         io_handle );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test error cases
+	 */
+	result = libesedb_io_handle_read_ahead(
+	          NULL,
+	          NULL,
+	          1,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        ESEDB_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_io_handle_read_ahead(
+	          io_handle,
+	          NULL,
+	          1,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        ESEDB_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test the read-ahead window of a forward leaf page scan without an open file
+	 */
+	io_handle->pages_data_offset = 2 * 4096;
+	io_handle->page_size         = 4096;
+	io_handle->last_page_number  = 100;
+
+	result = libesedb_io_handle_read_pages(
+	          io_handle,
+	          NULL,
+	          0,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        ESEDB_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_io_handle_read_pages(
+	          io_handle,
+	          NULL,
+	          100,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        ESEDB_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_io_handle_read_ahead(
+	          io_handle,
+	          NULL,
+	          1,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "io_handle->read_ahead_number_of_pages",
+	 io_handle->read_ahead_number_of_pages,
+	 0 );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libesedb_io_handle_read_ahead(
+	          io_handle,
+	          NULL,
+	          2,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "io_handle->read_ahead_number_of_pages",
+	 io_handle->read_ahead_number_of_pages,
+	 LIBESEDB_READ_AHEAD_MINIMUM_NUMBER_OF_PAGES );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libesedb_io_handle_read_ahead(
+	          io_handle,
+	          NULL,
+	          3,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "io_handle->read_ahead_number_of_pages",
+	 io_handle->read_ahead_number_of_pages,
+	 2 * LIBESEDB_READ_AHEAD_MINIMUM_NUMBER_OF_PAGES );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test that leaving the leaf page chain resets the read-ahead window
+	 */
+	result = libesedb_io_handle_read_ahead(
+	          io_handle,
+	          NULL,
+	          50,
+	          51,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "io_handle->read_ahead_number_of_pages",
+	 io_handle->read_ahead_number_of_pages,
+	 0 );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "io_handle",
+         io_handle );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_io_handle_read_pages function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_io_handle_read_pages(
+     void )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libesedb_io_handle_t *io_handle  = NULL;
+	libesedb_page_t *cached_page     = NULL;
+	libesedb_page_t *page            = NULL;
+	void *memset_result              = NULL;
+	int number_of_pages              = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 esedb_test_io_handle_pages_data,
+	                 0,
+	                 sizeof( uint8_t ) * ( 6 * 4096 ) );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	result = libbfio_memory_range_initialize(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          file_io_handle,
+	          esedb_test_io_handle_pages_data,
+	          sizeof( uint8_t ) * ( 6 * 4096 ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->pages_data_offset          = 2 * 4096;
+	io_handle->page_size                  = 4096;
+	io_handle->last_page_number           = 4;
+	io_handle->checksum_verification_mode = LIBESEDB_CHECKSUM_VERIFICATION_MODE_NONE;
+
+	result = libesedb_page_cache_initialize(
+	          &( io_handle->pages_cache ),
+	          16,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_release_reference,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that each page of the run is stored in the pages cache
+	 */
+	result = libesedb_io_handle_read_pages(
+	          io_handle,
+	          file_io_handle,
+	          1,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_cache_get_number_of_pages(
+	          io_handle->pages_cache,
+	          &number_of_pages,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_pages",
+	 number_of_pages,
+	 4 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_cache_get_page(
+	          io_handle->pages_cache,
+	          2,
+	          (intptr_t **) &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page",
+	 page );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "page->page_number",
+	 page->page_number,
+	 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT64(
+	 "page->offset",
+	 (int64_t) page->offset,
+	 (int64_t) ( 3 * 4096 ) );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that reading the run again does not replace the cached pages
+	 */
+	result = libesedb_io_handle_read_pages(
+	          io_handle,
+	          file_io_handle,
+	          1,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_cache_get_page(
+	          io_handle->pages_cache,
+	          2,
+	          (intptr_t **) &cached_page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "cached_page == page",
+	 (int) ( cached_page == page ),
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	cached_page = NULL;
+	page        = NULL;
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) */
 
 /* The main program
@@ -299,11 +992,25 @@ int main(
 
 	/* TODO: add tests for libesedb_io_handle_clear */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_io_handle_open_file",
+	 esedb_test_io_handle_open_file );
+
+	/* TODO: add tests for libesedb_io_handle_read_buffer_at_offset */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_io_handle_read_ahead",
+	 esedb_test_io_handle_read_ahead );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_io_handle_read_pages",
+	 esedb_test_io_handle_read_pages );
+
 	/* TODO: add tests for libesedb_io_handle_set_pages_data_range */
 
 	/* TODO: add tests for libesedb_io_handle_read_file_header */
 
-	/* TODO: add tests for libesedb_io_handle_read_page */
+	/* TODO: add tests for libesedb_io_handle_get_pages_cache_size */
 
 #endif /* defined( __GNUC__ ) */
 
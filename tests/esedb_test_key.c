@@ -429,6 +429,222 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_key_compare_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_key_compare_data(
+     void )
+{
+	uint8_t common_key_data[ 2 ] = { 0x7f, 0x80 };
+	uint8_t key_data[ 4 ]        = { 0x7f, 0x80, 0x00, 0x02 };
+	uint8_t local_key_data[ 2 ]  = { 0x00, 0x02 };
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_key_compare_data(
+	          key_data,
+	          4,
+	          common_key_data,
+	          2,
+	          local_key_data,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATA_COMPARE_EQUAL );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_compare_data(
+	          key_data,
+	          4,
+	          NULL,
+	          0,
+	          key_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATA_COMPARE_EQUAL );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_compare_data(
+	          key_data,
+	          3,
+	          common_key_data,
+	          2,
+	          local_key_data,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATA_COMPARE_LESS );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_compare_data(
+	          key_data,
+	          1,
+	          common_key_data,
+	          2,
+	          local_key_data,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATA_COMPARE_LESS );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_compare_data(
+	          key_data,
+	          4,
+	          common_key_data,
+	          2,
+	          local_key_data,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATA_COMPARE_GREATER );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_compare_data(
+	          local_key_data,
+	          2,
+	          common_key_data,
+	          2,
+	          local_key_data,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATA_COMPARE_LESS );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_compare_data(
+	          common_key_data,
+	          2,
+	          NULL,
+	          0,
+	          local_key_data,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATA_COMPARE_GREATER );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_key_compare_data(
+	          NULL,
+	          4,
+	          common_key_data,
+	          2,
+	          local_key_data,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_key_compare_data(
+	          key_data,
+	          4,
+	          NULL,
+	          2,
+	          local_key_data,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_key_compare_data(
+	          key_data,
+	          4,
+	          common_key_data,
+	          2,
+	          NULL,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) */
 
 /* The main program
@@ -460,6 +676,10 @@ int main(
 
 	/* TODO: add tests for libesedb_key_append_data */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_key_compare_data",
+	 esedb_test_key_compare_data );
+
 #if defined( TODO )
 
 	ESEDB_TEST_RUN(
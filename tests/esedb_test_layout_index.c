@@ -0,0 +1,624 @@
+/*
+ * Library layout index type testing program
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_layout_index.h"
+
+uint8_t esedb_test_layout_index_database_signature[ 28 ] = {
+	0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+	0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c };
+
+uint8_t esedb_test_layout_index_tree_data[ 24 ] = {
+	0x05, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ )
+
+/* Tests the libesedb_layout_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_layout_index_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libesedb_layout_index_t *layout_index = NULL;
+	int result                            = 0;
+
+	/* Test layout index initialization
+	 */
+	result = libesedb_layout_index_initialize(
+	          &layout_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "layout_index",
+	 layout_index );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_layout_index_free(
+	          &layout_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "layout_index",
+	 layout_index );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_layout_index_initialize(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	layout_index = (libesedb_layout_index_t *) 0x12345678UL;
+
+	result = libesedb_layout_index_initialize(
+	          &layout_index,
+	          &error );
+
+	layout_index = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( layout_index != NULL )
+	{
+		libesedb_layout_index_free(
+		 &layout_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_layout_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_layout_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_layout_index_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_layout_index_compare_database_values function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_layout_index_compare_database_values(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libesedb_layout_index_t *layout_index = NULL;
+	int result                            = 0;
+
+	result = libesedb_layout_index_initialize(
+	          &layout_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_layout_index_set_database_values(
+	          layout_index,
+	          4096,
+	          128,
+	          0x00002000UL,
+	          esedb_test_layout_index_database_signature,
+	          28,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that matching database values are accepted
+	 */
+	result = libesedb_layout_index_compare_database_values(
+	          layout_index,
+	          4096,
+	          128,
+	          0x00002000UL,
+	          esedb_test_layout_index_database_signature,
+	          28,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a modified database is rejected
+	 */
+	result = libesedb_layout_index_compare_database_values(
+	          layout_index,
+	          4096,
+	          128,
+	          0x00002001UL,
+	          esedb_test_layout_index_database_signature,
+	          28,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_layout_index_compare_database_values(
+	          layout_index,
+	          4096,
+	          129,
+	          0x00002000UL,
+	          esedb_test_layout_index_database_signature,
+	          28,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_layout_index_compare_database_values(
+	          NULL,
+	          4096,
+	          128,
+	          0x00002000UL,
+	          esedb_test_layout_index_database_signature,
+	          28,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_layout_index_compare_database_values(
+	          layout_index,
+	          4096,
+	          128,
+	          0x00002000UL,
+	          esedb_test_layout_index_database_signature,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_layout_index_free(
+	          &layout_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( layout_index != NULL )
+	{
+		libesedb_layout_index_free(
+		 &layout_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_layout_index_read_tree_data and libesedb_layout_index_get_tree_by_root_page_number functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_layout_index_read_tree_data(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libesedb_layout_index_t *layout_index = NULL;
+	libesedb_layout_index_tree_t *tree    = NULL;
+	int result                            = 0;
+
+	result = libesedb_layout_index_initialize(
+	          &layout_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_layout_index_set_database_values(
+	          layout_index,
+	          4096,
+	          128,
+	          0x00002000UL,
+	          esedb_test_layout_index_database_signature,
+	          28,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_layout_index_read_tree_data(
+	          layout_index,
+	          4,
+	          esedb_test_layout_index_tree_data,
+	          24,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_layout_index_get_tree_by_root_page_number(
+	          layout_index,
+	          4,
+	          &tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "tree",
+	 tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "tree->number_of_leaf_pages",
+	 tree->number_of_leaf_pages,
+	 3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "tree->leaf_page_numbers[ 1 ]",
+	 tree->leaf_page_numbers[ 1 ],
+	 7 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "tree->number_of_leaf_values",
+	 tree->number_of_leaf_values,
+	 (uint64_t) 51 );
+
+	result = libesedb_layout_index_get_tree_by_root_page_number(
+	          layout_index,
+	          5,
+	          &tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_layout_index_read_tree_data(
+	          NULL,
+	          4,
+	          esedb_test_layout_index_tree_data,
+	          24,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_layout_index_read_tree_data(
+	          layout_index,
+	          8,
+	          esedb_test_layout_index_tree_data,
+	          20,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a leaf page number that exceeds the last page number
+	 */
+	result = libesedb_layout_index_set_database_values(
+	          layout_index,
+	          4096,
+	          6,
+	          0x00002000UL,
+	          esedb_test_layout_index_database_signature,
+	          28,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_layout_index_read_tree_data(
+	          layout_index,
+	          5,
+	          esedb_test_layout_index_tree_data,
+	          24,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_layout_index_free(
+	          &layout_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( layout_index != NULL )
+	{
+		libesedb_layout_index_free(
+		 &layout_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_layout_index_initialize",
+	 esedb_test_layout_index_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_layout_index_free",
+	 esedb_test_layout_index_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_layout_index_compare_database_values",
+	 esedb_test_layout_index_compare_database_values );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_layout_index_read_tree_data",
+	 esedb_test_layout_index_read_tree_data );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
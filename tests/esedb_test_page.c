@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,8 +34,40 @@
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_key.h"
 #include "../libesedb/libesedb_page.h"
 
+/* The page header and extended page header of a 16 KiB page with page number 7
+ * the page is a leaf page in the new record format, the stored XOR-32 and ECC-32
+ * checksums were calculated with the original, non-vectorized, ECC-32 implementation
+ */
+uint8_t esedb_test_page_header_data1[ 80 ] = {
+	0xf3, 0x71, 0xc6, 0xe5, 0xf9, 0x47, 0xf9, 0x47,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x03, 0x00, 0x02, 0x28, 0x00, 0x00,
+	0xbc, 0x70, 0xcf, 0x6f, 0x29, 0x33, 0xd6, 0x4c,
+	0xab, 0xc7, 0x35, 0xfb, 0x90, 0x1f, 0x90, 0x1f,
+	0x39, 0xce, 0xbd, 0x89, 0xd3, 0x11, 0x2c, 0x6e,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* The page header and extended page header of a 32 KiB page with page number 7
+ */
+uint8_t esedb_test_page_header_data2[ 80 ] = {
+	0x71, 0x98, 0x8e, 0xf3, 0xca, 0xf5, 0xca, 0xf5,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x03, 0x00, 0x02, 0x28, 0x00, 0x00,
+	0x95, 0x09, 0x88, 0x72, 0x43, 0x8e, 0xbc, 0x71,
+	0xcf, 0xfd, 0xa7, 0x9a, 0x5b, 0xbb, 0xa4, 0x44,
+	0xb7, 0x0a, 0xea, 0x6d, 0x88, 0x16, 0x77, 0xe9,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
 #if defined( __GNUC__ )
 
 /* Tests the libesedb_page_initialize function
@@ -254,32 +287,1057 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) */
+/* Tests the libesedb_page_read_value and libesedb_page_get_value functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_read_value(
+     void )
+{
+	uint8_t page_data[ 4096 ];
 
-/* The main program
+	libcerror_error_t *error          = NULL;
+	libesedb_page_t *page             = NULL;
+	libesedb_page_value_t *page_value = NULL;
+	uint16_t number_of_values         = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_page_initialize(
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page",
+	 page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The page tags are stored back to front at the end of the page data
+	 * tag 0: offset 0, size 16
+	 * tag 1: offset 16, size 8, flags 0x01
+	 */
+	memory_set(
+	 page_data,
+	 0,
+	 4096 );
+
+	page_data[ 4092 ] = 16;
+	page_data[ 4088 ] = 8;
+	page_data[ 4090 ] = 16;
+	page_data[ 4091 ] = 0x20;
+
+	page->data               = page_data;
+	page->data_size          = 4096;
+	page->data_is_mapped     = 1;
+	page->values_data_offset = 40;
+	page->number_of_values   = 2;
+	page->values             = (libesedb_page_value_t *) memory_allocate(
+	                                                      sizeof( libesedb_page_value_t ) * 2 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page->values",
+	 page->values );
+
+	memory_set(
+	 page->values,
+	 0,
+	 sizeof( libesedb_page_value_t ) * 2 );
+
+	/* Test regular cases
+	 */
+	result = libesedb_page_read_value(
+	          page,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page->values[ 0 ].size",
+	 (int) page->values[ 0 ].size,
+	 16 );
+
+	/* A page value that has not been read cannot be retrieved
+	 */
+	result = libesedb_page_get_value(
+	          page,
+	          1,
+	          &page_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_read_value(
+	          page,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_get_number_of_values(
+	          page,
+	          &number_of_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 (int) number_of_values,
+	 2 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_get_value(
+	          page,
+	          1,
+	          &page_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_value",
+	 page_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_value->offset",
+	 (int) page_value->offset,
+	 56 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_value->size",
+	 (int) page_value->size,
+	 8 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_value->flags",
+	 (int) page_value->flags,
+	 1 );
+
+	/* The page tags flags of the extended page header are stored in the page value data
+	 * tag 1: offset 16, size 8, flags 0x04 stored in the first 16-bit value: 0x8005
+	 */
+	page_data[ 4090 ] = 16;
+	page_data[ 4091 ] = 0;
+	page_data[ 56 ]   = 0x05;
+	page_data[ 57 ]   = 0x80;
+
+	page->has_extended_page_header = 1;
+
+	result = libesedb_page_read_value(
+	          page,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page->values[ 1 ].flags",
+	 (int) page->values[ 1 ].flags,
+	 4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_data[ 57 ]",
+	 (int) page_data[ 57 ],
+	 0 );
+
+	page->has_extended_page_header = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_page_get_value(
+	          page,
+	          2,
+	          &page_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	page->number_of_values = 2000;
+
+	result = libesedb_page_read_value(
+	          page,
+	          1,
+	          &error );
+
+	page->number_of_values = 2;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_page_free(
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page != NULL )
+	{
+		libesedb_page_free(
+		 &page,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_verify_checksum function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
-#endif
+int esedb_test_page_verify_checksum(
+     void )
 {
-	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
-	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+	uint8_t page_data[ 4096 ];
 
-#if defined( __GNUC__ )
+	libcerror_error_t *error        = NULL;
+	libesedb_io_handle_t *io_handle = NULL;
+	int result                      = 0;
 
-	ESEDB_TEST_RUN(
-	 "libesedb_page_initialize",
-	 esedb_test_page_initialize );
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
 
-	ESEDB_TEST_RUN(
-	 "libesedb_page_free",
-	 esedb_test_page_free );
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_revision = 0;
+	io_handle->page_size       = 4096;
+
+	memory_set(
+	 page_data,
+	 0,
+	 4096 );
+
+	/* Test an uninitialized page
+	 */
+	result = libesedb_page_verify_checksum(
+	          io_handle,
+	          page_data,
+	          4096,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The XOR-32 checksum of a page with zero bytes is the initial value 0x89abcdef
+	 */
+	page_data[ 0 ] = 0xef;
+	page_data[ 1 ] = 0xcd;
+	page_data[ 2 ] = 0xab;
+	page_data[ 3 ] = 0x89;
+
+	result = libesedb_page_verify_checksum(
+	          io_handle,
+	          page_data,
+	          4096,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	page_data[ 1001 ] = 0x5a;
+
+	result = libesedb_page_verify_checksum(
+	          io_handle,
+	          page_data,
+	          4096,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_verify_checksum(
+	          NULL,
+	          page_data,
+	          4096,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_verify_checksum(
+	          io_handle,
+	          NULL,
+	          4096,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_verify_checksum(
+	          io_handle,
+	          page_data,
+	          8,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Creates the data of an extended page header test page
+ * The page values data is filled with pseudo random data seeded by the page number
+ */
+void esedb_test_page_set_extended_page_data(
+      uint8_t *page_data,
+      size_t page_data_size,
+      const uint8_t *page_header_data,
+      uint32_t page_number )
+{
+	size_t page_data_offset = 0;
+	uint32_t random_value   = page_number;
+
+	for( page_data_offset = 0;
+	     page_data_offset < page_data_size;
+	     page_data_offset++ )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345UL;
+
+		page_data[ page_data_offset ] = (uint8_t) ( random_value >> 16 );
+	}
+	memory_copy(
+	 page_data,
+	 page_header_data,
+	 80 );
+}
+
+/* Tests the libesedb_page_verify_extended_checksums function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_verify_extended_checksums(
+     void )
+{
+	uint8_t page_data[ 32768 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	esedb_test_page_set_extended_page_data(
+	 page_data,
+	 16384,
+	 esedb_test_page_header_data1,
+	 7 );
+
+	result = libesedb_page_verify_extended_checksums(
+	          page_data,
+	          16384,
+	          7,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	esedb_test_page_set_extended_page_data(
+	 page_data,
+	 32768,
+	 esedb_test_page_header_data2,
+	 7 );
+
+	result = libesedb_page_verify_extended_checksums(
+	          page_data,
+	          32768,
+	          7,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The page number is used as the initial value of the checksums
+	 */
+	result = libesedb_page_verify_extended_checksums(
+	          page_data,
+	          32768,
+	          8,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a corrupted block
+	 */
+	esedb_test_page_set_extended_page_data(
+	 page_data,
+	 16384,
+	 esedb_test_page_header_data1,
+	 7 );
+
+	page_data[ 10000 ] ^= 0x01;
+
+	result = libesedb_page_verify_extended_checksums(
+	          page_data,
+	          16384,
+	          7,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_verify_extended_checksums(
+	          NULL,
+	          16384,
+	          7,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_verify_extended_checksums(
+	          page_data,
+	          64,
+	          7,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_get_value_data_range and libesedb_page_get_value_index_by_key functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_get_value_data_range(
+     void )
+{
+	uint8_t page_data[ 4096 ];
+
+	uint8_t search_key_data[ 5 ] = { 0xaa, 0xbb, 'x', 'y', 'z' };
+	libcerror_error_t *error     = NULL;
+	libesedb_key_t *key          = NULL;
+	libesedb_page_t *page        = NULL;
+	uint16_t data_offset         = 0;
+	uint16_t data_size           = 0;
+	uint16_t value_index         = 0;
+	uint8_t is_exact_match       = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_page_initialize(
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page",
+	 page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_key_initialize(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* tag 0: offset 0, size 4, contains the common key data
+	 * tag 1: offset 16, size 10, flags 0x04 (has common key size)
+	 * tag 2: offset 32, size 4, flags 0x02 (is defunct)
+	 */
+	memory_set(
+	 page_data,
+	 0,
+	 4096 );
+
+	page_data[ 4092 ] = 4;
+	page_data[ 4088 ] = 10;
+	page_data[ 4090 ] = 16;
+	page_data[ 4091 ] = 0x80;
+	page_data[ 4084 ] = 4;
+	page_data[ 4086 ] = 32;
+	page_data[ 4087 ] = 0x40;
+
+	page_data[ 40 ] = 0xaa;
+	page_data[ 41 ] = 0xbb;
+	page_data[ 42 ] = 0xcc;
+	page_data[ 43 ] = 0xdd;
+
+	/* common key size: 2, local key size: 3, local key: 'x', 'y', 'z' and 3 bytes of data
+	 */
+	page_data[ 56 ] = 2;
+	page_data[ 58 ] = 3;
+	page_data[ 60 ] = 'x';
+	page_data[ 61 ] = 'y';
+	page_data[ 62 ] = 'z';
+
+	page->data               = page_data;
+	page->data_size          = 4096;
+	page->data_is_mapped     = 1;
+	page->values_data_offset = 40;
+	page->number_of_values   = 3;
+	page->values             = (libesedb_page_value_t *) memory_allocate(
+	                                                      sizeof( libesedb_page_value_t ) * 3 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page->values",
+	 page->values );
+
+	memory_set(
+	 page->values,
+	 0,
+	 sizeof( libesedb_page_value_t ) * 3 );
+
+	for( value_index = 0;
+	     value_index < 3;
+	     value_index++ )
+	{
+		result = libesedb_page_read_value(
+		          page,
+		          value_index,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libesedb_page_get_value_data_range(
+	          page,
+	          1,
+	          key,
+	          &data_offset,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "data_offset",
+	 (int) data_offset,
+	 63 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "data_size",
+	 (int) data_size,
+	 3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "key->data_size",
+	 key->data_size,
+	 (size_t) 5 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "key->data[ 1 ]",
+	 (int) key->data[ 1 ],
+	 0xbb );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "key->data[ 4 ]",
+	 (int) key->data[ 4 ],
+	 'z' );
+
+	result = libesedb_page_get_value_data_range(
+	          page,
+	          2,
+	          NULL,
+	          &data_offset,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The key of page value 1 is: 0xaa, 0xbb, 'x', 'y', 'z'
+	 */
+	result = libesedb_page_get_value_index_by_key(
+	          page,
+	          search_key_data,
+	          5,
+	          &value_index,
+	          &is_exact_match,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "value_index",
+	 (int) value_index,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "is_exact_match",
+	 (int) is_exact_match,
+	 1 );
+
+	result = libesedb_page_get_value_index_by_key(
+	          page,
+	          search_key_data,
+	          3,
+	          &value_index,
+	          &is_exact_match,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "is_exact_match",
+	 (int) is_exact_match,
+	 0 );
+
+	search_key_data[ 2 ] = 'z';
+
+	result = libesedb_page_get_value_index_by_key(
+	          page,
+	          search_key_data,
+	          3,
+	          &value_index,
+	          &is_exact_match,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_get_value_data_range(
+	          NULL,
+	          1,
+	          NULL,
+	          &data_offset,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_get_value_data_range(
+	          page,
+	          1,
+	          NULL,
+	          NULL,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a local key size that exceeds the page value size
+	 */
+	page_data[ 58 ] = 9;
+
+	page->values[ 1 ].data = NULL;
+
+	result = libesedb_page_get_value_data_range(
+	          page,
+	          1,
+	          NULL,
+	          &data_offset,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_key_free(
+	          &key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_free(
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key != NULL )
+	{
+		libesedb_key_free(
+		 &key,
+		 NULL );
+	}
+	if( page != NULL )
+	{
+		libesedb_page_free(
+		 &page,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_initialize",
+	 esedb_test_page_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_free",
+	 esedb_test_page_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_read_value",
+	 esedb_test_page_read_value );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_verify_checksum",
+	 esedb_test_page_verify_checksum );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_verify_extended_checksums",
+	 esedb_test_page_verify_extended_checksums );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_get_value_data_range",
+	 esedb_test_page_get_value_data_range );
+
+	/* TODO: add tests for libesedb_page_get_from_cache */
 
 #endif /* defined( __GNUC__ ) */
 
@@ -0,0 +1,848 @@
+/*
+ * Library page cache type testing program
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_page.h"
+#include "../libesedb/libesedb_page_cache.h"
+
+#if defined( __GNUC__ )
+
+/* Tests the libesedb_page_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_cache_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libesedb_page_cache_t *page_cache = NULL;
+	int result                        = 0;
+
+	/* Test page cache initialization
+	 */
+	result = libesedb_page_cache_initialize(
+	          &page_cache,
+	          16,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_free,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_cache",
+	 page_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_cache_free(
+	          &page_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_cache",
+	 page_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_cache_initialize(
+	          NULL,
+	          16,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_free,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	page_cache = (libesedb_page_cache_t *) 0x12345678UL;
+
+	result = libesedb_page_cache_initialize(
+	          &page_cache,
+	          16,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_free,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	page_cache = NULL;
+
+	result = libesedb_page_cache_initialize(
+	          &page_cache,
+	          2,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_free,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_cache_initialize(
+	          &page_cache,
+	          16,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_cache != NULL )
+	{
+		libesedb_page_cache_free(
+		 &page_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_page_cache_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Creates a page and stores it in the page cache
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_cache_set_test_page(
+     libesedb_page_cache_t *page_cache,
+     uint32_t page_number )
+{
+	libcerror_error_t *error = NULL;
+	libesedb_page_t *page    = NULL;
+	int result               = 0;
+
+	result = libesedb_page_initialize(
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page",
+	 page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	page->page_number = page_number;
+
+	result = libesedb_page_cache_set_page(
+	          page_cache,
+	          page_number,
+	          (intptr_t **) &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page != NULL )
+	{
+		libesedb_page_free(
+		 &page,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_cache_get_page and libesedb_page_cache_set_page functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_cache_get_set_page(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libesedb_page_cache_t *page_cache = NULL;
+	libesedb_page_t *cached_page      = NULL;
+	libesedb_page_t *page             = NULL;
+	uint32_t page_number              = 0;
+	int number_of_pages               = 0;
+	int pass                          = 0;
+	int result                        = 0;
+
+	result = libesedb_page_cache_initialize(
+	          &page_cache,
+	          16,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_free,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_cache",
+	 page_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a page that is not cached is reported as a miss
+	 */
+	result = libesedb_page_cache_get_page(
+	          page_cache,
+	          1,
+	          (intptr_t **) &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "page_cache->number_of_misses",
+	 page_cache->number_of_misses,
+	 (uint64_t) 1 );
+
+	/* Make pages 1 to 4 frequently used by reading them twice
+	 * with enough pages read in between to move them to the ghost queue
+	 */
+	for( pass = 0;
+	     pass < 2;
+	     pass++ )
+	{
+		for( page_number = 1;
+		     page_number <= 20;
+		     page_number++ )
+		{
+			result = esedb_test_page_cache_set_test_page(
+			          page_cache,
+			          page_number );
+
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			if( ( pass == 1 )
+			 && ( page_number == 4 ) )
+			{
+				break;
+			}
+		}
+	}
+	/* Test that a sequential scan does not evict the frequently used pages
+	 */
+	for( page_number = 100;
+	     page_number < 200;
+	     page_number++ )
+	{
+		result = esedb_test_page_cache_set_test_page(
+		          page_cache,
+		          page_number );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	for( page_number = 1;
+	     page_number <= 4;
+	     page_number++ )
+	{
+		page = NULL;
+
+		result = libesedb_page_cache_get_page(
+		          page_cache,
+		          page_number,
+		          (intptr_t **) &page,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "page",
+		 page );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT32(
+		 "page->page_number",
+		 page->page_number,
+		 page_number );
+	}
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "page_cache->number_of_hits",
+	 page_cache->number_of_hits,
+	 (uint64_t) 4 );
+
+	/* Test that the number of cached pages does not exceed the maximum
+	 */
+	result = libesedb_page_cache_get_number_of_pages(
+	          page_cache,
+	          &number_of_pages,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_pages",
+	 number_of_pages,
+	 16 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that setting a page that is already cached returns the cached page
+	 */
+	result = libesedb_page_cache_get_page(
+	          page_cache,
+	          1,
+	          (intptr_t **) &cached_page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	page = NULL;
+
+	result = libesedb_page_initialize(
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_cache_set_page(
+	          page_cache,
+	          1,
+	          (intptr_t **) &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( page != cached_page )
+	{
+		fprintf(
+		 stdout,
+		 "%s:%d page != cached_page\n",
+		 __FILE__,
+		 __LINE__ );
+
+		page = NULL;
+
+		goto on_error;
+	}
+	page = NULL;
+
+	/* Test error cases
+	 */
+	result = libesedb_page_cache_get_page(
+	          NULL,
+	          1,
+	          (intptr_t **) &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_cache_get_page(
+	          page_cache,
+	          0,
+	          (intptr_t **) &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_cache_get_page(
+	          page_cache,
+	          1,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_cache_set_page(
+	          page_cache,
+	          1,
+	          (intptr_t **) &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_cache_get_number_of_pages(
+	          page_cache,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_page_cache_free(
+	          &page_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page != NULL )
+	{
+		libesedb_page_free(
+		 &page,
+		 NULL );
+	}
+	if( page_cache != NULL )
+	{
+		libesedb_page_cache_free(
+		 &page_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests that a page that is evicted from the page cache while it is referenced remains valid
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_cache_evict_referenced_page(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libesedb_page_cache_t *page_cache = NULL;
+	libesedb_page_t *cached_page      = NULL;
+	libesedb_page_t *page             = NULL;
+	uint32_t page_number              = 0;
+	int result                        = 0;
+
+	result = libesedb_page_cache_initialize(
+	          &page_cache,
+	          4,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_release_reference,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_cache",
+	 page_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_initialize(
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page",
+	 page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	page->page_number = 1;
+
+	/* The page is referenced by the page cache and by the reader
+	 */
+	page->number_of_references = 2;
+
+	result = libesedb_page_cache_set_page(
+	          page_cache,
+	          1,
+	          (intptr_t **) &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	cached_page = page;
+	page        = NULL;
+
+	/* Test that the page is evicted by reading other pages
+	 */
+	for( page_number = 2;
+	     page_number <= 16;
+	     page_number++ )
+	{
+		result = esedb_test_page_cache_set_test_page(
+		          page_cache,
+		          page_number );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	result = libesedb_page_cache_get_page(
+	          page_cache,
+	          1,
+	          (intptr_t **) &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the evicted page was not freed while the reader references it
+	 */
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "cached_page->page_number",
+	 cached_page->page_number,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "cached_page->number_of_references",
+	 cached_page->number_of_references,
+	 1 );
+
+	/* Test that releasing the last reference frees the page
+	 */
+	result = libesedb_page_release_reference(
+	          &cached_page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "cached_page",
+	 cached_page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libesedb_page_cache_free(
+	          &page_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page != NULL )
+	{
+		libesedb_page_free(
+		 &page,
+		 NULL );
+	}
+	if( cached_page != NULL )
+	{
+		libesedb_page_release_reference(
+		 &cached_page,
+		 NULL );
+	}
+	if( page_cache != NULL )
+	{
+		libesedb_page_cache_free(
+		 &page_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_cache_initialize",
+	 esedb_test_page_cache_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_cache_free",
+	 esedb_test_page_cache_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_cache_get_set_page",
+	 esedb_test_page_cache_get_set_page );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_cache_evict_referenced_page",
+	 esedb_test_page_cache_evict_referenced_page );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,8 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -28,12 +30,20 @@
 #endif
 
 #include "esedb_test_libcerror.h"
+#include "esedb_test_libcsystem.h"
 #include "esedb_test_libesedb.h"
 #include "esedb_test_macros.h"
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_page.h"
+#include "../libesedb/libesedb_page_cache.h"
 #include "../libesedb/libesedb_page_tree.h"
+#include "../libesedb/libesedb_table.h"
+#include "../libesedb/libesedb_table_definition.h"
 
 #if defined( __GNUC__ )
 
@@ -75,23 +85,1082 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_page_tree_count_leaf_values function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_count_leaf_values(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	uint64_t number_of_leaf_values = 0;
+	int result                     = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_count_leaf_values(
+	          NULL,
+	          NULL,
+	          4,
+	          0,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_subtract_extents function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_subtract_extents(
+     void )
+{
+	uint32_t expected_extents[ 6 ]   = { 10, 2, 14, 4, 50, 3 };
+	uint32_t owned_extents[ 6 ]      = { 10, 10, 40, 5, 50, 4 };
+	uint32_t available_extents[ 10 ] = { 12, 2, 18, 5, 30, 3, 40, 5, 53, 1 };
+	libcerror_error_t *error         = NULL;
+	uint32_t *extents                = NULL;
+	int number_of_extents            = 0;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_page_tree_subtract_extents(
+	          owned_extents,
+	          3,
+	          available_extents,
+	          5,
+	          &extents,
+	          &number_of_extents,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "extents",
+	 extents );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 3 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          extents,
+	          expected_extents,
+	          sizeof( uint32_t ) * 6 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 extents );
+
+	extents = NULL;
+
+	/* Test that without available extents all the owned extents are in use
+	 */
+	result = libesedb_page_tree_subtract_extents(
+	          owned_extents,
+	          3,
+	          NULL,
+	          0,
+	          &extents,
+	          &number_of_extents,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 3 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          extents,
+	          owned_extents,
+	          sizeof( uint32_t ) * 6 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 extents );
+
+	extents = NULL;
+
+	/* Test that no extents remain when all the owned extents are available
+	 */
+	result = libesedb_page_tree_subtract_extents(
+	          owned_extents,
+	          3,
+	          owned_extents,
+	          3,
+	          &extents,
+	          &number_of_extents,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "extents",
+	 extents );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_subtract_extents(
+	          NULL,
+	          3,
+	          available_extents,
+	          5,
+	          &extents,
+	          &number_of_extents,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_subtract_extents(
+	          owned_extents,
+	          3,
+	          NULL,
+	          5,
+	          &extents,
+	          &number_of_extents,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_subtract_extents(
+	          owned_extents,
+	          3,
+	          available_extents,
+	          5,
+	          NULL,
+	          &number_of_extents,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_subtract_extents(
+	          owned_extents,
+	          3,
+	          available_extents,
+	          5,
+	          &extents,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extents != NULL )
+	{
+		memory_free(
+		 extents );
+	}
+	return( 0 );
+}
+
+/* Creates a page with single byte keys and stores it in the pages cache
+ * A key of 0 represents an empty key. The value of a parent page contains the child page
+ * number after the key, the value of a leaf page contains a single byte of data
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_set_page(
+     libesedb_io_handle_t *io_handle,
+     uint32_t page_number,
+     uint32_t page_flags,
+     uint32_t next_page_number,
+     const uint8_t *keys,
+     const uint8_t *value_flags,
+     const uint8_t *child_page_numbers,
+     uint16_t number_of_keys )
+{
+	libcerror_error_t *error = NULL;
+	libesedb_page_t *page    = NULL;
+	uint8_t *value_data      = NULL;
+	size_t tag_offset        = 0;
+	uint16_t key_index       = 0;
+	uint16_t value_offset    = 0;
+	int result               = 0;
+
+	result = libesedb_page_initialize(
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	page->data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * 4096 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page->data",
+	 page->data );
+
+	page->data_size = 4096;
+	page->offset    = (off64_t) ( page_number + 1 ) * 4096;
+
+	if( memory_set(
+	     page->data,
+	     0,
+	     sizeof( uint8_t ) * 4096 ) == NULL )
+	{
+		goto on_error;
+	}
+	/* The page header, the first page value is the empty page header value
+	 */
+	page->data[ 20 ] = (uint8_t) next_page_number;
+	page->data[ 34 ] = (uint8_t) ( number_of_keys + 1 );
+	page->data[ 36 ] = (uint8_t) page_flags;
+
+	for( key_index = 0;
+	     key_index < number_of_keys;
+	     key_index++ )
+	{
+		/* The page values are stored after the page header, 16 bytes apart
+		 */
+		value_offset = ( key_index + 1 ) * 16;
+		value_data   = &( page->data[ 40 + value_offset ] );
+		tag_offset   = 4096 - ( 4 * ( (size_t) key_index + 2 ) );
+
+		page->data[ tag_offset ]     = 8;
+		page->data[ tag_offset + 2 ] = (uint8_t) value_offset;
+		page->data[ tag_offset + 3 ] = (uint8_t) ( value_flags[ key_index ] << 5 );
+
+		if( keys[ key_index ] == 0 )
+		{
+			value_data += 2;
+		}
+		else
+		{
+			value_data[ 0 ] = 1;
+			value_data[ 2 ] = keys[ key_index ];
+			value_data     += 3;
+		}
+		if( child_page_numbers != NULL )
+		{
+			value_data[ 0 ] = child_page_numbers[ key_index ];
+		}
+		else
+		{
+			value_data[ 0 ] = 0xff;
+		}
+	}
+	result = libesedb_page_read_data(
+	          page,
+	          io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The reference of the pages cache
+	 */
+	page->number_of_references = 1;
+
+	result = libesedb_page_cache_set_page(
+	          io_handle->pages_cache,
+	          page_number,
+	          (intptr_t **) &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page != NULL )
+	{
+		libesedb_page_free(
+		 &page,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_get_child_page_number_by_key and libesedb_page_tree_seek_leaf_value functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_seek_leaf_value(
+     void )
+{
+	/* The root page 1 contains the separator key 'b' of leaf page 2, a defunct separator key
+	 * and the empty key of leaf page 3. The duplicate key 'b' is stored in both leaf pages
+	 */
+	uint8_t root_keys[ 3 ]               = { 'b', 'c', 0 };
+	uint8_t root_value_flags[ 3 ]        = { 0, LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT, 0 };
+	uint8_t root_child_page_numbers[ 3 ] = { 2, 3, 3 };
+	uint8_t leaf2_keys[ 2 ]              = { 'a', 'b' };
+	uint8_t leaf2_value_flags[ 2 ]       = { 0, 0 };
+	uint8_t leaf3_keys[ 3 ]              = { 'b', 'b', 'c' };
+	uint8_t leaf3_value_flags[ 3 ]       = { 0, LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT, 0 };
+	uint8_t key_data[ 1 ]                = { 'b' };
+	libcerror_error_t *error             = NULL;
+	libesedb_io_handle_t *io_handle      = NULL;
+	libesedb_page_t *page                = NULL;
+	libesedb_page_tree_t *page_tree      = NULL;
+	uint32_t child_page_number           = 0;
+	uint32_t leaf_page_number            = 0;
+	uint16_t leaf_value_index            = 0;
+	uint8_t is_exact_match               = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->page_size                  = 4096;
+	io_handle->last_page_number           = 16;
+	io_handle->checksum_verification_mode = LIBESEDB_CHECKSUM_VERIFICATION_MODE_NONE;
+
+	result = libesedb_page_cache_initialize(
+	          &( io_handle->pages_cache ),
+	          16,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_release_reference,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_page_tree_set_page(
+	          io_handle,
+	          1,
+	          LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_PARENT,
+	          0,
+	          root_keys,
+	          root_value_flags,
+	          root_child_page_numbers,
+	          3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = esedb_test_page_tree_set_page(
+	          io_handle,
+	          2,
+	          LIBESEDB_PAGE_FLAG_IS_LEAF,
+	          3,
+	          leaf2_keys,
+	          leaf2_value_flags,
+	          NULL,
+	          2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = esedb_test_page_tree_set_page(
+	          io_handle,
+	          3,
+	          LIBESEDB_PAGE_FLAG_IS_LEAF,
+	          0,
+	          leaf3_keys,
+	          leaf3_value_flags,
+	          NULL,
+	          3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libesedb_page_tree_initialize(
+	          &page_tree,
+	          io_handle,
+	          1,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that an exact match of a separator key selects the left child page
+	 */
+	result = libesedb_page_tree_get_page(
+	          page_tree,
+	          NULL,
+	          1,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_get_child_page_number_by_key(
+	          page_tree,
+	          page,
+	          key_data,
+	          1,
+	          &child_page_number,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "child_page_number",
+	 child_page_number,
+	 2 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a defunct separator key is skipped
+	 */
+	key_data[ 0 ] = 'c';
+
+	result = libesedb_page_tree_get_child_page_number_by_key(
+	          page_tree,
+	          page,
+	          key_data,
+	          1,
+	          &child_page_number,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "child_page_number",
+	 child_page_number,
+	 3 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_release(
+	          io_handle,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the first of the duplicate keys that span the separator is found
+	 */
+	key_data[ 0 ] = 'b';
+
+	result = libesedb_page_tree_seek_leaf_value(
+	          page_tree,
+	          NULL,
+	          1,
+	          key_data,
+	          1,
+	          &leaf_page_number,
+	          &leaf_value_index,
+	          &is_exact_match,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "leaf_page_number",
+	 leaf_page_number,
+	 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "leaf_value_index",
+	 (int) leaf_value_index,
+	 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "is_exact_match",
+	 (int) is_exact_match,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a key greater than the keys of the left child page is found in the next leaf page
+	 */
+	key_data[ 0 ] = 'c';
+
+	result = libesedb_page_tree_seek_leaf_value(
+	          page_tree,
+	          NULL,
+	          1,
+	          key_data,
+	          1,
+	          &leaf_page_number,
+	          &leaf_value_index,
+	          &is_exact_match,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "leaf_page_number",
+	 leaf_page_number,
+	 3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "leaf_value_index",
+	 (int) leaf_value_index,
+	 3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "is_exact_match",
+	 (int) is_exact_match,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a key greater than all the keys is not found
+	 */
+	key_data[ 0 ] = 'd';
+
+	result = libesedb_page_tree_seek_leaf_value(
+	          page_tree,
+	          NULL,
+	          1,
+	          key_data,
+	          1,
+	          &leaf_page_number,
+	          &leaf_value_index,
+	          &is_exact_match,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libesedb_page_tree_free(
+	          &page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page != NULL )
+	{
+		libesedb_page_release(
+		 io_handle,
+		 &page,
+		 NULL );
+	}
+	if( page_tree != NULL )
+	{
+		libesedb_page_tree_free(
+		 &page_tree,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_count_leaf_values function on a table
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_count_leaf_values_with_table(
+     libesedb_table_t *table )
+{
+	libcerror_error_t *error                  = NULL;
+	libesedb_internal_table_t *internal_table = NULL;
+	uint64_t number_of_leaf_values            = 0;
+	uint32_t root_page_number                 = 0;
+	int number_of_records                     = 0;
+	int result                                = 0;
+
+	if( table == NULL )
+	{
+		return( 0 );
+	}
+	internal_table   = (libesedb_internal_table_t *) table;
+	root_page_number = internal_table->table_definition->table_catalog_definition->father_data_page_number;
+
+	result = libesedb_table_get_number_of_records(
+	          table,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the number of leaf values equals the number of records of the table
+	 */
+	result = libesedb_page_tree_count_leaf_values(
+	          internal_table->table_page_tree,
+	          internal_table->file_io_handle,
+	          root_page_number,
+	          0,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_leaf_values",
+	 number_of_leaf_values,
+	 (uint64_t) number_of_records );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the number of leaf values can be estimated
+	 */
+	result = libesedb_page_tree_count_leaf_values(
+	          internal_table->table_page_tree,
+	          internal_table->file_io_handle,
+	          root_page_number,
+	          LIBESEDB_COUNT_FLAG_ESTIMATE,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_count_leaf_values(
+	          internal_table->table_page_tree,
+	          internal_table->file_io_handle,
+	          root_page_number,
+	          0,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_get_owned_page_extents function on a table
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_get_owned_page_extents_with_table(
+     libesedb_table_t *table )
+{
+	libcerror_error_t *error                  = NULL;
+	libesedb_internal_table_t *internal_table = NULL;
+	uint32_t *extents                         = NULL;
+	uint32_t first_page_number                = 0;
+	uint32_t next_page_number                 = 0;
+	uint32_t root_page_number                 = 0;
+	int extent_index                          = 0;
+	int number_of_extents                     = 0;
+	int root_page_in_extents                  = 0;
+	int result                                = 0;
+
+	if( table == NULL )
+	{
+		return( 0 );
+	}
+	internal_table   = (libesedb_internal_table_t *) table;
+	root_page_number = internal_table->table_definition->table_catalog_definition->father_data_page_number;
+
+	/* Test regular cases
+	 */
+	result = libesedb_page_tree_get_owned_page_extents(
+	          internal_table->table_page_tree,
+	          internal_table->file_io_handle,
+	          root_page_number,
+	          &extents,
+	          &number_of_extents,
+	          &error );
+
+	ESEDB_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result != 0 )
+	{
+		/* Test that the extents are sorted, do not overlap and contain the root page
+		 * which is in use
+		 */
+		for( extent_index = 0;
+		     extent_index < number_of_extents;
+		     extent_index++ )
+		{
+			first_page_number = extents[ extent_index * 2 ];
+
+			ESEDB_TEST_ASSERT_NOT_EQUAL_INT(
+			 "number_of_pages",
+			 (int) extents[ ( extent_index * 2 ) + 1 ],
+			 0 );
+
+			if( first_page_number < next_page_number )
+			{
+				fprintf(
+				 stdout,
+				 "%s:%d extent: %d overlaps previous extent\n",
+				 __FILE__,
+				 __LINE__,
+				 extent_index );
+
+				goto on_error;
+			}
+			next_page_number = first_page_number + extents[ ( extent_index * 2 ) + 1 ];
+
+			if( ( root_page_number >= first_page_number )
+			 && ( root_page_number < next_page_number ) )
+			{
+				root_page_in_extents = 1;
+			}
+		}
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "root_page_in_extents",
+		 root_page_in_extents,
+		 1 );
+
+		memory_free(
+		 extents );
+
+		extents = NULL;
+	}
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_get_owned_page_extents(
+	          NULL,
+	          internal_table->file_io_handle,
+	          root_page_number,
+	          &extents,
+	          &number_of_extents,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_owned_page_extents(
+	          internal_table->table_page_tree,
+	          internal_table->file_io_handle,
+	          root_page_number,
+	          NULL,
+	          &number_of_extents,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extents != NULL )
+	{
+		memory_free(
+		 extents );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) */
 
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 int wmain(
-     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     wchar_t * const argv[] )
 #else
 int main(
-     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     char * const argv[] )
 #endif
 {
-	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
-	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+	libcerror_error_t *error   = NULL;
+	libesedb_file_t *file      = NULL;
+	libesedb_table_t *table    = NULL;
+	system_character_t *source = NULL;
+	system_integer_t option    = 0;
+	int number_of_tables       = 0;
+	int result                 = 0;
 
+	while( ( option = libcsystem_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
 #if defined( __GNUC__ )
 
 	/* TODO: add tests for libesedb_page_tree_initialize */
@@ -110,11 +1179,190 @@ int main(
 
 	/* TODO: add tests for libesedb_page_tree_read_leaf_value */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_count_leaf_values",
+	 esedb_test_page_tree_count_leaf_values );
+
+	/* TODO: add tests for libesedb_page_tree_insert_extent */
+
+	/* TODO: add tests for libesedb_page_tree_read_space_tree_extents */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_subtract_extents",
+	 esedb_test_page_tree_subtract_extents );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_seek_leaf_value",
+	 esedb_test_page_tree_seek_leaf_value );
+
+#endif /* defined( __GNUC__ ) */
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		/* Initialize test
+		 */
+		result = libesedb_file_initialize(
+		          &file,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "file",
+		 file );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libesedb_file_open_wide(
+		          file,
+		          source,
+		          LIBESEDB_OPEN_READ,
+		          &error );
+#else
+		result = libesedb_file_open(
+		          file,
+		          source,
+		          LIBESEDB_OPEN_READ,
+		          &error );
+#endif
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_file_get_number_of_tables(
+		          file,
+		          &number_of_tables,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( number_of_tables > 0 )
+		{
+			result = libesedb_file_get_table(
+			          file,
+			          0,
+			          &table,
+			          &error );
+
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "table",
+			 table );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+#if defined( __GNUC__ )
+
+			ESEDB_TEST_RUN_WITH_ARGS(
+			 "libesedb_page_tree_count_leaf_values",
+			 esedb_test_page_tree_count_leaf_values_with_table,
+			 table );
+
+			ESEDB_TEST_RUN_WITH_ARGS(
+			 "libesedb_page_tree_get_owned_page_extents",
+			 esedb_test_page_tree_get_owned_page_extents_with_table,
+			 table );
+
 #endif /* defined( __GNUC__ ) */
 
+			/* Clean up
+			 */
+			result = libesedb_table_free(
+			          &table,
+			          &error );
+
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "table",
+			 table );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		/* Clean up
+		 */
+		result = libesedb_file_close(
+		          file,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_file_free(
+		          &file,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "file",
+		 file );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
 	return( EXIT_SUCCESS );
 
 on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( table != NULL )
+	{
+		libesedb_table_free(
+		 &table,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libesedb_file_free(
+		 &file,
+		 NULL );
+	}
 	return( EXIT_FAILURE );
 }
 
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,21 +34,1517 @@
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_data_definition.h"
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_page.h"
+#include "../libesedb/libesedb_page_cache.h"
 #include "../libesedb/libesedb_record.h"
+#include "../libesedb/libesedb_table_definition.h"
+
+/* Record data of a table with a fixed size column 1 and the tagged columns 256 to 511
+ * that contains the sparse tagged data types 256, 300, 301, 400 and 511
+ */
+uint8_t esedb_test_record_data1[ 52 ] = {
+	0x01, 0x7f, 0x08, 0x00, 0x78, 0x56, 0x34, 0x12, 0x00, 0x01, 0x14, 0x00, 0x2c, 0x01, 0x19, 0x00,
+	0x2d, 0x01, 0x1c, 0x00, 0x90, 0x01, 0x1e, 0x00, 0xff, 0x01, 0x22, 0x00, 0x66, 0x69, 0x72, 0x73,
+	0x74, 0x03, 0x00, 0x00, 0xaa, 0xbb, 0x01, 0x02, 0x03, 0x04, 0x6c, 0x61, 0x73, 0x74, 0x20, 0x76,
+	0x61, 0x6c, 0x75, 0x65 };
+
+/* Record data of the same table that contains the tagged data types 256, 300, 301, 400 and 511
+ * where 301 is a long value and 400 a multi value
+ */
+uint8_t esedb_test_record_data2[ 54 ] = {
+	0x01, 0x7f, 0x08, 0x00, 0x78, 0x56, 0x34, 0x12, 0x00, 0x01, 0x14, 0x00, 0x2c, 0x01, 0x19, 0x00,
+	0x2d, 0x01, 0x1c, 0x40, 0x90, 0x01, 0x1f, 0x40, 0xff, 0x01, 0x24, 0x00, 0x66, 0x69, 0x72, 0x73,
+	0x74, 0x03, 0x00, 0x00, 0x04, 0xaa, 0xbb, 0x08, 0x01, 0x02, 0x03, 0x04, 0x6c, 0x61, 0x73, 0x74,
+	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65 };
+
+/* Record data of the same table that only contains the tagged data types 300 and 400
+ */
+uint8_t esedb_test_record_data3[ 23 ] = {
+	0x01, 0x7f, 0x08, 0x00, 0x78, 0x56, 0x34, 0x12, 0x2c, 0x01, 0x08, 0x00, 0x90, 0x01, 0x0b, 0x00,
+	0x03, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04 };
 
 /* Tests the libesedb_record_free function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_record_free(
+int esedb_test_record_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_record_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        ESEDB_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ )
+
+/* Sets up the IO handle, table definition and data definition of a wide table
+ * with a single record stored in a cached page, shared by the record tests
+ * The table consists of the fixed size column 1 and the tagged columns 256 to 511
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_set_up_wide_table(
+     libesedb_io_handle_t **io_handle,
+     libesedb_table_definition_t **table_definition,
+     libesedb_data_definition_t **data_definition,
+     const uint8_t *record_data,
+     uint16_t record_data_size )
+{
+	libcerror_error_t *error                          = NULL;
+	libesedb_catalog_definition_t *catalog_definition = NULL;
+	libesedb_page_t *page                             = NULL;
+	uint32_t column_identifier                        = 0;
+	int result                                        = 0;
+
+	result = libesedb_io_handle_initialize(
+	          io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 *io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( *io_handle )->format_version   = 0x620;
+	( *io_handle )->format_revision  = 0x0c;
+	( *io_handle )->page_size        = 8192;
+	( *io_handle )->last_page_number = 1;
+
+	result = libesedb_page_cache_initialize(
+	          &( ( *io_handle )->pages_cache ),
+	          4,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_release_reference,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The record is the only value of page 1
+	 */
+	result = libesedb_page_initialize(
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page",
+	 page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	page->page_number = 1;
+
+	page->data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * record_data_size );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page->data",
+	 page->data );
+
+	if( memory_copy(
+	     page->data,
+	     record_data,
+	     record_data_size ) == NULL )
+	{
+		goto on_error;
+	}
+	page->data_size = record_data_size;
+
+	page->values = (libesedb_page_value_t *) memory_allocate(
+	                                          sizeof( libesedb_page_value_t ) );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page->values",
+	 page->values );
+
+	if( memory_set(
+	     page->values,
+	     0,
+	     sizeof( libesedb_page_value_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	page->values[ 0 ].data = page->data;
+	page->values[ 0 ].size = record_data_size;
+	page->number_of_values = 1;
+
+	/* The reference of the pages cache
+	 */
+	page->number_of_references = 1;
+
+	result = libesedb_page_cache_set_page(
+	          ( *io_handle )->pages_cache,
+	          1,
+	          (intptr_t **) &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The page is managed by the pages cache
+	 */
+	page = NULL;
+
+	/* The table consists of the fixed size column 1 and the tagged columns 256 to 511
+	 */
+	result = libesedb_catalog_definition_initialize(
+	          &catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	catalog_definition->type = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+
+	result = libesedb_table_definition_initialize(
+	          table_definition,
+	          catalog_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition",
+	 *table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	catalog_definition = NULL;
+
+	for( column_identifier = 1;
+	     column_identifier <= 511;
+	     column_identifier++ )
+	{
+		if( ( column_identifier > 1 )
+		 && ( column_identifier < 256 ) )
+		{
+			continue;
+		}
+		result = libesedb_catalog_definition_initialize(
+		          &catalog_definition,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		catalog_definition->type       = LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN;
+		catalog_definition->identifier = column_identifier;
+
+		if( column_identifier == 1 )
+		{
+			catalog_definition->column_type = LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED;
+			catalog_definition->size        = 4;
+		}
+		else
+		{
+			catalog_definition->column_type = LIBESEDB_COLUMN_TYPE_BINARY_DATA;
+		}
+		result = libesedb_table_definition_append_column_catalog_definition(
+		          *table_definition,
+		          catalog_definition,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		catalog_definition = NULL;
+	}
+	result = libesedb_table_definition_build_record_layout(
+	          *table_definition,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_data_definition_initialize(
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_definition",
+	 *data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( *data_definition )->page_number      = 1;
+	( *data_definition )->page_value_index = 0;
+	( *data_definition )->data_offset      = 0;
+	( *data_definition )->data_size        = record_data_size;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &catalog_definition,
+		 NULL );
+	}
+	if( page != NULL )
+	{
+		libesedb_page_free(
+		 &page,
+		 NULL );
+	}
+	if( *data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 data_definition,
+		 NULL );
+	}
+	if( *table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 table_definition,
+		 NULL );
+	}
+	if( *io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Frees the IO handle, table definition and data definition of a wide table
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_tear_down_wide_table(
+     libesedb_io_handle_t **io_handle,
+     libesedb_table_definition_t **table_definition,
+     libesedb_data_definition_t **data_definition )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	result = libesedb_data_definition_free(
+	          data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_definition_free(
+	          table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_record_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_initialize(
+     void )
+{
+	uint8_t column_mask[ 257 ];
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error                      = NULL;
+	libesedb_data_definition_t *data_definition   = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_record_t *record                     = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	size_t value_data_size                        = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_record_set_up_wide_table(
+	          &io_handle,
+	          &table_definition,
+	          &data_definition,
+	          esedb_test_record_data1,
+	          52 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 * The column mask contains the first tagged data type (256), an absent tagged data type (350)
+	 * and the last tagged data type (511), which are looked up using a binary search
+	 */
+	if( memory_set(
+	     column_mask,
+	     0,
+	     sizeof( uint8_t ) * 257 ) == NULL )
+	{
+		goto on_error;
+	}
+	column_mask[ 1 ]   = 1;
+	column_mask[ 95 ]  = 1;
+	column_mask[ 256 ] = 1;
+
+	result = libesedb_record_initialize(
+	          &record,
+	          NULL,
+	          io_handle,
+	          table_definition,
+	          NULL,
+	          column_mask,
+	          257,
+	          data_definition,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The first tagged data type
+	 */
+	result = libesedb_record_get_value_binary_data_size(
+	          record,
+	          1,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_data_size",
+	 value_data_size,
+	 (size_t) 5 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_get_value_binary_data(
+	          record,
+	          1,
+	          value_data,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          value_data,
+	          &( esedb_test_record_data1[ 28 ] ),
+	          5 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The last tagged data type, its size is determined by the end of the record data
+	 */
+	result = libesedb_record_get_value_binary_data_size(
+	          record,
+	          256,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_data_size",
+	 value_data_size,
+	 (size_t) 10 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_get_value_binary_data(
+	          record,
+	          256,
+	          value_data,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          value_data,
+	          &( esedb_test_record_data1[ 42 ] ),
+	          10 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The absent tagged data type has no value
+	 */
+	result = libesedb_record_get_value_binary_data_size(
+	          record,
+	          95,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The tagged data type (300) and the fixed size data type (1) are not in the column mask
+	 */
+	result = libesedb_record_get_value_binary_data_size(
+	          record,
+	          45,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_get_value_data_size(
+	          record,
+	          0,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_free(
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Without a column mask the tagged data types are read sequentially
+	 */
+	result = libesedb_record_initialize(
+	          &record,
+	          NULL,
+	          io_handle,
+	          table_definition,
+	          NULL,
+	          NULL,
+	          0,
+	          data_definition,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_get_value_binary_data_size(
+	          record,
+	          45,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_data_size",
+	 value_data_size,
+	 (size_t) 3 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_get_value_binary_data_size(
+	          record,
+	          256,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_data_size",
+	 value_data_size,
+	 (size_t) 10 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_get_value_binary_data_size(
+	          record,
+	          95,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_free(
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_record_initialize(
+	          NULL,
+	          NULL,
+	          io_handle,
+	          table_definition,
+	          NULL,
+	          NULL,
+	          0,
+	          data_definition,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record = (libesedb_record_t *) 0x12345678UL;
+
+	result = libesedb_record_initialize(
+	          &record,
+	          NULL,
+	          io_handle,
+	          table_definition,
+	          NULL,
+	          NULL,
+	          0,
+	          data_definition,
+	          NULL,
+	          NULL,
+	          &error );
+
+	record = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_initialize(
+	          &record,
+	          NULL,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          data_definition,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The size of the column mask must match the number of columns
+	 */
+	result = libesedb_record_initialize(
+	          &record,
+	          NULL,
+	          io_handle,
+	          table_definition,
+	          NULL,
+	          column_mask,
+	          256,
+	          data_definition,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_record_tear_down_wide_table(
+	          &io_handle,
+	          &table_definition,
+	          &data_definition );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_record_initialize function with a column mask
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_initialize_with_column_mask(
+     void )
+{
+	/* The value entries of the tagged data types 256, 300, 350, 400 and 511
+	 */
+	int value_entries[ 5 ]          = { 1, 45, 95, 145, 256 };
+	int expected_results[ 5 ]       = { 0, 1, 0, 1, 0 };
+	size_t expected_data_sizes[ 5 ] = { 0, 3, 0, 4, 0 };
+
+	uint8_t column_mask[ 257 ];
+
+	libcerror_error_t *error                      = NULL;
+	libesedb_data_definition_t *data_definition   = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_record_t *record                     = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	size_t value_data_size                        = 0;
+	int result                                    = 0;
+	int value_entry_index                         = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_record_set_up_wide_table(
+	          &io_handle,
+	          &table_definition,
+	          &data_definition,
+	          esedb_test_record_data3,
+	          23 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	if( memory_set(
+	     column_mask,
+	     0,
+	     sizeof( uint8_t ) * 257 ) == NULL )
+	{
+		goto on_error;
+	}
+	for( value_entry_index = 0;
+	     value_entry_index < 5;
+	     value_entry_index++ )
+	{
+		column_mask[ value_entries[ value_entry_index ] ] = 1;
+	}
+	result = libesedb_record_initialize(
+	          &record,
+	          NULL,
+	          io_handle,
+	          table_definition,
+	          NULL,
+	          column_mask,
+	          257,
+	          data_definition,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the binary search finds the first (300) and the last (400) tagged data type
+	 * and does not find the tagged data types before (256), between (350) and after (511) these
+	 */
+	for( value_entry_index = 0;
+	     value_entry_index < 5;
+	     value_entry_index++ )
+	{
+		result = libesedb_record_get_value_binary_data_size(
+		          record,
+		          value_entries[ value_entry_index ],
+		          &value_data_size,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 expected_results[ value_entry_index ] );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 1 )
+		{
+			ESEDB_TEST_ASSERT_EQUAL_SIZE(
+			 "value_data_size",
+			 value_data_size,
+			 expected_data_sizes[ value_entry_index ] );
+		}
+	}
+	result = libesedb_record_free(
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a tagged data type that is hidden by the column mask is not read
+	 * while the tagged data type after it still is
+	 */
+	column_mask[ 1 ]   = 0;
+	column_mask[ 45 ]  = 0;
+	column_mask[ 95 ]  = 0;
+	column_mask[ 256 ] = 0;
+
+	result = libesedb_record_initialize(
+	          &record,
+	          NULL,
+	          io_handle,
+	          table_definition,
+	          NULL,
+	          column_mask,
+	          257,
+	          data_definition,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_record_get_value_binary_data_size(
+	          record,
+	          45,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_get_value_binary_data_size(
+	          record,
+	          145,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_data_size",
+	 value_data_size,
+	 (size_t) 4 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libesedb_record_free(
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_record_tear_down_wide_table(
+	          &io_handle,
+	          &table_definition,
+	          &data_definition );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_record_get_value_data_pointer function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_get_value_data_pointer(
      void )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	int value_entries[ 4 ] = { 1, 45, 145, 256 };
+
+	uint8_t column_mask[ 257 ];
+	uint8_t value_data[ 16 ];
+
+	libcerror_error_t *error                      = NULL;
+	libesedb_data_definition_t *data_definition   = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_record_t *record                     = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	const uint8_t *value_data_pointer             = NULL;
+	size_t value_data_pointer_size                = 0;
+	size_t value_data_size                        = 0;
+	int result                                    = 0;
+	int value_entry_index                         = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_record_set_up_wide_table(
+	          &io_handle,
+	          &table_definition,
+	          &data_definition,
+	          esedb_test_record_data1,
+	          52 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	if( memory_set(
+	     column_mask,
+	     0,
+	     sizeof( uint8_t ) * 257 ) == NULL )
+	{
+		goto on_error;
+	}
+	for( value_entry_index = 0;
+	     value_entry_index < 4;
+	     value_entry_index++ )
+	{
+		column_mask[ value_entries[ value_entry_index ] ] = 1;
+	}
+	result = libesedb_record_initialize(
+	          &record,
+	          NULL,
+	          io_handle,
+	          table_definition,
+	          NULL,
+	          column_mask,
+	          257,
+	          data_definition,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
+	/* Test regular cases
+	 * The value data pointer references the same data as the copied value data
+	 */
+	for( value_entry_index = 0;
+	     value_entry_index < 4;
+	     value_entry_index++ )
+	{
+		result = libesedb_record_get_value_data_size(
+		          record,
+		          value_entries[ value_entry_index ],
+		          &value_data_size,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_record_get_value_data(
+		          record,
+		          value_entries[ value_entry_index ],
+		          value_data,
+		          16,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_record_get_value_data_pointer(
+		          record,
+		          value_entries[ value_entry_index ],
+		          &value_data_pointer,
+		          &value_data_pointer_size,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "value_data_pointer",
+		 value_data_pointer );
+
+		ESEDB_TEST_ASSERT_EQUAL_SIZE(
+		 "value_data_pointer_size",
+		 value_data_pointer_size,
+		 value_data_size );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          value_data_pointer,
+		          value_data,
+		          value_data_size );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
 	/* Test error cases
 	 */
+	result = libesedb_record_get_value_data_pointer(
+	          NULL,
+	          1,
+	          &value_data_pointer,
+	          &value_data_pointer_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_get_value_data_pointer(
+	          record,
+	          1,
+	          NULL,
+	          &value_data_pointer_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_get_value_data_pointer(
+	          record,
+	          1,
+	          &value_data_pointer,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The fixed size data type (1) is not in the column mask
+	 */
+	result = libesedb_record_get_value_data_pointer(
+	          record,
+	          0,
+	          &value_data_pointer,
+	          &value_data_pointer_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_get_value_data_pointer(
+	          record,
+	          257,
+	          &value_data_pointer,
+	          &value_data_pointer_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
 	result = libesedb_record_free(
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_record_tear_down_wide_table(
+	          &io_handle,
+	          &table_definition,
+	          &data_definition );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test that the value data of long values and multi values cannot be referenced
+	 */
+	result = esedb_test_record_set_up_wide_table(
+	          &io_handle,
+	          &table_definition,
+	          &data_definition,
+	          esedb_test_record_data2,
+	          54 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libesedb_record_initialize(
+	          &record,
+	          NULL,
+	          io_handle,
+	          table_definition,
+	          NULL,
+	          NULL,
+	          0,
+	          data_definition,
 	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The tagged data type 300 is neither a long value nor a multi value
+	 */
+	result = libesedb_record_get_value_data_pointer(
+	          record,
+	          45,
+	          &value_data_pointer,
+	          &value_data_pointer_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_data_pointer_size",
+	 value_data_pointer_size,
+	 (size_t) 3 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The tagged data type 301 is a long value
+	 */
+	result = libesedb_record_get_value_data_pointer(
+	          record,
+	          46,
+	          &value_data_pointer,
+	          &value_data_pointer_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -55,13 +1552,59 @@ int esedb_test_record_free(
 	 result,
 	 -1 );
 
-        ESEDB_TEST_ASSERT_IS_NOT_NULL(
-         "error",
-         error );
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The tagged data type 400 is a multi value
+	 */
+	result = libesedb_record_get_value_data_pointer(
+	          record,
+	          145,
+	          &value_data_pointer,
+	          &value_data_pointer_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	result = libesedb_record_free(
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_record_tear_down_wide_table(
+	          &io_handle,
+	          &table_definition,
+	          &data_definition );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
 	return( 1 );
 
 on_error:
@@ -70,11 +1613,33 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
+	if( table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 &table_definition,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
 	return( 0 );
 }
 
-#if defined( __GNUC__ )
-
 #endif /* defined( __GNUC__ ) */
 
 /* The main program
@@ -94,7 +1659,13 @@ int main(
 
 #if defined( __GNUC__ )
 
-	/* TODO: add tests for libesedb_record_initialize */
+	ESEDB_TEST_RUN(
+	 "libesedb_record_initialize",
+	 esedb_test_record_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_initialize_with_column_mask",
+	 esedb_test_record_initialize_with_column_mask );
 
 #endif /* defined( __GNUC__ ) */
 
@@ -110,6 +1681,8 @@ int main(
 
 	/* TODO: add tests for libesedb_record_get_column_identifier */
 
+	/* TODO: add tests for libesedb_record_get_value_entry_by_column_identifier */
+
 	/* TODO: add tests for libesedb_record_get_column_type */
 
 	/* TODO: add tests for libesedb_record_get_utf8_column_name_size */
@@ -126,6 +1699,10 @@ int main(
 
 	/* TODO: add tests for libesedb_record_get_value_data */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_record_get_value_data_pointer",
+	 esedb_test_record_get_value_data_pointer );
+
 	/* TODO: add tests for libesedb_record_get_value_data_flags */
 
 	/* TODO: add tests for libesedb_record_get_value_boolean */
@@ -0,0 +1,294 @@
+/*
+ * Library record layout type testing program
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_record_layout.h"
+
+#if defined( __GNUC__ )
+
+/* Tests the libesedb_record_layout_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_layout_initialize(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libesedb_record_layout_t *record_layout = NULL;
+	int result                              = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_record_layout_initialize(
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_layout = (libesedb_record_layout_t *) 0x12345678UL;
+
+	result = libesedb_record_layout_initialize(
+	          &record_layout,
+	          NULL,
+	          NULL,
+	          &error );
+
+	record_layout = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_layout_initialize(
+	          &record_layout,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record_layout",
+	 record_layout );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_layout != NULL )
+	{
+		libesedb_record_layout_free(
+		 &record_layout,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_record_layout_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_layout_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_record_layout_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_record_layout_set_column function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_layout_set_column(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	uint32_t fixed_size_offset = 0;
+	int result                 = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_record_layout_set_column(
+	          NULL,
+	          0,
+	          NULL,
+	          &fixed_size_offset,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_record_layout_get_column_entry_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_record_layout_get_column_entry_by_identifier(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int column_entry         = 0;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_record_layout_get_column_entry_by_identifier(
+	          NULL,
+	          256,
+	          &column_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_layout_initialize",
+	 esedb_test_record_layout_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_layout_free",
+	 esedb_test_record_layout_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_layout_set_column",
+	 esedb_test_record_layout_set_column );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_record_layout_get_column_entry_by_identifier",
+	 esedb_test_record_layout_get_column_entry_by_identifier );
+
+#endif /* defined( __GNUC__ ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
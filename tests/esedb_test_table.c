@@ -21,6 +21,8 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -28,13 +30,151 @@
 #endif
 
 #include "esedb_test_libcerror.h"
+#include "esedb_test_libcsystem.h"
 #include "esedb_test_libesedb.h"
 #include "esedb_test_macros.h"
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_file.h"
 #include "../libesedb/libesedb_table.h"
 
+#if defined( __GNUC__ )
+
+/* Tests the libesedb_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_initialize(
+     libesedb_file_t *file,
+     libesedb_table_t *table )
+{
+	libcerror_error_t *error                  = NULL;
+	libesedb_internal_file_t *internal_file   = NULL;
+	libesedb_internal_table_t *internal_table = NULL;
+	libesedb_table_t *shared_table            = NULL;
+	int result                                = 0;
+
+	if( ( file == NULL )
+	 || ( table == NULL ) )
+	{
+		return( 0 );
+	}
+	internal_file  = (libesedb_internal_file_t *) file;
+	internal_table = (libesedb_internal_table_t *) table;
+
+	/* Test that the table reads its pages using the pages cache of the file
+	 */
+	if( internal_table->io_handle != internal_file->io_handle )
+	{
+		fprintf(
+		 stdout,
+		 "%s:%d internal_table->io_handle != internal_file->io_handle\n",
+		 __FILE__,
+		 __LINE__ );
+
+		goto on_error;
+	}
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_file->io_handle->pages_cache",
+	 internal_file->io_handle->pages_cache );
+
+	/* Test regular cases
+	 */
+	result = libesedb_table_initialize(
+	          &shared_table,
+	          internal_file->file_io_handle,
+	          internal_file->io_handle,
+	          internal_table->table_definition,
+	          internal_table->template_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "shared_table",
+	 shared_table );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( ( (libesedb_internal_table_t *) shared_table )->io_handle != internal_table->io_handle )
+	{
+		fprintf(
+		 stdout,
+		 "%s:%d shared_table io_handle differs from table\n",
+		 __FILE__,
+		 __LINE__ );
+
+		goto on_error;
+	}
+	/* Freeing the table should not free the pages cache of the file
+	 */
+	result = libesedb_table_free(
+	          &shared_table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "shared_table",
+	 shared_table );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_file->io_handle->pages_cache",
+	 internal_file->io_handle->pages_cache );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_initialize(
+	          NULL,
+	          internal_file->file_io_handle,
+	          internal_file->io_handle,
+	          internal_table->table_definition,
+	          internal_table->template_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( shared_table != NULL )
+	{
+		libesedb_table_free(
+		 &shared_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
 /* Tests the libesedb_table_free function
  * Returns 1 if successful or 0 if not
  */
@@ -73,72 +213,756 @@ on_error:
 	return( 0 );
 }
 
-#if defined( __GNUC__ )
+/* Tests the libesedb_table_set_column_projection function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_set_column_projection(
+     libesedb_table_t *table )
+{
+	uint32_t column_identifiers[ 1 ];
+
+	libcerror_error_t *error         = NULL;
+	libesedb_column_t *column        = NULL;
+	libesedb_record_t *record        = NULL;
+	const uint8_t *value_data        = NULL;
+	uint8_t *reference_value_data    = NULL;
+	size_t reference_value_data_size = 0;
+	size_t value_data_size           = 0;
+	uint32_t first_column_identifier = 0;
+	uint32_t last_column_identifier  = 0;
+	uint8_t value_data_flags         = 0;
+	int number_of_columns            = 0;
+	int number_of_records            = 0;
+	int result                       = 0;
+
+	if( table == NULL )
+	{
+		return( 0 );
+	}
+	result = libesedb_table_get_number_of_columns(
+	          table,
+	          &number_of_columns,
+	          0,
+	          &error );
 
-#endif /* defined( __GNUC__ ) */
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libesedb_table_get_number_of_records(
+	          table,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	if( ( number_of_columns < 2 )
+	 || ( number_of_records == 0 ) )
+	{
+		return( 1 );
+	}
+	/* Determine the identifiers of the first and the last column
+	 */
+	result = libesedb_table_get_column(
+	          table,
+	          0,
+	          &column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        ESEDB_TEST_ASSERT_IS_NOT_NULL(
+         "column",
+         column );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libesedb_column_get_identifier(
+	          column,
+	          &first_column_identifier,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libesedb_column_free(
+	          &column,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libesedb_table_get_column(
+	          table,
+	          number_of_columns - 1,
+	          &column,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        ESEDB_TEST_ASSERT_IS_NOT_NULL(
+         "column",
+         column );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libesedb_column_get_identifier(
+	          column,
+	          &last_column_identifier,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libesedb_column_free(
+	          &column,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* The value of an unprojected fixed or variable size column is not read
+	 */
+	if( first_column_identifier > 255 )
+	{
+		return( 1 );
+	}
+	/* Read the value of the last column without a projection as reference
+	 */
+	result = libesedb_table_get_record(
+	          table,
+	          0,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        ESEDB_TEST_ASSERT_IS_NOT_NULL(
+         "record",
+         record );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libesedb_record_get_value_data_flags(
+	          record,
+	          number_of_columns - 1,
+	          &value_data_flags,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* The value data of long values and multi values cannot be referenced
+	 */
+	if( ( value_data_flags & ( LIBESEDB_VALUE_FLAG_LONG_VALUE | LIBESEDB_VALUE_FLAG_MULTI_VALUE ) ) != 0 )
+	{
+		result = libesedb_record_free(
+		          &record,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		return( 1 );
+	}
+	result = libesedb_record_get_value_data_pointer(
+	          record,
+	          number_of_columns - 1,
+	          &value_data,
+	          &reference_value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	if( reference_value_data_size > 0 )
+	{
+		reference_value_data = (uint8_t *) memory_allocate(
+		                                    sizeof( uint8_t ) * reference_value_data_size );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "reference_value_data",
+		 reference_value_data );
+
+		if( memory_copy(
+		     reference_value_data,
+		     value_data,
+		     reference_value_data_size ) == NULL )
+		{
+			goto on_error;
+		}
+	}
+	result = libesedb_record_free(
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test regular cases
+	 */
+	column_identifiers[ 0 ] = last_column_identifier;
+
+	result = libesedb_table_set_column_projection(
+	          table,
+	          column_identifiers,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libesedb_table_get_record(
+	          table,
+	          0,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        ESEDB_TEST_ASSERT_IS_NOT_NULL(
+         "record",
+         record );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* The value of a projected column is readable
+	 */
+	result = libesedb_record_get_value_data_pointer(
+	          record,
+	          number_of_columns - 1,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_data_size",
+	 value_data_size,
+	 reference_value_data_size );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	if( reference_value_data_size > 0 )
+	{
+		result = memory_compare(
+		          value_data,
+		          reference_value_data,
+		          reference_value_data_size );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* The value of a column that is not projected cannot be read
+	 */
+	result = libesedb_record_get_value_data_size(
+	          record,
+	          0,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        ESEDB_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_record_free(
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Reset the projection to all columns
+	 */
+	result = libesedb_table_set_column_projection(
+	          table,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libesedb_table_get_record(
+	          table,
+	          0,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        ESEDB_TEST_ASSERT_IS_NOT_NULL(
+         "record",
+         record );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libesedb_record_get_value_data_size(
+	          record,
+	          0,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	result = libesedb_record_free(
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+        ESEDB_TEST_ASSERT_IS_NULL(
+         "error",
+         error );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_set_column_projection(
+	          NULL,
+	          column_identifiers,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        ESEDB_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an unknown column identifier
+	 */
+	column_identifiers[ 0 ] = 0xfffffff0UL;
+
+	result = libesedb_table_set_column_projection(
+	          table,
+	          column_identifiers,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+        ESEDB_TEST_ASSERT_IS_NOT_NULL(
+         "error",
+         error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( reference_value_data != NULL )
+	{
+		memory_free(
+		 reference_value_data );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( column != NULL )
+	{
+		libesedb_column_free(
+		 &column,
+		 NULL );
+	}
+	if( reference_value_data != NULL )
+	{
+		memory_free(
+		 reference_value_data );
+	}
+	return( 0 );
+}
 
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 int wmain(
-     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     wchar_t * const argv[] )
 #else
 int main(
-     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     char * const argv[] )
 #endif
 {
-	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
-	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+	libcerror_error_t *error   = NULL;
+	libesedb_file_t *file      = NULL;
+	libesedb_table_t *table    = NULL;
+	system_character_t *source = NULL;
+	system_integer_t option    = 0;
+	int number_of_tables       = 0;
+	int result                 = 0;
+
+	while( ( option = libcsystem_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	ESEDB_TEST_RUN(
+	 "libesedb_table_free",
+	 esedb_test_table_free );
 
-#if defined( __GNUC__ )
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		/* Initialize test
+		 */
+		result = libesedb_file_initialize(
+		          &file,
+		          &error );
 
-	/* TODO: add tests for libesedb_table_initialize */
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-#endif /* defined( __GNUC__ ) */
+	        ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	         "file",
+	         file );
 
-	ESEDB_TEST_RUN(
-	 "libesedb_table_free",
-	 esedb_test_table_free );
+	        ESEDB_TEST_ASSERT_IS_NULL(
+	         "error",
+	         error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libesedb_file_open_wide(
+		          file,
+		          source,
+		          LIBESEDB_OPEN_READ,
+		          &error );
+#else
+		result = libesedb_file_open(
+		          file,
+		          source,
+		          LIBESEDB_OPEN_READ,
+		          &error );
+#endif
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+	        ESEDB_TEST_ASSERT_IS_NULL(
+	         "error",
+	         error );
+
+		result = libesedb_file_get_number_of_tables(
+		          file,
+		          &number_of_tables,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+	        ESEDB_TEST_ASSERT_IS_NULL(
+	         "error",
+	         error );
+
+		if( number_of_tables > 0 )
+		{
+			result = libesedb_file_get_table(
+			          file,
+			          0,
+			          &table,
+			          &error );
+
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+		        ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		         "table",
+		         table );
+
+		        ESEDB_TEST_ASSERT_IS_NULL(
+		         "error",
+		         error );
 
 #if defined( __GNUC__ )
 
-	/* TODO: add tests for libesedb_table_get_identifier */
+			ESEDB_TEST_RUN_WITH_ARGS(
+			 "libesedb_table_initialize",
+			 esedb_test_table_initialize,
+			 file,
+			 table );
+
+			/* TODO: add tests for libesedb_table_get_identifier */
 
-	/* TODO: add tests for libesedb_table_get_utf8_name_size */
+			/* TODO: add tests for libesedb_table_get_utf8_name_size */
 
-	/* TODO: add tests for libesedb_table_get_utf8_name */
+			/* TODO: add tests for libesedb_table_get_utf8_name */
 
-	/* TODO: add tests for libesedb_table_get_utf16_name_size */
+			/* TODO: add tests for libesedb_table_get_utf16_name_size */
 
-	/* TODO: add tests for libesedb_table_get_utf16_name */
+			/* TODO: add tests for libesedb_table_get_utf16_name */
 
-	/* TODO: add tests for libesedb_table_get_utf8_template_name_size */
+			/* TODO: add tests for libesedb_table_get_utf8_template_name_size */
 
-	/* TODO: add tests for libesedb_table_get_utf8_template_name */
+			/* TODO: add tests for libesedb_table_get_utf8_template_name */
 
-	/* TODO: add tests for libesedb_table_get_utf16_template_name_size */
+			/* TODO: add tests for libesedb_table_get_utf16_template_name_size */
 
-	/* TODO: add tests for libesedb_table_get_utf16_template_name */
+			/* TODO: add tests for libesedb_table_get_utf16_template_name */
 
-	/* TODO: add tests for libesedb_table_get_number_of_columns */
+			/* TODO: add tests for libesedb_table_get_number_of_columns */
 
-	/* TODO: add tests for libesedb_table_get_column */
+			/* TODO: add tests for libesedb_table_get_column */
 
-	/* TODO: add tests for libesedb_table_get_number_of_indexes */
+			/* TODO: add tests for libesedb_table_get_number_of_indexes */
 
-	/* TODO: add tests for libesedb_table_get_index */
+			/* TODO: add tests for libesedb_table_get_index */
 
-	/* TODO: add tests for libesedb_table_get_number_of_records */
+			/* TODO: add tests for libesedb_table_get_number_of_records */
 
-	/* TODO: add tests for libesedb_table_get_record */
+			/* TODO: add tests for libesedb_table_get_record */
 
 #endif /* defined( __GNUC__ ) */
 
+			ESEDB_TEST_RUN_WITH_ARGS(
+			 "libesedb_table_set_column_projection",
+			 esedb_test_table_set_column_projection,
+			 table );
+
+			/* Clean up
+			 */
+			result = libesedb_table_free(
+			          &table,
+			          &error );
+
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+		         "table",
+		         table );
+
+		        ESEDB_TEST_ASSERT_IS_NULL(
+		         "error",
+		         error );
+		}
+		/* Clean up
+		 */
+		result = libesedb_file_close(
+		          file,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+	        ESEDB_TEST_ASSERT_IS_NULL(
+	         "error",
+	         error );
+
+		result = libesedb_file_free(
+		          &file,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+	         "file",
+	         file );
+
+	        ESEDB_TEST_ASSERT_IS_NULL(
+	         "error",
+	         error );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
 	return( EXIT_SUCCESS );
 
 on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( table != NULL )
+	{
+		libesedb_table_free(
+		 &table,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libesedb_file_free(
+		 &file,
+		 NULL );
+	}
 	return( EXIT_FAILURE );
 }
 
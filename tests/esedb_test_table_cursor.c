@@ -0,0 +1,1599 @@
+/*
+ * Library table_cursor type testing program
+ *
+ * Copyright (C) 2009-2016, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This software is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libcsystem.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_page_tree.h"
+#include "../libesedb/libesedb_table.h"
+#include "../libesedb/libesedb_table_cursor.h"
+#include "../libesedb/libesedb_table_definition.h"
+
+/* Tests the libesedb_table_cursor_open function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_cursor_open(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libesedb_table_cursor_t *cursor = NULL;
+	int result                      = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_table_cursor_open(
+	          NULL,
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "cursor",
+	 cursor );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_table_partition_cursor_open function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_partition_cursor_open(
+     void )
+{
+	uint32_t partition_page_numbers[ 2 ] = { 4, 12 };
+	libcerror_error_t *error             = NULL;
+	libesedb_table_cursor_t *cursor      = NULL;
+	int result                           = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_table_partition_cursor_open(
+	          NULL,
+	          partition_page_numbers,
+	          2,
+	          0,
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "cursor",
+	 cursor );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_partition_cursor_open(
+	          NULL,
+	          NULL,
+	          2,
+	          0,
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "cursor",
+	 cursor );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_partition_cursor_open(
+	          NULL,
+	          partition_page_numbers,
+	          2,
+	          2,
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "cursor",
+	 cursor );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_partition_cursor_open(
+	          NULL,
+	          partition_page_numbers,
+	          2,
+	          -1,
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "cursor",
+	 cursor );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_table_cursor_close function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_cursor_close(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libesedb_table_cursor_t *cursor = NULL;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_table_cursor_close(
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_cursor_close(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_table_cursor_next function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_cursor_next(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libesedb_record_t *record = NULL;
+	int result                = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_table_cursor_next(
+	          NULL,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_table_cursor_seek function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_cursor_seek(
+     void )
+{
+	uint8_t key_data[ 4 ]    = { 0x7f, 0x80, 0x00, 0x01 };
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_table_cursor_seek(
+	          NULL,
+	          key_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Compares the values of two records
+ * Returns 1 if the records are equal, 0 if not or -1 on error
+ */
+int esedb_test_table_cursor_compare_records(
+     libesedb_record_t *record1,
+     libesedb_record_t *record2 )
+{
+	const uint8_t *value_data1 = NULL;
+	const uint8_t *value_data2 = NULL;
+	size_t value_data_size1    = 0;
+	size_t value_data_size2    = 0;
+	uint8_t value_data_flags1  = 0;
+	uint8_t value_data_flags2  = 0;
+	int number_of_values1      = 0;
+	int number_of_values2      = 0;
+	int value_entry            = 0;
+
+	if( libesedb_record_get_number_of_values(
+	     record1,
+	     &number_of_values1,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libesedb_record_get_number_of_values(
+	     record2,
+	     &number_of_values2,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( number_of_values1 != number_of_values2 )
+	{
+		return( 0 );
+	}
+	for( value_entry = 0;
+	     value_entry < number_of_values1;
+	     value_entry++ )
+	{
+		if( libesedb_record_get_value_data_flags(
+		     record1,
+		     value_entry,
+		     &value_data_flags1,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		if( libesedb_record_get_value_data_flags(
+		     record2,
+		     value_entry,
+		     &value_data_flags2,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		if( value_data_flags1 != value_data_flags2 )
+		{
+			return( 0 );
+		}
+		/* The value data of long values and multi values cannot be referenced
+		 */
+		if( ( value_data_flags1 & ( LIBESEDB_VALUE_FLAG_LONG_VALUE | LIBESEDB_VALUE_FLAG_MULTI_VALUE ) ) != 0 )
+		{
+			if( libesedb_record_get_value_data_size(
+			     record1,
+			     value_entry,
+			     &value_data_size1,
+			     NULL ) != 1 )
+			{
+				return( -1 );
+			}
+			if( libesedb_record_get_value_data_size(
+			     record2,
+			     value_entry,
+			     &value_data_size2,
+			     NULL ) != 1 )
+			{
+				return( -1 );
+			}
+			if( value_data_size1 != value_data_size2 )
+			{
+				return( 0 );
+			}
+			continue;
+		}
+		if( libesedb_record_get_value_data_pointer(
+		     record1,
+		     value_entry,
+		     &value_data1,
+		     &value_data_size1,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		if( libesedb_record_get_value_data_pointer(
+		     record2,
+		     value_entry,
+		     &value_data2,
+		     &value_data_size2,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		if( value_data_size1 != value_data_size2 )
+		{
+			return( 0 );
+		}
+		if( ( value_data_size1 > 0 )
+		 && ( memory_compare(
+		       value_data1,
+		       value_data2,
+		       value_data_size1 ) != 0 ) )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Walks a table cursor and compares every record with the record retrieved by index
+ * Returns the number of records walked or -1 on error
+ */
+int esedb_test_table_cursor_walk(
+     libesedb_table_t *table,
+     libesedb_table_cursor_t *cursor,
+     int record_index )
+{
+	libesedb_record_t *cursor_record = NULL;
+	libesedb_record_t *record        = NULL;
+	int number_of_records            = 0;
+	int result                       = 0;
+
+	while( libesedb_table_cursor_next(
+	        cursor,
+	        &cursor_record,
+	        NULL ) == 1 )
+	{
+		if( libesedb_table_get_record(
+		     table,
+		     record_index,
+		     &record,
+		     NULL ) != 1 )
+		{
+			goto on_error;
+		}
+		result = esedb_test_table_cursor_compare_records(
+		          cursor_record,
+		          record );
+
+		if( result != 1 )
+		{
+			fprintf(
+			 stdout,
+			 "%s:%d cursor record differs from record: %d\n",
+			 __FILE__,
+			 __LINE__,
+			 record_index );
+
+			goto on_error;
+		}
+		if( libesedb_record_free(
+		     &record,
+		     NULL ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libesedb_record_free(
+		     &cursor_record,
+		     NULL ) != 1 )
+		{
+			goto on_error;
+		}
+		number_of_records++;
+		record_index++;
+	}
+	return( number_of_records );
+
+on_error:
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( cursor_record != NULL )
+	{
+		libesedb_record_free(
+		 &cursor_record,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libesedb_table_cursor_next function on a table
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_cursor_next_with_table(
+     libesedb_table_t *table )
+{
+	libcerror_error_t *error        = NULL;
+	libesedb_table_cursor_t *cursor = NULL;
+	libesedb_record_t *record       = NULL;
+	int number_of_cursor_records    = 0;
+	int number_of_records           = 0;
+	int result                      = 0;
+
+	result = libesedb_table_get_number_of_records(
+	          table,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the cursor returns the same records, in the same order, as the table
+	 */
+	result = libesedb_table_cursor_open(
+	          table,
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cursor",
+	 cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_cursor_records = esedb_test_table_cursor_walk(
+	                            table,
+	                            cursor,
+	                            0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_cursor_records",
+	 number_of_cursor_records,
+	 number_of_records );
+
+	/* Test that a cursor at the end does not return more records
+	 */
+	result = libesedb_table_cursor_next(
+	          cursor,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_cursor_close(
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( cursor != NULL )
+	{
+		libesedb_table_cursor_close(
+		 &cursor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_table_partition_cursor_open and libesedb_table_cursor_next functions on a table
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_partition_cursor_next_with_table(
+     libesedb_table_t *table )
+{
+	uint32_t partition_page_numbers[ 4 ];
+
+	libcerror_error_t *error        = NULL;
+	libesedb_table_cursor_t *cursor = NULL;
+	int number_of_cursor_records    = 0;
+	int number_of_partitions        = 0;
+	int number_of_records           = 0;
+	int partition_index             = 0;
+	int record_index                = 0;
+	int result                      = 0;
+
+	result = libesedb_table_get_number_of_records(
+	          table,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_partitions(
+	          table,
+	          4,
+	          partition_page_numbers,
+	          &number_of_partitions,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the partitions together return the records of the table in order
+	 */
+	for( partition_index = 0;
+	     partition_index < number_of_partitions;
+	     partition_index++ )
+	{
+		result = libesedb_table_partition_cursor_open(
+		          table,
+		          partition_page_numbers,
+		          number_of_partitions,
+		          partition_index,
+		          &cursor,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		number_of_cursor_records = esedb_test_table_cursor_walk(
+		                            table,
+		                            cursor,
+		                            record_index );
+
+		ESEDB_TEST_ASSERT_NOT_EQUAL_INT(
+		 "number_of_cursor_records",
+		 number_of_cursor_records,
+		 -1 );
+
+		record_index += number_of_cursor_records;
+
+		result = libesedb_table_cursor_close(
+		          &cursor,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "record_index",
+	 record_index,
+	 number_of_records );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cursor != NULL )
+	{
+		libesedb_table_cursor_close(
+		 &cursor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_table_cursor_seek function on a table
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_cursor_seek_with_table(
+     libesedb_table_t *table )
+{
+	uint8_t key_data[ 1 ]           = { 0x00 };
+	libcerror_error_t *error        = NULL;
+	libesedb_table_cursor_t *cursor = NULL;
+	int number_of_cursor_records    = 0;
+	int number_of_records           = 0;
+	int result                      = 0;
+
+	result = libesedb_table_get_number_of_records(
+	          table,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_cursor_open(
+	          table,
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Walk the cursor to the end so the seek has to reposition it
+	 */
+	number_of_cursor_records = esedb_test_table_cursor_walk(
+	                            table,
+	                            cursor,
+	                            0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_cursor_records",
+	 number_of_cursor_records,
+	 number_of_records );
+
+	/* Test that seeking a key smaller than all the keys positions the cursor
+	 * before the first record
+	 */
+	result = libesedb_table_cursor_seek(
+	          cursor,
+	          key_data,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 ( number_of_records > 0 ) ? 1 : 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_records > 0 )
+	{
+		number_of_cursor_records = esedb_test_table_cursor_walk(
+		                            table,
+		                            cursor,
+		                            0 );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "number_of_cursor_records",
+		 number_of_cursor_records,
+		 number_of_records );
+	}
+	/* Test error cases
+	 */
+	result = libesedb_table_cursor_seek(
+	          cursor,
+	          NULL,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_cursor_close(
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cursor != NULL )
+	{
+		libesedb_table_cursor_close(
+		 &cursor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_table_physical_cursor_open and libesedb_table_cursor_next functions on a table
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_physical_cursor_next_with_table(
+     libesedb_table_t *table )
+{
+	libcerror_error_t *error        = NULL;
+	libesedb_record_t *record       = NULL;
+	libesedb_table_cursor_t *cursor = NULL;
+	int number_of_cursor_records    = 0;
+	int number_of_records           = 0;
+	int result                      = 0;
+
+	result = libesedb_table_get_number_of_records(
+	          table,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_physical_cursor_open(
+	          table,
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cursor",
+	 cursor );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the physical cursor returns every record of the table once
+	 * the records are not returned in key order
+	 */
+	while( libesedb_table_cursor_next(
+	        cursor,
+	        &record,
+	        &error ) == 1 )
+	{
+		result = libesedb_record_free(
+		          &record,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		number_of_cursor_records++;
+	}
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_cursor_records",
+	 number_of_cursor_records,
+	 number_of_records );
+
+	result = libesedb_table_cursor_close(
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_physical_cursor_open(
+	          NULL,
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "cursor",
+	 cursor );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( cursor != NULL )
+	{
+		libesedb_table_cursor_close(
+		 &cursor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ )
+
+/* Tests the libesedb_table_cursor_set_next_physical_page function on a table
+ * The extents of the physical cursor are extended with the pages of another table
+ * of which the leaf pages should be skipped based on their father data page (FDP) object identifier
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_cursor_set_next_physical_page_with_tables(
+     libesedb_table_t *table,
+     libesedb_table_t *other_table )
+{
+	libcerror_error_t *error                          = NULL;
+	libesedb_internal_table_cursor_t *internal_cursor = NULL;
+	libesedb_internal_table_t *internal_table         = NULL;
+	libesedb_internal_table_t *other_internal_table   = NULL;
+	libesedb_record_t *record                         = NULL;
+	libesedb_table_cursor_t *cursor                   = NULL;
+	uint32_t *extents                                 = NULL;
+	uint32_t *other_extents                           = NULL;
+	uint32_t other_root_page_number                   = 0;
+	int extent_index                                  = 0;
+	int extents_size                                  = 0;
+	int number_of_cursor_records                      = 0;
+	int number_of_extents                             = 0;
+	int number_of_other_extents                       = 0;
+	int number_of_records                             = 0;
+	int result                                        = 0;
+
+	if( ( table == NULL )
+	 || ( other_table == NULL ) )
+	{
+		return( 0 );
+	}
+	internal_table         = (libesedb_internal_table_t *) table;
+	other_internal_table   = (libesedb_internal_table_t *) other_table;
+	other_root_page_number = other_internal_table->table_definition->table_catalog_definition->father_data_page_number;
+
+	if( internal_table->table_page_tree->object_identifier == other_internal_table->table_page_tree->object_identifier )
+	{
+		return( 1 );
+	}
+	result = libesedb_table_get_number_of_records(
+	          table,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_physical_cursor_open(
+	          table,
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_cursor = (libesedb_internal_table_cursor_t *) cursor;
+
+	/* The test requires a table with a space tree
+	 */
+	if( internal_cursor->extents != NULL )
+	{
+		/* Add the pages of the other table to the extents of the cursor
+		 */
+		result = libesedb_page_tree_get_owned_page_extents(
+		          other_internal_table->table_page_tree,
+		          other_internal_table->file_io_handle,
+		          other_root_page_number,
+		          &other_extents,
+		          &number_of_other_extents,
+		          &error );
+
+		ESEDB_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 0 )
+		{
+			result = libesedb_page_tree_insert_extent(
+			          &other_extents,
+			          &number_of_other_extents,
+			          &extents_size,
+			          other_root_page_number,
+			          1,
+			          &error );
+
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		extents_size = 0;
+
+		for( extent_index = 0;
+		     extent_index < internal_cursor->number_of_extents;
+		     extent_index++ )
+		{
+			result = libesedb_page_tree_insert_extent(
+			          &extents,
+			          &number_of_extents,
+			          &extents_size,
+			          internal_cursor->extents[ extent_index * 2 ],
+			          internal_cursor->extents[ ( extent_index * 2 ) + 1 ],
+			          &error );
+
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		for( extent_index = 0;
+		     extent_index < number_of_other_extents;
+		     extent_index++ )
+		{
+			result = libesedb_page_tree_insert_extent(
+			          &extents,
+			          &number_of_extents,
+			          &extents_size,
+			          other_extents[ extent_index * 2 ],
+			          other_extents[ ( extent_index * 2 ) + 1 ],
+			          &error );
+
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		memory_free(
+		 other_extents );
+
+		other_extents = NULL;
+
+		memory_free(
+		 internal_cursor->extents );
+
+		internal_cursor->extents                = extents;
+		internal_cursor->number_of_extents      = number_of_extents;
+		internal_cursor->extent_index           = 0;
+		internal_cursor->extent_page_number     = 0;
+		internal_cursor->read_ahead_page_number = 0;
+
+		extents = NULL;
+
+		result = libesedb_table_cursor_set_next_physical_page(
+		          internal_cursor,
+		          &error );
+
+		ESEDB_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test that only the records of the table are returned
+		 */
+		while( libesedb_table_cursor_next(
+		        cursor,
+		        &record,
+		        &error ) == 1 )
+		{
+			result = libesedb_record_free(
+			          &record,
+			          &error );
+
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			number_of_cursor_records++;
+		}
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "number_of_cursor_records",
+		 number_of_cursor_records,
+		 number_of_records );
+	}
+	/* Test error cases
+	 */
+	result = libesedb_table_cursor_set_next_physical_page(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_table_cursor_close(
+	          &cursor,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	if( other_extents != NULL )
+	{
+		memory_free(
+		 other_extents );
+	}
+	if( extents != NULL )
+	{
+		memory_free(
+		 extents );
+	}
+	if( cursor != NULL )
+	{
+		libesedb_table_cursor_close(
+		 &cursor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	libcerror_error_t *error      = NULL;
+	libesedb_file_t *file         = NULL;
+	libesedb_table_t *other_table = NULL;
+	libesedb_table_t *table       = NULL;
+	system_character_t *source    = NULL;
+	system_integer_t option       = 0;
+	int number_of_tables          = 0;
+	int result                    = 0;
+
+	while( ( option = libcsystem_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	ESEDB_TEST_RUN(
+	 "libesedb_table_cursor_open",
+	 esedb_test_table_cursor_open );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_table_partition_cursor_open",
+	 esedb_test_table_partition_cursor_open );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_table_cursor_close",
+	 esedb_test_table_cursor_close );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_table_cursor_next",
+	 esedb_test_table_cursor_next );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_table_cursor_seek",
+	 esedb_test_table_cursor_seek );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		/* Initialize test
+		 */
+		result = libesedb_file_initialize(
+		          &file,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "file",
+		 file );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libesedb_file_open_wide(
+		          file,
+		          source,
+		          LIBESEDB_OPEN_READ,
+		          &error );
+#else
+		result = libesedb_file_open(
+		          file,
+		          source,
+		          LIBESEDB_OPEN_READ,
+		          &error );
+#endif
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_file_get_number_of_tables(
+		          file,
+		          &number_of_tables,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( number_of_tables > 0 )
+		{
+			result = libesedb_file_get_table(
+			          file,
+			          0,
+			          &table,
+			          &error );
+
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "table",
+			 table );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			ESEDB_TEST_RUN_WITH_ARGS(
+			 "libesedb_table_cursor_next",
+			 esedb_test_table_cursor_next_with_table,
+			 table );
+
+			ESEDB_TEST_RUN_WITH_ARGS(
+			 "libesedb_table_partition_cursor_open",
+			 esedb_test_table_partition_cursor_next_with_table,
+			 table );
+
+			ESEDB_TEST_RUN_WITH_ARGS(
+			 "libesedb_table_cursor_seek",
+			 esedb_test_table_cursor_seek_with_table,
+			 table );
+
+			ESEDB_TEST_RUN_WITH_ARGS(
+			 "libesedb_table_physical_cursor_open",
+			 esedb_test_table_physical_cursor_next_with_table,
+			 table );
+
+#if defined( __GNUC__ )
+
+			if( number_of_tables > 1 )
+			{
+				result = libesedb_file_get_table(
+				          file,
+				          number_of_tables - 1,
+				          &other_table,
+				          &error );
+
+				ESEDB_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				ESEDB_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				ESEDB_TEST_RUN_WITH_ARGS(
+				 "libesedb_table_cursor_set_next_physical_page",
+				 esedb_test_table_cursor_set_next_physical_page_with_tables,
+				 table,
+				 other_table );
+
+				result = libesedb_table_free(
+				          &other_table,
+				          &error );
+
+				ESEDB_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				ESEDB_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+			}
+#endif /* defined( __GNUC__ ) */
+
+			/* Clean up
+			 */
+			result = libesedb_table_free(
+			          &table,
+			          &error );
+
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "table",
+			 table );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		/* Clean up
+		 */
+		result = libesedb_file_close(
+		          file,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_file_free(
+		          &file,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "file",
+		 file );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( other_table != NULL )
+	{
+		libesedb_table_free(
+		 &other_table,
+		 NULL );
+	}
+	if( table != NULL )
+	{
+		libesedb_table_free(
+		 &table,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libesedb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -10,8 +10,8 @@ $TestPrefix = Split-Path -path ${Pwd}.Path -parent
 $TestPrefix = Split-Path -path ${TestPrefix} -leaf
 $TestPrefix = ${TestPrefix}.Substring(3)
 
-$TestTypes = "catalog catalog_definition column column_type data_definition data_segment database index io_handle key long_value multi_value page page_tree page_value record table"
-$TestTypesWithInput = "file"
+$TestTypes = "catalog catalog_definition column column_type data_definition data_segment database index index_cursor io_handle key layout_index long_value multi_value page page_cache page_value record record_layout"
+$TestTypesWithInput = "file page_tree table table_cursor"
 
 $TestToolDirectory = "..\msvscpp\Release"
 
@@ -11,8 +11,8 @@ TEST_PREFIX=`dirname ${PWD}`;
 TEST_PREFIX=`basename ${TEST_PREFIX} | sed 's/^lib\([^-]*\).*$/\1/'`;
 
 TEST_PROFILE="lib${TEST_PREFIX}";
-TEST_TYPES="catalog catalog_definition column column_type data_definition data_segment database index io_handle key long_value multi_value page page_tree page_value record table";
-TEST_TYPES_WITH_INPUT="file";
+TEST_TYPES="catalog catalog_definition column column_type data_definition data_segment database index index_cursor io_handle key layout_index long_value multi_value page page_cache page_value record record_layout";
+TEST_TYPES_WITH_INPUT="file page_tree table table_cursor";
 OPTION_SETS="";
 
 TEST_TOOL_DIRECTORY=".";